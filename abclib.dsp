@@ -4775,6 +4775,10 @@ SOURCE=.\src\aig\gia\giaCof.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaConc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaCone.c
 # End Source File
 # Begin Source File
@@ -5551,6 +5555,10 @@ SOURCE=.\src\proof\fra\fraPart.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\fra\fraPfolio.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\fra\fraSat.c
 # End Source File
 # Begin Source File
@@ -5739,6 +5747,10 @@ SOURCE=.\src\proof\pdr\pdrCore.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrGen.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrIncr.c
 # End Source File
 # Begin Source File
@@ -5755,6 +5767,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
@@ -42,8 +42,18 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// the wide-index mode (ABC_USE_WIDE_GIA) uses 31-bit fanin diffs and
+// representatives, which raises the limit on the number of objects
+// from 2^29 to 2^30 (the largest count whose literals still fit into int)
+#ifdef ABC_USE_WIDE_GIA
+#define GIA_NONE 0x7FFFFFFF
+#define GIA_VOID 0x7FFFFFFF
+#define GIA_OBJ_MAX (1 << 30)
+#else
 #define GIA_NONE 0x1FFFFFFF
 #define GIA_VOID 0x0FFFFFFF
+#define GIA_OBJ_MAX (1 << 29)
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -52,12 +62,17 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;    
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
+typedef struct Gia_MmPage_t_         Gia_MmPage_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
 {
+#ifdef ABC_USE_WIDE_GIA
+    unsigned       iRepr   : 31;  // representative node
+#else
     unsigned       iRepr   : 28;  // representative node
+#endif
     unsigned       fProved :  1;  // marks the proved equivalence
     unsigned       fFailed :  1;  // marks the failed equivalence
     unsigned       fColorA :  1;  // marks cone of A
@@ -76,6 +91,18 @@ struct Gia_Plc_t_
 typedef struct Gia_Obj_t_ Gia_Obj_t;
 struct Gia_Obj_t_
 {
+#ifdef ABC_USE_WIDE_GIA
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+#else
     unsigned       iDiff0 :  29;  // the diff of the first fanin
     unsigned       fCompl0:   1;  // the complemented attribute
     unsigned       fMark0 :   1;  // first user-controlled mark
@@ -85,6 +112,7 @@ struct Gia_Obj_t_
     unsigned       fCompl1:   1;  // the complemented attribute
     unsigned       fMark1 :   1;  // second user-controlled mark
     unsigned       fPhase :   1;  // value under 000 pattern
+#endif
 
     unsigned       Value;         // application-specific value
 };
@@ -114,6 +142,8 @@ struct Gia_Man_t_
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
+    int            fHashOpen;     // uses open-addressing hash table
+    int            nHashOpen;     // the number of entries in the open-addressing table
     Vec_Int_t      vRefs;         // the reference count
     int *          pRefs;         // the reference count
     int *          pLutRefs;      // the reference count
@@ -165,6 +195,7 @@ struct Gia_Man_t_
     unsigned char* pSwitching;    // switching activity for each object
     Gia_Plc_t *    pPlacement;    // placement of the objects
     Gia_Man_t *    pAigExtra;     // combinational logic of holes
+    Vec_Str_t *    vAigerExtra;   // unparsed symbol table of the AIGER file
     Vec_Flt_t *    vInArrs;       // PI arrival times
     Vec_Flt_t *    vOutReqs;      // PO required times
     Vec_Int_t *    vCiArrs;       // CI arrival times
@@ -214,6 +245,14 @@ struct Gia_Man_t_
     Vec_Wrd_t *    vSimsPo;
     Vec_Int_t *    vClassOld;
     Vec_Int_t *    vClassNew;
+    // event-driven resimulation
+    int            fSimEvent;     // propagates only the changed simulation info
+    Vec_Wec_t *    vSimFanouts;   // fanouts of each object
+    Vec_Int_t *    vSimChanged;   // CIs whose simulation info changed since the last resimulation
+    Vec_Bit_t *    vSimMarks;     // nodes scheduled for resimulation
+    word           nSimPats;      // the number of patterns added
+    word           nSimEvals;     // the number of node evaluations during resimulation
+    word           nSimEvalsFull; // the number of node evaluations without event-driven resimulation
     // incremental simulation
     int            fIncrSim;
     int            iNextPi;
@@ -295,6 +334,20 @@ struct Gia_ParSim_t_
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
+    int            nThreads;      // the number of threads
+};
+
+// word-parallel simulation kernels (the masks are 0 or ~0 for complemented inputs)
+typedef struct Gia_SimKer_t_ Gia_SimKer_t;
+struct Gia_SimKer_t_
+{
+    char *         pName;
+    void        (* pFuncAnd)  ( word * pOut, word * p0, word * p1, word m0, word m1, int nWords );
+    void        (* pFuncXor)  ( word * pOut, word * p0, word * p1, word m0, word m1, int nWords );
+    void        (* pFuncMux)  ( word * pOut, word * pC, word * p1, word * p0, word mC, word m1, word m0, int nWords );
+    int         (* pFuncEqual)( word * p0, word * p1, word m, int nWords );
+    unsigned    (* pFuncHash) ( word * p, int nWords );
+    void        (* pFuncAnds) ( Gia_Man_t * p, word * pSims, int nWords );
 };
 
 typedef struct Gia_ManSim_t_ Gia_ManSim_t;
@@ -643,9 +696,9 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, GIA_OBJ_MAX );
+        if ( p->nObjs == GIA_OBJ_MAX )
+            printf( "Hard limit on the number of nodes (%d) is reached. Quitting...\n", GIA_OBJ_MAX ), exit(1);
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
@@ -659,7 +712,7 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
-    if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
+    if ( Vec_IntSize(&p->vHTable) && !p->fHashOpen ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
 }
 static inline int Gia_ManAppendCi( Gia_Man_t * p )  
@@ -1215,6 +1268,12 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadLazy( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int fLazy );
+extern void                Gia_AigerReadExtra( Gia_Man_t * p );
+extern int                 Gia_AigerSetChunk( int nChunk );
+extern int                 Gia_AigerSetThreads( int nThreads );
+extern char *              Gia_FileMap( char * pFileName, size_t * pnFileSize );
+extern void                Gia_FileUnmap( char * pContents, size_t nFileSize );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
@@ -1223,6 +1282,8 @@ extern void                Gia_AigerWriteSimple( Gia_Man_t * pInit, char * pFile
 /*=== giaBalance.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose );
 extern Gia_Man_t *         Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose );
+extern Gia_Man_t *         Gia_ManBalancePar( Gia_Man_t * p, int fSimpleAnd, int fStrict, int nThreads, int fVerbose );
+extern Gia_Man_t *         Gia_ManAreaBalancePar( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int nThreads, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn2( Gia_Man_t * p, int fOldAlgo, int fCoarsen, int fCutMin, int nRelaxRatio, int fDelayMin, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn3( Gia_Man_t * p, int fVerbose, int fVeryVerbose );
 extern Gia_Man_t *         Gia_ManAigSyn4( Gia_Man_t * p, int fVerbose, int fVeryVerbose );
@@ -1256,6 +1317,12 @@ extern void                Gia_ManPrintFanio( Gia_Man_t * pGia, int nNodes );
 extern Gia_Man_t *         Gia_ManDupCof( Gia_Man_t * p, int iVar );
 extern Gia_Man_t *         Gia_ManDupCofAllInt( Gia_Man_t * p, Vec_Int_t * vSigs, int fVerbose );
 extern Gia_Man_t *         Gia_ManDupCofAll( Gia_Man_t * p, int nFanLim, int fVerbose );
+/*=== giaConc.c ===========================================================*/
+typedef struct Gia_Con_t_ Gia_Con_t;
+extern Gia_Con_t *         Gia_ManConcStart( Gia_Man_t * p, int nObjsMax, int nThreads );
+extern int                 Gia_ManConcAnd( Gia_Con_t * p, int iThread, int iLit0, int iLit1 );
+extern Vec_Int_t *         Gia_ManConcStop( Gia_Con_t * p, int fVerbose );
+extern Gia_Man_t *         Gia_ManConcRehash( Gia_Man_t * p, int nThreads, int fVerbose );
 /*=== giaDfs.c ============================================================*/
 extern void                Gia_ManCollectCis( Gia_Man_t * p, int * pNodes, int nNodes, Vec_Int_t * vSupp );
 extern void                Gia_ManCollectAnds_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vNodes );
@@ -1285,6 +1352,7 @@ extern Gia_Man_t *         Gia_ManDupCycled( Gia_Man_t * pAig, Abc_Cex_t * pCex,
 extern Gia_Man_t *         Gia_ManDup( Gia_Man_t * p );  
 extern Gia_Man_t *         Gia_ManDup2( Gia_Man_t * p1, Gia_Man_t * p2 );
 extern Gia_Man_t *         Gia_ManDupWithAttributes( Gia_Man_t * p );  
+extern Gia_Man_t *         Gia_ManDupSnapshot( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManDupRemovePis( Gia_Man_t * p, int nRemPis );
 extern Gia_Man_t *         Gia_ManDupZero( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManDupPerm( Gia_Man_t * p, Vec_Int_t * vPiPerm );
@@ -1430,6 +1498,8 @@ extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1
 extern int                 Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 );
 extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
+extern int                 Gia_ManHashSetOpen( int fOpen );
+extern void                Gia_ManHashCompare( Gia_Man_t * p, int nIters, int fVerbose );
 extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 );
 extern int                 Gia_ManHashAndMulti( Gia_Man_t * p, Vec_Int_t * vLits );
@@ -1475,6 +1545,7 @@ extern Gia_Man_t *         Gia_ManStart( int nObjsMax );
 extern void                Gia_ManStop( Gia_Man_t * p );  
 extern void                Gia_ManStopP( Gia_Man_t ** p );  
 extern double              Gia_ManMemory( Gia_Man_t * p );
+extern void                Gia_ManBenchCore( Gia_Man_t * p, int nLutSize, int fVerbose );
 extern void                Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars ); 
 extern void                Gia_ManPrintStatsShort( Gia_Man_t * p ); 
 extern void                Gia_ManPrintMiterStatus( Gia_Man_t * p ); 
@@ -1501,6 +1572,13 @@ extern void                Gia_MmStepStop( Gia_MmStep_t * p, int fVerbose );
 extern char *              Gia_MmStepEntryFetch( Gia_MmStep_t * p, int nBytes );
 extern void                Gia_MmStepEntryRecycle( Gia_MmStep_t * p, char * pEntry, int nBytes );
 extern int                 Gia_MmStepReadMemUsage( Gia_MmStep_t * p );
+extern Gia_MmPage_t *      Gia_MmPageStart( int LogPageSize );
+extern void                Gia_MmPageStop( Gia_MmPage_t * p, int fVerbose );
+extern char *              Gia_MmPageFetch( Gia_MmPage_t * p );
+extern void                Gia_MmPageRecycle( Gia_MmPage_t * p, char * pPage );
+extern void                Gia_MmPageRecycleAll( Gia_MmPage_t * p, Vec_Ptr_t * vStore );
+extern int                 Gia_MmPageReadPageSize( Gia_MmPage_t * p );
+extern double              Gia_MmPageReadMemUsage( Gia_MmPage_t * p );
 /*=== giaMf.c ===========================================================*/
 extern void                Mf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
@@ -1542,6 +1620,7 @@ extern int *               Gia_SortFloats( float * pArray, int * pPerm, int nSiz
 /*=== giaSim.c ============================================================*/
 extern void                Gia_ManSimSetDefaultParams( Gia_ParSim_t * p );
 extern int                 Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
+extern int                 Gia_ManSimSimulatePar( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
 extern unsigned *          Gia_SimDataExt( Gia_ManSim_t * p, int i );
 extern unsigned *          Gia_SimDataCiExt( Gia_ManSim_t * p, int i );
 extern unsigned *          Gia_SimDataCoExt( Gia_ManSim_t * p, int i );
@@ -1555,12 +1634,30 @@ extern int                 Gia_ManBuiltInSimCheckEqual( Gia_Man_t * p, int iLit0
 extern void                Gia_ManBuiltInSimResimulateCone( Gia_Man_t * p, int iLit0, int iLit1 );
 extern void                Gia_ManBuiltInSimResimulate( Gia_Man_t * p );
 extern int                 Gia_ManBuiltInSimAddPat( Gia_Man_t * p, Vec_Int_t * vPat );
+extern void                Gia_ManBuiltInSimSetEvent( Gia_Man_t * p, int fEvent );
+extern int                 Gia_ManSimEventPropagate( Gia_Man_t * p, Gia_SimKer_t * pKer, Vec_Wec_t * vFanouts, Vec_Int_t * vChanged, Vec_Bit_t * vMarks );
+extern void                Gia_ManBuiltInSimPrintStats( Gia_Man_t * p );
+extern void                Gia_ManBuiltInSimBench( Gia_Man_t * p, int nWords, int nPats, int fEvent, int fVerbose );
 extern void                Gia_ManIncrSimStart( Gia_Man_t * p, int nWords, int nObjs );
 extern void                Gia_ManIncrSimSet( Gia_Man_t * p, Vec_Int_t * vObjLits );
 extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
+extern int                 Gia_ManSimSetThreads( int nThreads );
+extern int                 Gia_ManSimGetThreads();
+extern void                Gia_ManSimPatSimPar( Gia_Man_t * p, Vec_Wrd_t * vSims, int nWords, int nThreads, int fCos );
+extern int                 Gia_ManSimSimulateComb( Gia_Man_t * p, Gia_ParSim_t * pPars );
+extern int                 Gia_SimKernelBest();
+extern int                 Gia_SimKernelSet( int iKer );
+extern char *              Gia_SimKernelName();
+extern Gia_SimKer_t *      Gia_SimKernelGet();
+extern void                Gia_SimKernelAnd( word * pOut, word * p0, word * p1, int fCompl0, int fCompl1, int nWords );
+extern void                Gia_SimKernelXor( word * pOut, word * p0, word * p1, int fCompl0, int fCompl1, int nWords );
+extern void                Gia_SimKernelMux( word * pOut, word * pC, word * p1, word * p0, int fComplC, int fCompl1, int fCompl0, int nWords );
+extern int                 Gia_SimKernelEqual( word * p0, word * p1, int fCompl, int nWords );
+extern unsigned            Gia_SimKernelHash( word * p, int nWords );
+extern void                Gia_ManSimKernelBench( Gia_Man_t * p, int nWords, int nRounds, int iKernel, int fVerbose );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -1676,6 +1773,7 @@ extern int                 Gia_ManLevelRNum( Gia_Man_t * p );
 extern Vec_Int_t *         Gia_ManGetCiLevels( Gia_Man_t * p );
 extern int                 Gia_ManSetLevels( Gia_Man_t * p, Vec_Int_t * vCiLevels );
 extern Vec_Int_t *         Gia_ManReverseLevel( Gia_Man_t * p );
+extern Vec_Int_t *         Gia_ManLevelOrder( Gia_Man_t * p, Vec_Int_t ** pvStarts );
 extern Vec_Int_t *         Gia_ManRequiredLevel( Gia_Man_t * p );
 extern void                Gia_ManCreateValueRefs( Gia_Man_t * p );
 extern void                Gia_ManCreateRefs( Gia_Man_t * p );
@@ -23,6 +23,28 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -31,6 +53,38 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// The AND section of the binary AIGER file can be split into chunks of 
+// the same number of AND nodes. Since the numbers stored for each node are 
+// relative to the node's own literal, the chunks can be decoded 
+// independently if their byte offsets are known. The offsets are saved 
+// as 64-bit numbers in the extension "x" (the last binary extension of 
+// the file), and its position is given by the marker line at the end of 
+// the comment section, so the file remains a valid AIGER file for other tools.
+
+#define GIA_AIGER_CHUNK    (1 << 16)    // the default number of AND nodes in one chunk
+#define GIA_AIGER_THR_MAX  64           // the largest number of threads
+#define GIA_AIGER_INDEX    "The chunk index of the AND section is at byte "
+
+typedef struct Gia_AigPar_t_ Gia_AigPar_t;
+struct Gia_AigPar_t_
+{
+    Gia_Man_t *     pGia;       // the AIG (encoding)
+    Vec_Int_t *     vAnds;      // the AND nodes in the order of writing (encoding)
+    Vec_Ptr_t *     vChunks;    // the encoded chunks (encoding)
+    int             fValues;    // the node numbers are in the Value fields (encoding)
+    unsigned char * pData;      // the beginning of the AND section (decoding)
+    ABC_INT64_T *   pOffsets;   // the chunk offsets in the AND section (decoding)
+    unsigned *      pLits;      // the fanin literals of the AND nodes (decoding)
+    int             nCis;       // the number of CIs (decoding)
+    int             nAnds;      // the number of AND nodes
+    int             nChunk;     // the number of AND nodes in one chunk
+    int             nChunks;    // the number of chunks
+    int             nThreads;   // the number of threads
+};
+
+static int s_nAigerChunk   = 0; // the number of AND nodes in one chunk of the index (0 = no index)
+static int s_nAigerThreads = 1; // the number of threads used to encode and decode the AND section
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -82,6 +136,15 @@ void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
     Gia_AigerWriteInt( Buffer, nSize );
     fwrite( Buffer, 1, 4, pFile );
 }
+static void Gia_FileWriteBufferWord( FILE * pFile, word Entry )
+{
+    Gia_FileWriteBufferSize( pFile, (int)(Entry >> 32) );
+    Gia_FileWriteBufferSize( pFile, (int)(Entry & 0xFFFFFFFF) );
+}
+static inline ABC_INT64_T Gia_AigerReadWord( unsigned char * pPos )
+{
+    return (ABC_INT64_T)(((word)(unsigned)Gia_AigerReadInt(pPos) << 32) | (word)(unsigned)Gia_AigerReadInt(pPos + 4));
+}
 
 /**Function*************************************************************
 
@@ -164,215 +227,375 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 /**Function*************************************************************
 
-  Synopsis    [Reads the AIG in the binary AIGER format.]
+  Synopsis    [Sets the parameters of chunked encoding and decoding.]
 
-  Description []
+  Description [The AND section of the binary AIGER file is split into 
+  chunks of nChunk AND nodes. If nChunk > 0, the writer saves the byte 
+  offsets of the chunks in the index extension "x". When the reader finds 
+  the index, the chunks are decoded independently by nThreads threads. 
+  Returns the old value of the parameter.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+int Gia_AigerSetChunk( int nChunk )
 {
-    Gia_Man_t * pNew, * pTemp;
-    Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
-    Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
-    int iObj, iNode0, iNode1, fHieOnly = 0;
-    int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
-    int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
-    unsigned char * pDrivers, * pSymbols, * pCur;
-    unsigned uLit0, uLit1, uLit;
+    int nChunkOld = s_nAigerChunk;
+    s_nAigerChunk = nChunk;
+    return nChunkOld;
+}
+int Gia_AigerSetThreads( int nThreads )
+{
+    int nThreadsOld = s_nAigerThreads;
+    s_nAigerThreads = Abc_MinInt( Abc_MaxInt(nThreads, 1), GIA_AIGER_THR_MAX );
+    return nThreadsOld;
+}
 
-    // read the parameters (M I L O A + B C J F)
-    pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of objects
-    nTotal = atoi( (const char *)pCur );    while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of inputs
-    nInputs = atoi( (const char *)pCur );   while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of latches
-    nLatches = atoi( (const char *)pCur );  while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of outputs
-    nOutputs = atoi( (const char *)pCur );  while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of nodes
-    nAnds = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-    if ( *pCur == ' ' )
-    {
-//        assert( nOutputs == 0 );
-        // read the number of properties
-        pCur++;
-        nBad = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nBad;
-    }
-    if ( *pCur == ' ' )
-    {
-        // read the number of properties
-        pCur++;
-        nConstr = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nConstr;
-    }
-    if ( *pCur == ' ' )
-    {
-        // read the number of properties
-        pCur++;
-        nJust = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nJust;
-    }
-    if ( *pCur == ' ' )
-    {
-        // read the number of properties
-        pCur++;
-        nFair = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nFair;
-    }
-    if ( *pCur != '\n' )
-    {
-        fprintf( stdout, "The parameter line is in a wrong format.\n" );
-        return NULL;
-    }
-    pCur++;
+/**Function*************************************************************
 
-    // check the parameters
-    if ( nTotal != nInputs + nLatches + nAnds )
-    {
-        fprintf( stdout, "The number of objects does not match.\n" );
-        return NULL;
+  Synopsis    [Decodes an array of variable-length unsigned numbers.]
+
+  Description [Returns the pointer to the byte following the last number, 
+  or NULL if the numbers do not fit in the range. The terminating bytes 
+  (those with the high bit clear) are found sixteen at a time. If all 
+  sixteen bytes are terminating, they are copied without decoding.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned char * Gia_AigerReadUnsignedArray( unsigned char * pCur, unsigned char * pLimit, unsigned * pOut, int nValues )
+{
+    unsigned x;
+    int k = 0, j, s;
+#if defined(__SSE2__)
+    while ( k + 16 <= nValues && pCur + 16 <= pLimit )
+    {
+        unsigned Mask = (unsigned)_mm_movemask_epi8( _mm_loadu_si128((const __m128i *)pCur) );
+        int Last;
+        if ( Mask == 0 )
+        {
+            for ( j = 0; j < 16; j++ )
+                pOut[k++] = pCur[j];
+            pCur += 16;
+            continue;
+        }
+        if ( Mask == 0xFFFF )
+            return NULL;
+        // decode the numbers terminated in this block
+        for ( Last = 15; (Mask >> Last) & 1; Last-- );
+        for ( x = s = j = 0; j <= Last; j++ )
+        {
+            x |= (unsigned)(pCur[j] & 0x7f) << s;
+            if ( (Mask >> j) & 1 )
+            {
+                if ( (s += 7) > 28 )
+                    return NULL;
+                continue;
+            }
+            pOut[k++] = x;
+            x = s = 0;
+        }
+        pCur += Last + 1;
     }
-    if ( nJust || nFair )
+#endif
+    for ( ; k < nValues; k++ )
     {
-        fprintf( stdout, "Reading AIGER files with liveness properties is currently not supported.\n" );
-        return NULL;
+        for ( x = s = 0; pCur < pLimit && (*pCur & 0x80); s += 7 )
+        {
+            if ( s == 28 )
+                return NULL;
+            x |= (unsigned)(*pCur++ & 0x7f) << s;
+        }
+        if ( pCur == pLimit )
+            return NULL;
+        pOut[k] = x | ((unsigned)*pCur++ << s);
     }
+    return pCur;
+}
 
-    if ( nConstr )
-    {
-        if ( nConstr == 1 )
-            fprintf( stdout, "Warning: The last output is interpreted as a constraint.\n" );
-        else
-            fprintf( stdout, "Warning: The last %d outputs are interpreted as constraints.\n", nConstr );
-    }
+/**Function*************************************************************
 
-    // allocate the empty AIG
-    pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
-    pNew->nConstrs = nConstr;
-    pNew->fGiaSimple = fGiaSimple;
+  Synopsis    [Decodes or encodes one chunk of the AND section.]
 
-    // prepare the array of nodes
-    vNodes = Vec_IntAlloc( 1 + nTotal );
-    Vec_IntPush( vNodes, 0 );
+  Description [When decoding, the two numbers of each AND node are replaced 
+  by its fanin literals (the larger one first). Returns 0 if the chunk 
+  does not end where the index says it should, or if the literals are 
+  out of range.]
+  
+  SideEffects []
 
-    // create the PIs
-    for ( i = 0; i < nInputs + nLatches; i++ )
-    {
-        iObj = Gia_ManAppendCi(pNew);    
-        Vec_IntPush( vNodes, iObj );
-    }
+  SeeAlso     []
 
-    // remember the beginning of latch/PO literals
-    pDrivers = pCur;
-    if ( pContents[3] == ' ' ) // standard AIGER
-    {
-        // scroll to the beginning of the binary data
-        for ( i = 0; i < nLatches + nOutputs; )
-            if ( *pCur++ == '\n' )
-                i++;
-    }
-    else // modified AIGER
+***********************************************************************/
+static int Gia_AigerDecodeChunk( Gia_AigPar_t * p, int c )
+{
+    int iBeg = c * p->nChunk, iEnd = Abc_MinInt( iBeg + p->nChunk, p->nAnds ), i;
+    unsigned char * pBeg = p->pData + p->pOffsets[c];
+    unsigned char * pEnd = p->pData + p->pOffsets[c+1];
+    unsigned * pLits = p->pLits + 2 * iBeg, uLit;
+    if ( Gia_AigerReadUnsignedArray( pBeg, pEnd, pLits, 2 * (iEnd - iBeg) ) != pEnd )
+        return 0;
+    for ( i = iBeg; i < iEnd; i++, pLits += 2 )
     {
-        vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
+        uLit = (unsigned)(p->nCis + 1 + i) << 1;
+        if ( pLits[0] == 0 || pLits[0] > uLit || pLits[1] > uLit - pLits[0] )
+            return 0;
+        pLits[0] = uLit - pLits[0];
+        pLits[1] = pLits[0] - pLits[1];
     }
-
-    // create the AND gates
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
-    {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
-//        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-        if ( !fGiaSimple && fSkipStrash )
+    return 1;
+}
+static int Gia_AigerEncodeChunk( Gia_AigPar_t * p, int c )
+{
+    int iBeg = c * p->nChunk, iEnd = Abc_MinInt( iBeg + p->nChunk, p->nAnds ), i;
+    Vec_Str_t * vStr = (Vec_Str_t *)Vec_PtrEntry( p->vChunks, c );
+    unsigned char * pBuffer;
+    unsigned uLit, uLit0, uLit1;
+    int Pos = 0;
+    Vec_StrGrow( vStr, 10 * (iEnd - iBeg) + 10 );
+    pBuffer = (unsigned char *)Vec_StrArray( vStr );
+    for ( i = iBeg; i < iEnd; i++ )
+    {
+        int iObj = Vec_IntEntry( p->vAnds, i );
+        Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+        if ( p->fValues )
         {
-            if ( iNode0 == iNode1 )
-                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
-            else
-                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+            uLit  = Abc_Var2Lit( Gia_ObjValue(pObj), 0 );
+            uLit0 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+            uLit1 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
+            if ( uLit0 > uLit1 )
+                ABC_SWAP( unsigned, uLit0, uLit1 );
         }
         else
-            Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        {
+            uLit  = Abc_Var2Lit( iObj, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, iObj );
+            uLit1 = Gia_ObjFaninLit1( pObj, iObj );
+        }
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
     }
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashStop( pNew );
+    vStr->nSize = Pos;
+    return 1;
+}
 
-    // remember the place where symbols begin
-    pSymbols = pCur;
+/**Function*************************************************************
 
-    // read the latch driver literals
-    vDrivers = Vec_IntAlloc( nLatches + nOutputs );
-    if ( pContents[3] == ' ' ) // standard AIGER
-    {
-        vInits = Vec_IntAlloc( nLatches );
-        pCur = pDrivers;
-        for ( i = 0; i < nLatches; i++ )
+  Synopsis    [Processes the chunks using several threads.]
+
+  Description [Thread i processes chunks i, i + nThreads, i + 2*nThreads, 
+  etc. Returns 1 if all chunks were processed successfully.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_AigerProcessChunks( Gia_AigPar_t * p, int iThread )
+{
+    int c, RetValue = 1;
+    for ( c = iThread; c < p->nChunks; c += p->nThreads )
+        if ( !(p->vChunks ? Gia_AigerEncodeChunk(p, c) : Gia_AigerDecodeChunk(p, c)) )
+            RetValue = 0;
+    return RetValue;
+}
+#ifdef ABC_USE_PTHREADS
+typedef struct Gia_AigThr_t_ Gia_AigThr_t;
+struct Gia_AigThr_t_
+{
+    Gia_AigPar_t *  p;
+    int             iThread;
+    int             RetValue;
+};
+static void * Gia_AigerWorkerThread( void * pArg )
+{
+    Gia_AigThr_t * pThData = (Gia_AigThr_t *)pArg;
+    pThData->RetValue = Gia_AigerProcessChunks( pThData->p, pThData->iThread );
+    return NULL;
+}
+#endif
+static int Gia_AigerRunChunks( Gia_AigPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 && p->nChunks > 1 )
+    {
+        pthread_t WorkerThread[GIA_AIGER_THR_MAX];
+        Gia_AigThr_t ThData[GIA_AIGER_THR_MAX];
+        int i, status, RetValue = 1;
+        p->nThreads = Abc_MinInt( p->nThreads, p->nChunks );
+        for ( i = 0; i < p->nThreads; i++ )
         {
-            uLit0 = atoi( (char *)pCur );   
-            while ( *pCur != ' ' && *pCur != '\n' ) 
-                pCur++;
-            if ( *pCur == ' ' )
-            {
-                pCur++;
-                Vec_IntPush( vInits, atoi( (char *)pCur ) );
-                while ( *pCur++ != '\n' );
-            }
-            else
-            {
-                pCur++;
-                Vec_IntPush( vInits, 0 );
-            }
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
+            ThData[i].p        = p;
+            ThData[i].iThread  = i;
+            ThData[i].RetValue = 0;
+            status = pthread_create( WorkerThread + i, NULL, Gia_AigerWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
         }
-        // read the PO driver literals
-        for ( i = 0; i < nOutputs; i++ )
+        for ( i = 0; i < p->nThreads; i++ )
         {
-            uLit0 = atoi( (char *)pCur );   while ( *pCur++ != '\n' );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+            RetValue &= ThData[i].RetValue;
         }
-
+        return RetValue;
     }
-    else
+#endif
+    p->nThreads = 1;
+    return Gia_AigerProcessChunks( p, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the AND section using the chunk index.]
+
+  Description [The index is found using the marker line at the end of the 
+  file. Returns the array of fanin literals (two per AND node, the larger 
+  one first) and sets *ppSymbols to the end of the AND section. Returns 
+  NULL if the index is not present or does not match the AND section; 
+  in this case, the caller decodes the section sequentially.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned * Gia_AigerReadIndexed( char * pContents, size_t nFileSize, unsigned char * pCur, int nCis, int nAnds, unsigned char ** ppSymbols )
+{
+    Gia_AigPar_t Par, * p = &Par;
+    unsigned char * pIndex;
+    ABC_INT64_T Pos, Start = (ABC_INT64_T)(pCur - (unsigned char *)pContents), nSize;
+    int nMarker = strlen(GIA_AIGER_INDEX), i;
+    if ( nAnds == 0 || nFileSize < (size_t)nMarker + 21 )
+        return NULL;
+    // find the marker line "<marker><20-digit offset>\n" at the end of the file
+    if ( pContents[nFileSize-1] != '\n' || strncmp(pContents + nFileSize - nMarker - 21, GIA_AIGER_INDEX, nMarker) )
+        return NULL;
+    Pos = (ABC_INT64_T)strtoll( pContents + nFileSize - 21, NULL, 10 );
+    if ( Pos <= Start || (size_t)Pos + 37 > nFileSize || pContents[Pos] != 'x' )
+        return NULL;
+    // read the index: size, then 64-bit chunk size, chunk count, section start, offsets
+    pIndex = (unsigned char *)pContents + Pos + 1;
+    memset( p, 0, sizeof(Gia_AigPar_t) );
+    nSize = (unsigned)Gia_AigerReadInt( pIndex );
+    if ( Gia_AigerReadWord( pIndex + 4 ) <= 0 || Gia_AigerReadWord( pIndex + 4 ) > nAnds )
+        return NULL;
+    p->nChunk  = (int)Gia_AigerReadWord( pIndex + 4 );
+    p->nChunks = (nAnds + p->nChunk - 1) / p->nChunk;
+    if ( Gia_AigerReadWord( pIndex + 12 ) != p->nChunks || nSize != 8 * ((ABC_INT64_T)p->nChunks + 4) || (size_t)(Pos + 5 + nSize) > nFileSize )
+        return NULL;
+    if ( Gia_AigerReadWord( pIndex + 20 ) != Start )
+        return NULL;
+    p->pOffsets = ABC_ALLOC( ABC_INT64_T, p->nChunks + 1 );
+    for ( i = 0; i <= p->nChunks; i++ )
     {
-        // read the latch driver literals
-        for ( i = 0; i < nLatches; i++ )
+        p->pOffsets[i] = Gia_AigerReadWord( pIndex + 28 + (size_t)8 * i );
+        if ( (i == 0 && p->pOffsets[i] != 0) || (i > 0 && p->pOffsets[i] < p->pOffsets[i-1]) || Start + p->pOffsets[i] > Pos )
         {
-            uLit0 = Vec_IntEntry( vLits, i );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
+            ABC_FREE( p->pOffsets );
+            return NULL;
         }
-        // read the PO driver literals
-        for ( i = 0; i < nOutputs; i++ )
+    }
+    // decode the chunks
+    p->pData    = pCur;
+    p->pLits    = ABC_ALLOC( unsigned, 2 * nAnds );
+    p->nCis     = nCis;
+    p->nAnds    = nAnds;
+    p->nThreads = s_nAigerThreads;
+    if ( !Gia_AigerRunChunks( p ) )
+        ABC_FREE( p->pLits );
+    else
+        *ppSymbols = pCur + p->pOffsets[p->nChunks];
+    ABC_FREE( p->pOffsets );
+    return p->pLits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes the AND section by chunks.]
+
+  Description [The AND nodes listed in vAnds are encoded in this order. 
+  If fValues is 1, the node numbers are taken from the Value fields. 
+  Returns the array of encoded chunks.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Gia_AigerWriteChunks( Gia_Man_t * pGia, Vec_Int_t * vAnds, int fValues, int nChunk, int nThreads )
+{
+    Gia_AigPar_t Par, * p = &Par;
+    int c;
+    memset( p, 0, sizeof(Gia_AigPar_t) );
+    p->pGia     = pGia;
+    p->vAnds    = vAnds;
+    p->fValues  = fValues;
+    p->nAnds    = Vec_IntSize(vAnds);
+    p->nChunk   = nChunk;
+    p->nChunks  = (p->nAnds + nChunk - 1) / nChunk;
+    p->nThreads = nThreads;
+    p->vChunks  = Vec_PtrAlloc( p->nChunks );
+    for ( c = 0; c < p->nChunks; c++ )
+        Vec_PtrPush( p->vChunks, Vec_StrAlloc(0) );
+    Gia_AigerRunChunks( p );
+    return p->vChunks;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the end of the symbol table.]
+
+  Description [Returns the beginning of the comment section, or pSymbols
+  if the names define constraints or invariants, which change the AIG
+  and cannot be applied later.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned char * Gia_AigerSkipSymbols( unsigned char * pSymbols, unsigned char * pEnd )
+{
+    unsigned char * pCur = pSymbols;
+    while ( pCur < pEnd && *pCur != 'c' )
+    {
+        if ( *pCur == 'o' )
         {
-            uLit0 = Vec_IntEntry( vLits, i+nLatches );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
-            Vec_IntPush( vDrivers, iNode0 );
+            unsigned char * pName = pCur;
+            while ( pName < pEnd && *pName != ' ' && *pName != '\n' )
+                pName++;
+            while ( pName < pEnd && *pName == ' ' )
+                pName++;
+            if ( pEnd - pName >= 11 && strncmp( (char *)pName, "constraint:", 11 ) == 0 )
+                return pSymbols;
+            if ( pEnd - pName >= 10 && strncmp( (char *)pName, "invariant:", 10 ) == 0 )
+                return pSymbols;
         }
-        Vec_IntFree( vLits );
+        while ( pCur < pEnd && *pCur++ != '\n' );
     }
+    return pCur;
+}
 
-    // create the POs
-    for ( i = 0; i < nOutputs; i++ )
-        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, nLatches + i) );
-    for ( i = 0; i < nLatches; i++ )
-        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, i) );
-    Vec_IntFree( vDrivers );
+/**Function*************************************************************
 
-    // create the latches
-    Gia_ManSetRegNum( pNew, nLatches );
+  Synopsis    [Reads the symbol table and the extensions of the AIGER file.]
+
+  Description [Parses the part of the file starting at pSymbols and attaches
+  the information to the AIG. Returns 1 if the box hierarchy was read.
+  Constraints recognized by names are returned in *pvPoTypes.]
+
+  SideEffects []
 
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_AigerReadTail( Gia_Man_t * pNew, char * pContents, size_t nFileSize, unsigned char * pSymbols, int nInputs, int nOutputs, int nLatches, int fSkipStrash, Vec_Int_t ** pvPoTypes )
+{
+    Vec_Int_t * vPoTypes = NULL;
+    unsigned char * pCur;
+    int i, fHieOnly = 0;
     // read signal names if they are of the special type
     pCur = pSymbols;
     if ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
@@ -736,45 +959,290 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
             else if ( *pCur == 't' )
             {
                 pCur++;
-                vStr = Vec_StrStart( Gia_AigerReadInt(pCur) );          pCur += 4;
-                memcpy( Vec_StrArray(vStr), pCur, (size_t)Vec_StrSize(vStr) );  pCur += Vec_StrSize(vStr);
-                pNew->pManTime = Tim_ManLoad( vStr, 0 );
-                Vec_StrFree( vStr );
-                if ( fVerbose ) printf( "Finished reading extension \"t\".\n" );
-            }
-            // read object classes
-            else if ( *pCur == 'v' )
+                vStr = Vec_StrStart( Gia_AigerReadInt(pCur) );          pCur += 4;
+                memcpy( Vec_StrArray(vStr), pCur, (size_t)Vec_StrSize(vStr) );  pCur += Vec_StrSize(vStr);
+                pNew->pManTime = Tim_ManLoad( vStr, 0 );
+                Vec_StrFree( vStr );
+                if ( fVerbose ) printf( "Finished reading extension \"t\".\n" );
+            }
+            // read object classes
+            else if ( *pCur == 'v' )
+            {
+                pCur++;
+                pNew->vObjClasses = Vec_IntStart( Gia_AigerReadInt(pCur)/4 ); pCur += 4;
+                memcpy( Vec_IntArray(pNew->vObjClasses), pCur, (size_t)4*Vec_IntSize(pNew->vObjClasses) );
+                pCur += 4*Vec_IntSize(pNew->vObjClasses);
+                if ( fVerbose ) printf( "Finished reading extension \"v\".\n" );
+            }
+            // read edge information
+            else if ( *pCur == 'w' )
+            {
+                Vec_Int_t * vPairs;
+                int i, nPairs;
+                pCur++;
+                pCurTemp = pCur + Gia_AigerReadInt(pCur) + 4;           pCur += 4;
+                nPairs = Gia_AigerReadInt(pCur);                        pCur += 4;
+                vPairs = Vec_IntAlloc( 2*nPairs );
+                for ( i = 0; i < 2*nPairs; i++ )
+                    Vec_IntPush( vPairs, Gia_AigerReadInt(pCur) ),      pCur += 4;
+                assert( pCur == pCurTemp );
+                if ( fSkipStrash )
+                {
+                    Gia_ManEdgeFromArray( pNew, vPairs );
+                    if ( fVerbose ) printf( "Finished reading extension \"w\".\n" );
+                }
+                else
+                    printf( "Cannot read extension \"w\" because AIG is rehashed. Use \"&r -s <file.aig>\".\n" );
+                Vec_IntFree( vPairs );
+            }
+            // skip the chunk index of the AND section
+            else if ( *pCur == 'x' )
+            {
+                pCur++;
+                pCur += 4 + Gia_AigerReadInt(pCur);
+                if ( fVerbose ) printf( "Finished reading extension \"x\".\n" );
+            }
+            else break;
+        }
+    }
+    *pvPoTypes = vPoTypes;
+    return fHieOnly;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int fLazy )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
+    Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
+    int iObj, iNode0, iNode1, fHieOnly = 0;
+    int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
+    int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
+    unsigned char * pDrivers, * pSymbols, * pCur;
+    unsigned uLit0, uLit1, uLit, * pLitsPar;
+
+    // read the parameters (M I L O A + B C J F)
+    pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
+    // read the number of objects
+    nTotal = atoi( (const char *)pCur );    while ( *pCur != ' ' ) pCur++; pCur++;
+    // read the number of inputs
+    nInputs = atoi( (const char *)pCur );   while ( *pCur != ' ' ) pCur++; pCur++;
+    // read the number of latches
+    nLatches = atoi( (const char *)pCur );  while ( *pCur != ' ' ) pCur++; pCur++;
+    // read the number of outputs
+    nOutputs = atoi( (const char *)pCur );  while ( *pCur != ' ' ) pCur++; pCur++;
+    // read the number of nodes
+    nAnds = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
+    if ( *pCur == ' ' )
+    {
+//        assert( nOutputs == 0 );
+        // read the number of properties
+        pCur++;
+        nBad = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
+        nOutputs += nBad;
+    }
+    if ( *pCur == ' ' )
+    {
+        // read the number of properties
+        pCur++;
+        nConstr = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
+        nOutputs += nConstr;
+    }
+    if ( *pCur == ' ' )
+    {
+        // read the number of properties
+        pCur++;
+        nJust = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
+        nOutputs += nJust;
+    }
+    if ( *pCur == ' ' )
+    {
+        // read the number of properties
+        pCur++;
+        nFair = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
+        nOutputs += nFair;
+    }
+    if ( *pCur != '\n' )
+    {
+        fprintf( stdout, "The parameter line is in a wrong format.\n" );
+        return NULL;
+    }
+    pCur++;
+
+    // check the parameters
+    if ( nTotal != nInputs + nLatches + nAnds )
+    {
+        fprintf( stdout, "The number of objects does not match.\n" );
+        return NULL;
+    }
+    if ( nJust || nFair )
+    {
+        fprintf( stdout, "Reading AIGER files with liveness properties is currently not supported.\n" );
+        return NULL;
+    }
+
+    if ( nConstr )
+    {
+        if ( nConstr == 1 )
+            fprintf( stdout, "Warning: The last output is interpreted as a constraint.\n" );
+        else
+            fprintf( stdout, "Warning: The last %d outputs are interpreted as constraints.\n", nConstr );
+    }
+
+    // allocate the empty AIG
+    pNew = Gia_ManStart( nTotal + nLatches + nOutputs + 1 );
+    pNew->nConstrs = nConstr;
+    pNew->fGiaSimple = fGiaSimple;
+
+    // prepare the array of nodes
+    vNodes = Vec_IntAlloc( 1 + nTotal );
+    Vec_IntPush( vNodes, 0 );
+
+    // create the PIs
+    for ( i = 0; i < nInputs + nLatches; i++ )
+    {
+        iObj = Gia_ManAppendCi(pNew);    
+        Vec_IntPush( vNodes, iObj );
+    }
+
+    // remember the beginning of latch/PO literals
+    pDrivers = pCur;
+    if ( pContents[3] == ' ' ) // standard AIGER
+    {
+        // scroll to the beginning of the binary data
+        for ( i = 0; i < nLatches + nOutputs; )
+            if ( *pCur++ == '\n' )
+                i++;
+    }
+    else // modified AIGER
+    {
+        vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
+    }
+
+    // decode the AND gates in parallel if the file has the chunk index
+    pLitsPar = Gia_AigerReadIndexed( pContents, nFileSize, pCur, nInputs + nLatches, nAnds, &pSymbols );
+
+    // create the AND gates
+    if ( !fGiaSimple && !fSkipStrash )
+        Gia_ManHashAlloc( pNew );
+    for ( i = 0; i < nAnds; i++ )
+    {
+        if ( pLitsPar )
+        {
+            uLit1 = pLitsPar[2*i];
+            uLit0 = pLitsPar[2*i+1];
+        }
+        else
+        {
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
+//        assert( uLit1 > uLit0 );
+        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
+        if ( !fGiaSimple && fSkipStrash )
+        {
+            if ( iNode0 == iNode1 )
+                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
+            else
+                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+        }
+        else
+            Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+    }
+    if ( !fGiaSimple && !fSkipStrash )
+        Gia_ManHashStop( pNew );
+
+    // remember the place where symbols begin
+    if ( pLitsPar )
+        ABC_FREE( pLitsPar );
+    else
+        pSymbols = pCur;
+
+    // read the latch driver literals
+    vDrivers = Vec_IntAlloc( nLatches + nOutputs );
+    if ( pContents[3] == ' ' ) // standard AIGER
+    {
+        vInits = Vec_IntAlloc( nLatches );
+        pCur = pDrivers;
+        for ( i = 0; i < nLatches; i++ )
+        {
+            uLit0 = atoi( (char *)pCur );   
+            while ( *pCur != ' ' && *pCur != '\n' ) 
+                pCur++;
+            if ( *pCur == ' ' )
             {
                 pCur++;
-                pNew->vObjClasses = Vec_IntStart( Gia_AigerReadInt(pCur)/4 ); pCur += 4;
-                memcpy( Vec_IntArray(pNew->vObjClasses), pCur, (size_t)4*Vec_IntSize(pNew->vObjClasses) );
-                pCur += 4*Vec_IntSize(pNew->vObjClasses);
-                if ( fVerbose ) printf( "Finished reading extension \"v\".\n" );
+                Vec_IntPush( vInits, atoi( (char *)pCur ) );
+                while ( *pCur++ != '\n' );
             }
-            // read edge information
-            else if ( *pCur == 'w' )
+            else
             {
-                Vec_Int_t * vPairs;
-                int i, nPairs;
                 pCur++;
-                pCurTemp = pCur + Gia_AigerReadInt(pCur) + 4;           pCur += 4;
-                nPairs = Gia_AigerReadInt(pCur);                        pCur += 4;
-                vPairs = Vec_IntAlloc( 2*nPairs );
-                for ( i = 0; i < 2*nPairs; i++ )
-                    Vec_IntPush( vPairs, Gia_AigerReadInt(pCur) ),      pCur += 4;
-                assert( pCur == pCurTemp );
-                if ( fSkipStrash )
-                {
-                    Gia_ManEdgeFromArray( pNew, vPairs );
-                    if ( fVerbose ) printf( "Finished reading extension \"w\".\n" );
-                }
-                else
-                    printf( "Cannot read extension \"w\" because AIG is rehashed. Use \"&r -s <file.aig>\".\n" );
-                Vec_IntFree( vPairs );
+                Vec_IntPush( vInits, 0 );
             }
-            else break;
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            Vec_IntPush( vDrivers, iNode0 );
+        }
+        // read the PO driver literals
+        for ( i = 0; i < nOutputs; i++ )
+        {
+            uLit0 = atoi( (char *)pCur );   while ( *pCur++ != '\n' );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            Vec_IntPush( vDrivers, iNode0 );
+        }
+
+    }
+    else
+    {
+        // read the latch driver literals
+        for ( i = 0; i < nLatches; i++ )
+        {
+            uLit0 = Vec_IntEntry( vLits, i );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            Vec_IntPush( vDrivers, iNode0 );
+        }
+        // read the PO driver literals
+        for ( i = 0; i < nOutputs; i++ )
+        {
+            uLit0 = Vec_IntEntry( vLits, i+nLatches );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            Vec_IntPush( vDrivers, iNode0 );
         }
+        Vec_IntFree( vLits );
+    }
+
+    // create the POs
+    for ( i = 0; i < nOutputs; i++ )
+        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, nLatches + i) );
+    for ( i = 0; i < nLatches; i++ )
+        Gia_ManAppendCo( pNew, Vec_IntEntry(vDrivers, i) );
+    Vec_IntFree( vDrivers );
+
+    // create the latches
+    Gia_ManSetRegNum( pNew, nLatches );
+
+    // save the symbol table for later unless it defines constraints
+    if ( fLazy && (pCur = Gia_AigerSkipSymbols( pSymbols, (unsigned char *)pContents + nFileSize )) > pSymbols )
+    {
+        pNew->vAigerExtra = Vec_StrStart( pCur - pSymbols );
+        memcpy( Vec_StrArray(pNew->vAigerExtra), pSymbols, (size_t)Vec_StrSize(pNew->vAigerExtra) );
+        pSymbols = pCur;
     }
+    // read the symbol table and the extensions
+    fHieOnly = Gia_AigerReadTail( pNew, pContents, nFileSize, pSymbols, nInputs, nOutputs, nLatches, fSkipStrash, &vPoTypes );
 
     // skipping the comments
     Vec_IntFree( vNodes );
@@ -869,35 +1337,121 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, (size_t)nFileSize, fGiaSimple, fSkipStrash, fCheck, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the symbol table left by the lazy reader.]
+
+  Description [Does nothing if the AIG was read eagerly.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerReadExtra( Gia_Man_t * p )
+{
+    Vec_Int_t * vPoTypes = NULL;
+    Vec_Str_t * vExtra = p->vAigerExtra;
+    if ( vExtra == NULL )
+        return;
+    p->vAigerExtra = NULL;
+    Gia_AigerReadTail( p, Vec_StrArray(vExtra), Vec_StrSize(vExtra), (unsigned char *)Vec_StrArray(vExtra), 
+        Gia_ManPiNum(p), Gia_ManPoNum(p), Gia_ManRegNum(p), 1, &vPoTypes );
+    assert( vPoTypes == NULL );
+    Vec_StrFree( vExtra );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [Returns NULL if mapping is not supported or has failed. 
+  The pages are private to the process, so the reader can modify them.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMap( char * pFileName, size_t * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == -1 || Stat.st_size == 0 || (size_t)Stat.st_size != (word)Stat.st_size )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+    madvise( pContents, (size_t)Stat.st_size, MADV_WILLNEED );
+    *pnFileSize = (size_t)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_FileUnmap( char * pContents, size_t nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, nFileSize );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The file is memory-mapped when possible and decoded without
+  copying. In the lazy mode, the symbol table is saved unparsed and read
+  by Gia_AigerReadExtra() when the AIG is written. The extensions are 
+  always parsed, so the AIG attributes are available right away. The 
+  names defining constraints are parsed eagerly.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadLazy( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int fLazy )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
+    size_t nFileSize;
     int RetValue;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    pContents = Gia_FileMap( pFileName, &nFileSize );
+    if ( pContents )
+    {
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, fLazy );
+        Gia_FileUnmap( pContents, nFileSize );
+    }
+    else
+    {
+        // read the file into the buffer
+        nFileSize = (size_t)Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+        pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, fLazy );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -910,6 +1464,10 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     }
     return pNew;
 }
+Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadLazy( pFileName, fGiaSimple, fSkipStrash, fCheck, 0 );
+}
 
 
 
@@ -967,20 +1525,39 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p )
         Vec_StrPrintStr( vBuffer, "\n" );
     }
     // write the nodes into the buffer
-    Gia_ManForEachAnd( p, pObj, i )
+    if ( s_nAigerThreads > 1 )
+    {
+        Vec_Int_t * vAnds = Vec_IntAlloc( Gia_ManAndNum(p) );
+        Vec_Ptr_t * vChunks;
+        Vec_Str_t * vChunk;
+        Gia_ManForEachAnd( p, pObj, i )
+            Vec_IntPush( vAnds, i );
+        vChunks = Gia_AigerWriteChunks( p, vAnds, 1, GIA_AIGER_CHUNK, s_nAigerThreads );
+        Vec_PtrForEachEntry( Vec_Str_t *, vChunks, vChunk, i )
+        {
+            Vec_StrPushBuffer( vBuffer, Vec_StrArray(vChunk), Vec_StrSize(vChunk) );
+            Vec_StrFree( vChunk );
+        }
+        Vec_PtrFree( vChunks );
+        Vec_IntFree( vAnds );
+    }
+    else
     {
-        uLit  = Abc_Var2Lit( Gia_ObjValue(pObj), 0 );
-        uLit0 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
-        uLit1 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
-        assert( uLit0 != uLit1 );
-        if ( uLit0 > uLit1 )
+        Gia_ManForEachAnd( p, pObj, i )
         {
-            int Temp = uLit0;
-            uLit0 = uLit1;
-            uLit1 = Temp;
+            uLit  = Abc_Var2Lit( Gia_ObjValue(pObj), 0 );
+            uLit0 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin0(pObj)), Gia_ObjFaninC0(pObj) );
+            uLit1 = Abc_Var2Lit( Gia_ObjValue(Gia_ObjFanin1(pObj)), Gia_ObjFaninC1(pObj) );
+            assert( uLit0 != uLit1 );
+            if ( uLit0 > uLit1 )
+            {
+                int Temp = uLit0;
+                uLit0 = uLit1;
+                uLit1 = Temp;
+            }
+            Gia_AigerWriteUnsigned( vBuffer, uLit  - uLit1 );
+            Gia_AigerWriteUnsigned( vBuffer, uLit1 - uLit0 );
         }
-        Gia_AigerWriteUnsigned( vBuffer, uLit  - uLit1 );
-        Gia_AigerWriteUnsigned( vBuffer, uLit1 - uLit0 );
     }
     Vec_StrPrintStr( vBuffer, "c" );
     return vBuffer;
@@ -1090,6 +1667,8 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
+    Vec_Wrd_t * vIndex = NULL;
+    long PosIndex = 0;
     int i, nBufferSize, Pos;
     unsigned char * pBuffer;
     unsigned uLit0, uLit1, uLit;
@@ -1101,6 +1680,9 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         return;
     }
 
+    // parse the symbols and extensions deferred by the lazy reader
+    Gia_AigerReadExtra( pInit );
+
     // start the output stream
     pFile = fopen( pFileName, "wb" );
     if ( pFile == NULL )
@@ -1156,31 +1738,71 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     Gia_ManInvertConstraints( p );
 
     // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
-    {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+    // (the sequential buffer is indexed by int, so very large AIGs go through chunks)
+    if ( s_nAigerChunk > 0 || s_nAigerThreads > 1 || Gia_ManAndNum(p) >= (1 << 28) )
+    {
+        // encode the chunks in parallel and record their offsets
+        Vec_Int_t * vAnds = Vec_IntAlloc( Gia_ManAndNum(p) );
+        Vec_Ptr_t * vChunks;
+        Vec_Str_t * vChunk;
+        int nChunk = s_nAigerChunk > 0 ? s_nAigerChunk : GIA_AIGER_CHUNK;
+        long Start = ftell( pFile ), Offset = 0;
+        Gia_ManForEachAnd( p, pObj, i )
+            Vec_IntPush( vAnds, i );
+        vChunks = Gia_AigerWriteChunks( p, vAnds, 0, nChunk, s_nAigerThreads );
+        if ( s_nAigerChunk > 0 && Gia_ManAndNum(p) > 0 )
+        {
+            if ( Start < 0 )
+                printf( "Gia_AigerWrite(): Cannot get the position in file \"%s\". The chunk index is not written.\n", pFileName );
+            else
+            {
+                vIndex = Vec_WrdAlloc( Vec_PtrSize(vChunks) + 4 );
+                Vec_WrdPush( vIndex, nChunk );
+                Vec_WrdPush( vIndex, Vec_PtrSize(vChunks) );
+                Vec_WrdPush( vIndex, Start );
+            }
+        }
+        Vec_PtrForEachEntry( Vec_Str_t *, vChunks, vChunk, i )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            if ( vIndex )
+                Vec_WrdPush( vIndex, Offset );
+            fwrite( Vec_StrArray(vChunk), 1, Vec_StrSize(vChunk), pFile );
+            Offset += Vec_StrSize(vChunk);
+            Vec_StrFree( vChunk );
         }
+        if ( vIndex )
+            Vec_WrdPush( vIndex, Offset );
+        Vec_PtrFree( vChunks );
+        Vec_IntFree( vAnds );
     }
-    assert( Pos < nBufferSize );
+    else
+    {
+        Pos = 0;
+        nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+        pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+            if ( Pos > nBufferSize - 10 )
+            {
+                printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+                fclose( pFile );
+                if ( p != pInit )
+                    Gia_ManStop( p );
+                return;
+            }
+        }
+        assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+        // write the buffer
+        fwrite( pBuffer, 1, Pos, pFile );
+        ABC_FREE( pBuffer );
+    }
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1412,11 +2034,29 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fwrite( p->pName, 1, strlen(p->pName), pFile );
         fprintf( pFile, "%c", '\0' );
     }
+    // write the chunk index of the AND section
+    if ( vIndex && (PosIndex = ftell( pFile )) <= 0 )
+    {
+        printf( "Gia_AigerWrite(): Cannot get the position in file \"%s\". The chunk index is not written.\n", pFileName );
+        Vec_WrdFreeP( &vIndex );
+        PosIndex = 0;
+    }
+    if ( vIndex )
+    {
+        word Entry;
+        fprintf( pFile, "x" );
+        Gia_FileWriteBufferSize( pFile, 8*Vec_WrdSize(vIndex) );
+        Vec_WrdForEachEntry( vIndex, Entry, i )
+            Gia_FileWriteBufferWord( pFile, Entry );
+        Vec_WrdFree( vIndex );
+    }
     // write comments
     if ( fWriteNewLine )
         fprintf( pFile, "c\n" );
     fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
     fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    if ( PosIndex )
+        fprintf( pFile, "%s%020ld\n", GIA_AIGER_INDEX, PosIndex );
     fclose( pFile );
     if ( p != pInit )
     {
@@ -23,6 +23,15 @@
 #include "misc/vec/vecQue.h"
 #include "opt/dau/dau.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -51,6 +60,23 @@ struct Dam_Man_t_
     int              nAnds;     // total AND node count
     int              nGain;     // total gain in AND nodes
     int              nGainX;    // gain from XOR nodes
+    int              nThreads;  // the number of threads to collect supergates
+};
+
+#define GIA_BAL_THR_MAX   64   // the largest number of threads
+#define GIA_BAL_PAR_MIN  256   // the smallest number of roots per thread
+
+// supergate collection data of one thread
+typedef struct Gia_BalThData_t_ Gia_BalThData_t;
+struct Gia_BalThData_t_
+{
+    Gia_Man_t *      p;         // user's AIG
+    Vec_Int_t *      vFront;    // the roots of this wave
+    Vec_Int_t *      vSuper;    // the current supergate
+    Vec_Int_t *      vBuffer;   // the supergates of this thread
+    int              iStart;    // the first root
+    int              iStop;     // the last root
+    int              fStrict;   // strict area control
 };
 
 static inline int    Dam_ObjHand( Dam_Man_t * p, int i )     { return i < Vec_IntSize(p->vNod2Set) ? Vec_IntEntry(p->vNod2Set, i) : 0;                      }
@@ -125,69 +151,245 @@ void Gia_ManSimplifyAnd( Vec_Int_t * vSuper )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManSuperCollectXor_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManSuperCollectXor_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
 {
     assert( !Gia_IsComplement(pObj) );
     if ( !Gia_ObjIsXor(pObj) ||     
         (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
         Gia_ObjRefNum(p, pObj) > 2 || 
         (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
-        Vec_IntSize(p->vSuper) > 50 )
+        Vec_IntSize(vSuper) > 50 )
     {
-        Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
+        Vec_IntPush( vSuper, Gia_ObjToLit(p, pObj) );
         return;
     }
     assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
-    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict );
-    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict );
+    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict, vSuper );
+    Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict, vSuper );
 }
-void Gia_ManSuperCollectAnd_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManSuperCollectAnd_rec( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
 {
     if ( Gia_IsComplement(pObj) || 
         !Gia_ObjIsAndReal(p, pObj) || 
         (fStrict && Gia_ObjRefNum(p, pObj) > 1) || 
         Gia_ObjRefNum(p, pObj) > 2 || 
         (Gia_ObjRefNum(p, pObj) == 2 && (Gia_ObjRefNum(p, Gia_ObjFanin0(pObj)) == 1 || Gia_ObjRefNum(p, Gia_ObjFanin1(pObj)) == 1)) || 
-        Vec_IntSize(p->vSuper) > 50 )
+        Vec_IntSize(vSuper) > 50 )
     {
-        Vec_IntPush( p->vSuper, Gia_ObjToLit(p, pObj) );
+        Vec_IntPush( vSuper, Gia_ObjToLit(p, pObj) );
         return;
     }
-    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict );
-    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict );
+    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict, vSuper );
+    Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict, vSuper );
 }
-void Gia_ManSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManSuperCollectInt( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vSuper )
 {
 //    int nSize;
-    if ( p->vSuper == NULL )
-        p->vSuper = Vec_IntAlloc( 1000 );
-    else
-        Vec_IntClear( p->vSuper );
+    Vec_IntClear( vSuper );
     if ( Gia_ObjIsXor(pObj) )
     {
         assert( !Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) );
-        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict );
-        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict );
+        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin0(pObj), fStrict, vSuper );
+        Gia_ManSuperCollectXor_rec( p, Gia_ObjFanin1(pObj), fStrict, vSuper );
 //        nSize = Vec_IntSize(vSuper);
-        Vec_IntSort( p->vSuper, 0 );
-        Gia_ManSimplifyXor( p->vSuper );
+        Vec_IntSort( vSuper, 0 );
+        Gia_ManSimplifyXor( vSuper );
 //        if ( nSize != Vec_IntSize(vSuper) )
 //            printf( "X %d->%d  ", nSize, Vec_IntSize(vSuper) );
     }
     else if ( Gia_ObjIsAndReal(p, pObj) )
     {
-        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict );
-        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict );
+        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild0(pObj), fStrict, vSuper );
+        Gia_ManSuperCollectAnd_rec( p, Gia_ObjChild1(pObj), fStrict, vSuper );
 //        nSize = Vec_IntSize(vSuper);
-        Vec_IntSort( p->vSuper, 0 );
-        Gia_ManSimplifyAnd( p->vSuper );
+        Vec_IntSort( vSuper, 0 );
+        Gia_ManSimplifyAnd( vSuper );
 //        if ( nSize != Vec_IntSize(vSuper) )
 //            printf( "A %d->%d  ", nSize, Vec_IntSize(vSuper) );
     }
     else assert( 0 );
 //    if ( nSize > 10 )
 //        printf( "%d ", nSize );
-    assert( Vec_IntSize(p->vSuper) > 0 );
+    assert( Vec_IntSize(vSuper) > 0 );
+}
+void Gia_ManSuperCollect( Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+{
+    if ( p->vSuper == NULL )
+        p->vSuper = Vec_IntAlloc( 1000 );
+    Gia_ManSuperCollectInt( p, pObj, fStrict, p->vSuper );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects supergates of one wave of roots.]
+
+  Description [Each thread records the supergates of its range of roots 
+  in its own buffer as the size followed by the literals.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManBalanceCollectRange( Gia_BalThData_t * pData )
+{
+    int i, Id;
+    Vec_IntClear( pData->vBuffer );
+    for ( i = pData->iStart; i < pData->iStop; i++ )
+    {
+        Id = Vec_IntEntry( pData->vFront, i );
+        Gia_ManSuperCollectInt( pData->p, Gia_ManObj(pData->p, Id), pData->fStrict, pData->vSuper );
+        Vec_IntPush( pData->vBuffer, Vec_IntSize(pData->vSuper) );
+        Vec_IntAppend( pData->vBuffer, pData->vSuper );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+static void * Gia_ManBalanceCollectThread( void * pArg )
+{
+    Gia_ManBalanceCollectRange( (Gia_BalThData_t *)pArg );
+    return NULL;
+}
+#endif
+static void Gia_ManBalanceCollectWave( Gia_BalThData_t * pThData, int nThreads, Vec_Int_t * vFront, Vec_Int_t * vNod2Set, Vec_Int_t * vSetStore )
+{
+    int i, k, Id, * pSet, nWorkers = Abc_MinInt( nThreads, Vec_IntSize(vFront) / GIA_BAL_PAR_MIN );
+    if ( nWorkers < 1 )
+        nWorkers = 1;
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        pThData[i].vFront = vFront;
+        pThData[i].iStart = i * Vec_IntSize(vFront) / nWorkers;
+        pThData[i].iStop  = (i + 1) * Vec_IntSize(vFront) / nWorkers;
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nWorkers > 1 )
+    {
+        pthread_t WorkerThread[GIA_BAL_THR_MAX];
+        int status;
+        for ( i = 1; i < nWorkers; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Gia_ManBalanceCollectThread, (void *)(pThData + i) );  assert( status == 0 );
+        }
+        Gia_ManBalanceCollectRange( pThData );
+        for ( i = 1; i < nWorkers; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+    }
+    else
+#endif
+    for ( i = 0; i < nWorkers; i++ )
+        Gia_ManBalanceCollectRange( pThData + i );
+    // merge the buffers in the order of roots
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        pSet = Vec_IntArray( pThData[i].vBuffer );
+        Vec_IntForEachEntryStartStop( vFront, Id, k, pThData[i].iStart, pThData[i].iStop )
+        {
+            Vec_IntWriteEntry( vNod2Set, Id, Vec_IntSize(vSetStore) );
+            Vec_IntPushArray( vSetStore, pSet, pSet[0] + 1 );
+            pSet += pSet[0] + 1;
+        }
+        assert( pSet == Vec_IntLimit(pThData[i].vBuffer) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds supergate roots reachable through buffers and MUXes.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManBalanceAddRoot_rec( Gia_Man_t * p, int Id, char * pVisited, Vec_Int_t * vFront )
+{
+    Gia_Obj_t * pObj;
+    if ( pVisited[Id] )
+        return 0;
+    pVisited[Id] = 1;
+    pObj = Gia_ManObj( p, Id );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return 0;
+    if ( Gia_ObjIsBuf(pObj) )
+        return Gia_ManBalanceAddRoot_rec( p, Gia_ObjFaninId0(pObj, Id), pVisited, vFront );
+    if ( Gia_ObjIsMux(p, pObj) )
+        return 1 + Gia_ManBalanceAddRoot_rec( p, Gia_ObjFaninId0(pObj, Id), pVisited, vFront )
+                 + Gia_ManBalanceAddRoot_rec( p, Gia_ObjFaninId1(pObj, Id), pVisited, vFront )
+                 + Gia_ManBalanceAddRoot_rec( p, Gia_ObjFaninId2(p, Id), pVisited, vFront );
+    Vec_IntPush( vFront, Id );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects supergates of all roots using several threads.]
+
+  Description [Supergates are collected in waves. The first wave is made
+  of the given roots; the next one contains the supergate leaves that are 
+  not yet visited. Supergates of one wave do not depend on each other and
+  are collected concurrently. The result is stored in the format used by
+  Dam_Man_t (the node-to-set map and the set storage) and does not depend
+  on the number of threads. Returns the number of visited MUXes.]
+               
+  SideEffects [Expects the reference counters to be computed.]
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManBalanceCollectSupers( Gia_Man_t * p, Vec_Int_t * vRoots, int fStrict, int nThreads, Vec_Int_t ** pvNod2Set, Vec_Int_t ** pvSetStore )
+{
+    Gia_BalThData_t ThData[GIA_BAL_THR_MAX];
+    Vec_Int_t * vNod2Set, * vSetStore, * vFront, * vNext;
+    char * pVisited;
+    int i, k, Id, iLit, * pSet, nMuxes = 0;
+    assert( p->pRefs != NULL );
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, GIA_BAL_THR_MAX) );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Gia_BalThData_t) );
+        ThData[i].p       = p;
+        ThData[i].fStrict = fStrict;
+        ThData[i].vSuper  = Vec_IntAlloc( 100 );
+        ThData[i].vBuffer = Vec_IntAlloc( 1000 );
+    }
+    vNod2Set  = Vec_IntStart( Gia_ManObjNum(p) );
+    vSetStore = Vec_IntAlloc( Gia_ManObjNum(p) );
+    Vec_IntPush( vSetStore, -1 );
+    pVisited  = ABC_CALLOC( char, Gia_ManObjNum(p) );
+    vFront    = Vec_IntAlloc( 1000 );
+    vNext     = Vec_IntAlloc( 1000 );
+    Vec_IntForEachEntry( vRoots, Id, i )
+        nMuxes += Gia_ManBalanceAddRoot_rec( p, Id, pVisited, vFront );
+    while ( Vec_IntSize(vFront) > 0 )
+    {
+        Gia_ManBalanceCollectWave( ThData, nThreads, vFront, vNod2Set, vSetStore );
+        Vec_IntClear( vNext );
+        Vec_IntForEachEntry( vFront, Id, i )
+        {
+            pSet = Vec_IntEntryP( vSetStore, Vec_IntEntry(vNod2Set, Id) );
+            for ( k = 1; k <= pSet[0]; k++ )
+            {
+                iLit = pSet[k];
+                nMuxes += Gia_ManBalanceAddRoot_rec( p, Abc_Lit2Var(iLit), pVisited, vNext );
+            }
+        }
+        ABC_SWAP( Vec_Int_t *, vFront, vNext );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Vec_IntFree( ThData[i].vSuper );
+        Vec_IntFree( ThData[i].vBuffer );
+    }
+    Vec_IntFree( vFront );
+    Vec_IntFree( vNext );
+    ABC_FREE( pVisited );
+    *pvNod2Set  = vNod2Set;
+    *pvSetStore = vSetStore;
+    return nMuxes;
 }
 
 /**Function*************************************************************
@@ -338,7 +540,7 @@ int Gia_ManBalanceGate( Gia_Man_t * pNew, Gia_Obj_t * pObj, Vec_Int_t * vSuper,
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict )
+void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int fStrict, Vec_Int_t * vNod2Set, Vec_Int_t * vSetStore )
 {
     int i, iLit, iBeg, iEnd;
     if ( ~pObj->Value )
@@ -348,26 +550,34 @@ void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int
     // handle MUX
     if ( Gia_ObjIsMux(p, pObj) )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin1(pObj), fStrict );
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin2(p, pObj), fStrict );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict, vNod2Set, vSetStore );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin1(pObj), fStrict, vNod2Set, vSetStore );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin2(p, pObj), fStrict, vNod2Set, vSetStore );
         pObj->Value = Gia_ManHashMuxReal( pNew, Gia_ObjFanin2Copy(p, pObj), Gia_ObjFanin1Copy(pObj), Gia_ObjFanin0Copy(pObj) );
         Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
         return;
     }
     // find supergate
-    Gia_ManSuperCollect( p, pObj, fStrict );
+    if ( vNod2Set == NULL )
+        Gia_ManSuperCollect( p, pObj, fStrict );
     // save entries
     if ( p->vStore == NULL )
         p->vStore = Vec_IntAlloc( 1000 );
     iBeg = Vec_IntSize( p->vStore );
-    Vec_IntAppend( p->vStore, p->vSuper );
+    if ( vNod2Set == NULL )
+        Vec_IntAppend( p->vStore, p->vSuper );
+    else
+    {
+        int * pSet = Vec_IntEntryP( vSetStore, Vec_IntEntry(vNod2Set, Gia_ObjId(p, pObj)) );
+        assert( Vec_IntEntry(vNod2Set, Gia_ObjId(p, pObj)) > 0 );
+        Vec_IntPushArray( p->vStore, pSet + 1, pSet[0] );
+    }
     iEnd = Vec_IntSize( p->vStore );
     // call recursively
     Vec_IntForEachEntryStartStop( p->vStore, iLit, i, iBeg, iEnd )
     {
         Gia_Obj_t * pTemp = Gia_ManObj( p, Abc_Lit2Var(iLit) );
-        Gia_ManBalance_rec( pNew, p, pTemp, fStrict );
+        Gia_ManBalance_rec( pNew, p, pTemp, fStrict, vNod2Set, vSetStore );
         Vec_IntWriteEntry( p->vStore, i, Abc_LitNotCond(pTemp->Value, Abc_LitIsCompl(iLit)) );
     }
     assert( Vec_IntSize(p->vStore) == iEnd );
@@ -375,13 +585,27 @@ void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int
     pObj->Value = Gia_ManBalanceGate( pNew, pObj, p->vSuper, Vec_IntEntryP(p->vStore, iBeg), iEnd-iBeg );
     Vec_IntShrink( p->vStore, iBeg );
 }
-Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
+Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
     Gia_Obj_t * pObj;
+    Vec_Int_t * vNod2Set = NULL, * vSetStore = NULL;
     int i;
     Gia_ManFillValue( p );
     Gia_ManCreateRefs( p ); 
+    // collect supergates in parallel
+    if ( nThreads > 1 )
+    {
+        Vec_Int_t * vRoots = Vec_IntAlloc( Gia_ManBufNum(p) + Gia_ManCoNum(p) );
+        Gia_ManForEachBuf( p, pObj, i )
+            Vec_IntPush( vRoots, Gia_ObjFaninId0(pObj, i) );
+        Gia_ManForEachCo( p, pObj, i )
+            Vec_IntPush( vRoots, Gia_ObjFaninId0p(p, pObj) );
+        Gia_ManBalanceCollectSupers( p, vRoots, fStrict, nThreads, &vNod2Set, &vSetStore );
+        Vec_IntFree( vRoots );
+        if ( p->vSuper == NULL )
+            p->vSuper = Vec_IntAlloc( 1000 );
+    }
     // start the new manager
     pNew = Gia_ManStart( Gia_ManObjNum(p) );
     pNew->pName = Abc_UtilStrsav( p->pName );
@@ -409,16 +633,18 @@ Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
     Gia_ManHashStart( pNew );
     Gia_ManForEachBuf( p, pObj, i )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict, vNod2Set, vSetStore );
         pObj->Value = Gia_ManAppendBuf( pNew, Gia_ObjFanin0Copy(pObj) );
         Gia_ObjSetGateLevel( pNew, Gia_ManObj(pNew, Abc_Lit2Var(pObj->Value)) );
     }
     Gia_ManForEachCo( p, pObj, i )
     {
-        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict );
+        Gia_ManBalance_rec( pNew, p, Gia_ObjFanin0(pObj), fStrict, vNod2Set, vSetStore );
         pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
     }
     assert( !fStrict || Gia_ManObjNum(pNew) <= Gia_ManObjNum(p) );
+    Vec_IntFreeP( &vNod2Set );
+    Vec_IntFreeP( &vSetStore );
     Gia_ManHashStop( pNew );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
     // perform cleanup
@@ -431,21 +657,21 @@ Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
 
   Synopsis    []
 
-  Description []
+  Description [The supergates are collected using nThreads threads.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose )
+Gia_Man_t * Gia_ManBalancePar( Gia_Man_t * p, int fSimpleAnd, int fStrict, int nThreads, int fVerbose )
 {
     Gia_Man_t * pNew, * pNew1, * pNew2;
     if ( fVerbose )      Gia_ManPrintStats( p, NULL );
     pNew = fSimpleAnd ? Gia_ManDup( p ) : Gia_ManDupMuxes( p, 2 );
     Gia_ManTransferTiming( pNew, p );
     if ( fVerbose )      Gia_ManPrintStats( pNew, NULL );
-    pNew1 = Gia_ManBalanceInt( pNew, fStrict );
+    pNew1 = Gia_ManBalanceInt( pNew, fStrict, nThreads );
     Gia_ManTransferTiming( pNew1, pNew );
     if ( fVerbose )      Gia_ManPrintStats( pNew1, NULL );
     Gia_ManStop( pNew );
@@ -455,6 +681,10 @@ Gia_Man_t * Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVer
     Gia_ManStop( pNew1 );
     return pNew2;
 }
+Gia_Man_t * Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVerbose )
+{
+    return Gia_ManBalancePar( p, fSimpleAnd, fStrict, 1, fVerbose );
+}
 
 
 
@@ -471,13 +701,14 @@ Gia_Man_t * Gia_ManBalance( Gia_Man_t * p, int fSimpleAnd, int fStrict, int fVer
   SeeAlso     []
 
 ***********************************************************************/
-Dam_Man_t * Dam_ManAlloc( Gia_Man_t * pGia )
+Dam_Man_t * Dam_ManAlloc( Gia_Man_t * pGia, int nThreads )
 {
     Dam_Man_t * p;
     p = ABC_CALLOC( Dam_Man_t, 1 );
     p->clkStart = Abc_Clock();
     p->vVisit = Vec_IntAlloc( 1000 );
     p->pGia = pGia;
+    p->nThreads = nThreads;
     return p;
 }
 void Dam_ManFree( Dam_Man_t * p )
@@ -549,6 +780,22 @@ void Dam_ManCollectSets( Dam_Man_t * p )
     Gia_Obj_t * pObj;
     int i;
     Gia_ManCreateRefs( p->pGia );
+    if ( p->nThreads > 1 )
+    {
+        Vec_Int_t * vRoots = Vec_IntAlloc( Gia_ManCoNum(p->pGia) );
+        int * pSet;
+        Gia_ManForEachCo( p->pGia, pObj, i )
+            Vec_IntPush( vRoots, Gia_ObjFaninId0p(p->pGia, pObj) );
+        p->nAnds = 3 * Gia_ManBalanceCollectSupers( p->pGia, vRoots, 0, p->nThreads, &p->vNod2Set, &p->vSetStore );
+        Vec_IntFree( vRoots );
+        Gia_ManForEachAnd( p->pGia, pObj, i )
+            if ( (pSet = Dam_ObjSet(p, i)) )
+                p->nAnds += (1 + 2 * Gia_ObjIsXor(pObj)) * (pSet[0] - 1);
+        if ( p->pGia->vSuper == NULL )
+            p->pGia->vSuper = Vec_IntAlloc( 1000 );
+        ABC_FREE( p->pGia->pRefs );
+        return;
+    }
     p->vNod2Set  = Vec_IntStart( Gia_ManObjNum(p->pGia) );
     p->vSetStore = Vec_IntAlloc( Gia_ManObjNum(p->pGia) );
     Vec_IntPush( p->vSetStore, -1 );
@@ -1010,12 +1257,12 @@ void Dam_ManUpdate( Dam_Man_t * p, int iDiv )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Dam_ManAreaBalanceInt( Gia_Man_t * pGia, Vec_Int_t * vCiLevels, int nNewNodesMax, int fVerbose, int fVeryVerbose )
+Gia_Man_t * Dam_ManAreaBalanceInt( Gia_Man_t * pGia, Vec_Int_t * vCiLevels, int nNewNodesMax, int nThreads, int fVerbose, int fVeryVerbose )
 {
     Gia_Man_t * pNew;
     Dam_Man_t * p;
     int i, iDiv;
-    p = Dam_ManAlloc( pGia );
+    p = Dam_ManAlloc( pGia, nThreads );
     p->nLevelMax = Gia_ManSetLevels( p->pGia, vCiLevels );
     p->vNodLevR = Gia_ManReverseLevel( p->pGia );
     Vec_IntFillExtra( p->pGia->vLevels, 3*Gia_ManObjNum(p->pGia)/2, 0 );
@@ -1044,7 +1291,7 @@ Gia_Man_t * Dam_ManAreaBalanceInt( Gia_Man_t * pGia, Vec_Int_t * vCiLevels, int
     Dam_ManFree( p );
     return pNew;
 }
-Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose )
+Gia_Man_t * Gia_ManAreaBalancePar( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int nThreads, int fVerbose, int fVeryVerbose )
 {
     Gia_Man_t * pNew0, * pNew, * pNew1, * pNew2;
     Vec_Int_t * vCiLevels;
@@ -1077,7 +1324,7 @@ Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax,
     if ( fVerbose )     Gia_ManPrintStats( pNew, NULL );
     if ( pNew0 != p ) Gia_ManStop( pNew0 );
     // perform the operation
-    pNew1 = Dam_ManAreaBalanceInt( pNew, vCiLevels, nNewNodesMax, fVerbose, fVeryVerbose );
+    pNew1 = Dam_ManAreaBalanceInt( pNew, vCiLevels, nNewNodesMax, nThreads, fVerbose, fVeryVerbose );
     Gia_ManTransferTiming( pNew1, pNew );
     if ( fVerbose )     Gia_ManPrintStats( pNew1, NULL );
     Gia_ManStop( pNew );
@@ -1097,6 +1344,10 @@ Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax,
     //Gia_ManTransferTiming( pNew2, p );
     return pNew2;
 }
+Gia_Man_t * Gia_ManAreaBalance( Gia_Man_t * p, int fSimpleAnd, int nNewNodesMax, int fVerbose, int fVeryVerbose )
+{
+    return Gia_ManAreaBalancePar( p, fSimpleAnd, nNewNodesMax, 1, fVerbose, fVeryVerbose );
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -0,0 +1,489 @@
+/**CFile****************************************************************
+
+  FileName    [giaConc.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent AIG construction.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaConc.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// In the concurrent mode, several threads add AND nodes to the same manager.
+// The object array is allocated upfront. Each thread reserves blocks of object
+// IDs by atomically incrementing the shared counter and fills them in order.
+// When a fanin of the new node has a larger ID than the next free slot of the
+// thread (the fanin was created by another thread), the node gets a single ID
+// from the shared counter, which is larger than the IDs of all existing nodes.
+// This guarantees that the fanins of each node have smaller IDs.
+// The unused slots of the last block of each thread remain zero (a zero 
+// object is never a valid AND node) and are removed when the concurrent 
+// mode is stopped.
+//
+// The structural hash table uses open addressing with two words per slot:
+// the packed fanin literals and the node ID. A thread claims an empty slot
+// by compare-and-swap on the key, creates the node, and publishes its ID.
+// Threads looking up the same key wait until the ID is published.
+// If the reserved object storage is exhausted, the construction fails:
+// Gia_ManConcAnd() returns -1 in all threads from then on.
+
+#define GIA_CONC_BLOCK  1024      // the number of objects reserved at a time
+#define GIA_CONC_THR_MAX 100      // the largest number of threads
+
+typedef struct Gia_ConThr_t_ Gia_ConThr_t;
+struct Gia_ConThr_t_
+{
+    int             iNext;        // the next free object in the block
+    int             iStop;        // the first object after the block
+    int             nNodes;       // the number of nodes created
+    int             nBlocks;      // the number of blocks reserved
+    int             nSingles;     // the number of single objects reserved
+    int             Pad[11];      // padding to avoid false sharing
+};
+
+struct Gia_Con_t_
+{
+    Gia_Man_t *     pGia;         // the manager
+    int             nObjsStart;   // the number of objects before the concurrent mode
+    int             fHashing;     // the manager was hashing before the concurrent mode
+    int             nThreads;     // the number of threads
+    volatile int    nObjsNext;    // the first unreserved object
+    volatile int    fFailed;      // the object storage is exhausted
+    int             Mask;         // the mask of the hash table
+    word *          pTable;       // the hash table (key, ID)
+    Gia_ConThr_t    pThrs[GIA_CONC_THR_MAX]; // per-thread data
+};
+
+#ifdef ABC_USE_PTHREADS
+
+static inline int  Gia_ConAtomicAdd( volatile int * p, int Add )          { return __sync_fetch_and_add( p, Add );                      }
+static inline int  Gia_ConAtomicCas( volatile word * p, word Old, word New ) { return __sync_bool_compare_and_swap( p, Old, New );    }
+static inline word Gia_ConAtomicLoad( volatile word * p )                 { word Res = *p; __sync_synchronize(); return Res;             }
+static inline void Gia_ConAtomicStore( volatile word * p, word Value )    { __sync_synchronize(); *p = Value;                            }
+
+#else
+
+static inline int  Gia_ConAtomicAdd( volatile int * p, int Add )          { int Res = *p; *p += Add; return Res;                         }
+static inline int  Gia_ConAtomicCas( volatile word * p, word Old, word New ) { if ( *p != Old ) return 0; *p = New; return 1;         }
+static inline word Gia_ConAtomicLoad( volatile word * p )                 { return *p;                                                   }
+static inline void Gia_ConAtomicStore( volatile word * p, word Value )    { *p = Value;                                                  }
+
+#endif
+
+static inline word Gia_ConKey( int iLit0, int iLit1 )                     { return ((word)(unsigned)iLit0 << 32) | (word)(unsigned)iLit1; }
+static inline int  Gia_ConHash( word Key, int Mask )                      { return (int)((Key * ABC_CONST(0x9E3779B97F4A7C15)) >> 32) & Mask; }
+static inline int  Gia_ConObjIsHole( Gia_Obj_t * pObj )                   { return !pObj->fTerm && pObj->iDiff0 == 0;                    }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reserves the object ID for the new node.]
+
+  Description [The ID is larger than the IDs of both fanins. Returns -1
+  if the object storage is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManConcReserve( Gia_Con_t * p, Gia_ConThr_t * pThr, int iFanMax )
+{
+    int iObj;
+    if ( pThr->iNext < pThr->iStop && pThr->iNext > iFanMax )
+        return pThr->iNext++;
+    if ( pThr->iNext < pThr->iStop )
+    {
+        iObj = Gia_ConAtomicAdd( &p->nObjsNext, 1 );
+        pThr->nSingles++;
+    }
+    else
+    {
+        iObj = Gia_ConAtomicAdd( &p->nObjsNext, GIA_CONC_BLOCK );
+        pThr->iNext = iObj + 1;
+        pThr->iStop = Abc_MinInt( iObj + GIA_CONC_BLOCK, p->pGia->nObjsAlloc );
+        pThr->nBlocks++;
+    }
+    if ( iObj >= p->pGia->nObjsAlloc )
+    {
+        p->fFailed = 1;
+        return -1;
+    }
+    assert( iObj > iFanMax );
+    return iObj;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the concurrent mode.]
+
+  Description [The manager should contain the CIs and, possibly, some
+  AND nodes. The object array is resized to have room for nObjsMax objects.
+  After calling this function and before calling Gia_ManConcStop(),
+  the manager can only be modified by Gia_ManConcAnd().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Con_t * Gia_ManConcStart( Gia_Man_t * pGia, int nObjsMax, int nThreads )
+{
+    Gia_Con_t * p;
+    Gia_Obj_t * pObj;
+    int i, k, nSlots;
+    assert( nThreads > 0 && nThreads <= GIA_CONC_THR_MAX );
+    assert( pGia->pMuxes == NULL && pGia->pFanData == NULL );
+    assert( !pGia->fSweeper && !pGia->fBuiltInSim && pGia->vSuppWords == NULL );
+    p = ABC_CALLOC( Gia_Con_t, 1 );
+    p->pGia       = pGia;
+    p->nThreads   = nThreads;
+    p->nObjsStart = Gia_ManObjNum(pGia);
+    p->fHashing   = Vec_IntSize(&pGia->vHTable) > 0;
+    if ( p->fHashing )
+        Gia_ManHashStop( pGia );
+    // make sure the objects are allocated and zeroed
+    nObjsMax = Abc_MinInt( Abc_MaxInt(nObjsMax, p->nObjsStart) + 2 * nThreads * GIA_CONC_BLOCK, GIA_OBJ_MAX );
+    if ( pGia->nObjsAlloc < nObjsMax )
+    {
+        pGia->pObjs = ABC_REALLOC( Gia_Obj_t, pGia->pObjs, nObjsMax );
+        pGia->nObjsAlloc = nObjsMax;
+    }
+    memset( pGia->pObjs + pGia->nObjs, 0, sizeof(Gia_Obj_t) * (pGia->nObjsAlloc - pGia->nObjs) );
+    p->nObjsNext = pGia->nObjs;
+    // start the hash table
+    nSlots = 1 << Abc_Base2Log( 2 * pGia->nObjsAlloc );
+    p->Mask = nSlots - 1;
+    p->pTable = ABC_CALLOC( word, 2 * nSlots );
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        word Key = Gia_ConKey( Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i) );
+        for ( k = Gia_ConHash(Key, p->Mask); p->pTable[2*k] && p->pTable[2*k] != Key; k = (k + 1) & p->Mask );
+        if ( p->pTable[2*k] == 0 )
+            p->pTable[2*k] = Key, p->pTable[2*k+1] = i;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds AND node in the concurrent mode.]
+
+  Description [Can be called by several threads at the same time,
+  as long as each thread uses its own thread number (0 <= iThread < nThreads).
+  Returns the canonical literal of the node, or -1 if the object storage
+  reserved by Gia_ManConcStart() is exhausted. The literals are valid
+  until Gia_ManConcStop() is called, which renumbers the objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManConcAnd( Gia_Con_t * p, int iThread, int iLit0, int iLit1 )
+{
+    Gia_ConThr_t * pThr = p->pThrs + iThread;
+    volatile word * pSlot;
+    word Key, Entry;
+    int k, iObj;
+    assert( iThread >= 0 && iThread < p->nThreads );
+    if ( p->fFailed )
+        return -1;
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = Gia_ConKey( iLit0, iLit1 );
+    for ( k = Gia_ConHash(Key, p->Mask); ; k = (k + 1) & p->Mask )
+    {
+        pSlot = p->pTable + 2 * k;
+        Entry = Gia_ConAtomicLoad( pSlot );
+        if ( Entry == 0 && Gia_ConAtomicCas( pSlot, 0, Key ) )
+        {
+            // this thread owns the slot
+            Gia_Obj_t * pObj;
+            iObj = Gia_ManConcReserve( p, pThr, Abc_Lit2Var(iLit1) );
+            if ( iObj == -1 )
+                return -1;
+            pObj = p->pGia->pObjs + iObj;
+            assert( Gia_ConObjIsHole(pObj) );
+            pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(iLit0));
+            pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+            pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(iLit1));
+            pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+            pThr->nNodes++;
+            Gia_ConAtomicStore( pSlot + 1, (word)iObj );
+            return Abc_Var2Lit( iObj, 0 );
+        }
+        Entry = Gia_ConAtomicLoad( pSlot );
+        if ( Entry != Key )
+            continue;
+        // wait until the owner publishes the node
+        while ( (iObj = (int)Gia_ConAtomicLoad(pSlot + 1)) == 0 )
+            if ( p->fFailed )
+                return -1;
+        return Abc_Var2Lit( iObj, 0 );
+    }
+    assert( 0 );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the concurrent mode.]
+
+  Description [Removes the unused object slots and renumbers the objects
+  in place. Returns the mapping of old object IDs into new literals,
+  which should be used to translate the literals returned by
+  Gia_ManConcAnd(). If the manager was hashing before the concurrent mode,
+  the hash table is restarted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManConcStop( Gia_Con_t * p, int fVerbose )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Int_t * vMap;
+    Gia_Obj_t * pObj, * pObjNew;
+    int i, iNew, iLit0, iLit1, nObjs = Abc_MinInt( p->nObjsNext, pGia->nObjsAlloc );
+    int nNodes = 0, nBlocks = 0, nSingles = 0;
+    vMap = Vec_IntStartFull( nObjs );
+    for ( i = 0; i < p->nObjsStart; i++ )
+        Vec_IntWriteEntry( vMap, i, Abc_Var2Lit(i, 0) );
+    for ( iNew = i = p->nObjsStart; i < nObjs; i++ )
+    {
+        pObj = pGia->pObjs + i;
+        if ( Gia_ConObjIsHole(pObj) )
+            continue;
+        iLit0 = Abc_LitNotCond( Vec_IntEntry(vMap, i - pObj->iDiff0), pObj->fCompl0 );
+        iLit1 = Abc_LitNotCond( Vec_IntEntry(vMap, i - pObj->iDiff1), pObj->fCompl1 );
+        assert( iLit0 >= 0 && iLit1 >= 0 );
+        pObjNew = pGia->pObjs + iNew;
+        memset( pObjNew, 0, sizeof(Gia_Obj_t) );
+        pObjNew->iDiff0  = (unsigned)(iNew - Abc_Lit2Var(iLit0));
+        pObjNew->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+        pObjNew->iDiff1  = (unsigned)(iNew - Abc_Lit2Var(iLit1));
+        pObjNew->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+        Vec_IntWriteEntry( vMap, i, Abc_Var2Lit(iNew++, 0) );
+    }
+    memset( pGia->pObjs + iNew, 0, sizeof(Gia_Obj_t) * (pGia->nObjsAlloc - iNew) );
+    pGia->nObjs = iNew;
+    if ( p->fHashing )
+        Gia_ManHashStart( pGia );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        nNodes   += p->pThrs[i].nNodes;
+        nBlocks  += p->pThrs[i].nBlocks;
+        nSingles += p->pThrs[i].nSingles;
+    }
+    assert( nNodes == iNew - p->nObjsStart );
+    if ( fVerbose )
+        printf( "Concurrent construction: Threads = %d. Nodes = %d. Blocks = %d. Singles = %d. Unused slots = %d.\n",
+            p->nThreads, nNodes, nBlocks, nSingles, nObjs - iNew );
+    ABC_FREE( p->pTable );
+    ABC_FREE( p );
+    return vMap;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+Gia_Man_t * Gia_ManConcRehash( Gia_Man_t * p, int nThreads, int fVerbose ) { return Gia_ManRehash( p, 0 ); }
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Rehashes AIG using several threads.]
+
+  Description [The COs are distributed among the threads, which concurrently
+  rehash the logic cones of their COs into the same manager. The object IDs
+  of this manager depend on the interleaving of the threads, so the result
+  is renumbered in the topological order of the original AIG to make it
+  reproducible. Falls back to sequential rehashing if the concurrent
+  construction fails.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_ConThData_t_
+{
+    Gia_Man_t *     p;            // the original manager
+    Gia_Con_t *     pCon;         // the concurrent manager
+    Vec_Int_t *     vCopies;      // the copies of the objects
+    Vec_Int_t *     vCoLits;      // the literals of the COs
+    int             iThread;      // the thread number
+} Gia_ConThData_t;
+int Gia_ManConcRehash_rec( Gia_ConThData_t * pData, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( pData->p, iObj );
+    int iLit0, iLit1;
+    if ( Vec_IntEntry(pData->vCopies, iObj) >= 0 )
+        return Vec_IntEntry(pData->vCopies, iObj);
+    assert( Gia_ObjIsAnd(pObj) );
+    iLit0 = Gia_ManConcRehash_rec( pData, Gia_ObjFaninId0(pObj, iObj) );
+    if ( iLit0 == -1 )
+        return -1;
+    iLit1 = Gia_ManConcRehash_rec( pData, Gia_ObjFaninId1(pObj, iObj) );
+    if ( iLit1 == -1 )
+        return -1;
+    iLit0 = Gia_ManConcAnd( pData->pCon, pData->iThread, Abc_LitNotCond(iLit0, Gia_ObjFaninC0(pObj)), Abc_LitNotCond(iLit1, Gia_ObjFaninC1(pObj)) );
+    Vec_IntWriteEntry( pData->vCopies, iObj, iLit0 );
+    return iLit0;
+}
+void * Gia_ManConcWorkerThread( void * pArg )
+{
+    Gia_ConThData_t * pData = (Gia_ConThData_t *)pArg;
+    Gia_Obj_t * pObj;
+    int i, nThreads = pData->pCon->nThreads;
+    int iLit;
+    Gia_ManForEachCo( pData->p, pObj, i )
+    {
+        if ( i % nThreads != pData->iThread )
+            continue;
+        iLit = Gia_ManConcRehash_rec( pData, Gia_ObjFaninId0p(pData->p, pObj) );
+        if ( iLit == -1 )
+            break;
+        Vec_IntWriteEntry( pData->vCoLits, i, Abc_LitNotCond(iLit, Gia_ObjFaninC0(pObj)) );
+    }
+    return NULL;
+}
+Gia_Man_t * Gia_ManConcRehash( Gia_Man_t * p, int nThreads, int fVerbose )
+{
+    pthread_t WorkerThread[GIA_CONC_THR_MAX];
+    Gia_ConThData_t ThData[GIA_CONC_THR_MAX];
+    Gia_Man_t * pNew, * pTemp, * pConc;
+    Gia_Con_t * pCon;
+    Gia_Obj_t * pObj, * pObjNew;
+    Vec_Int_t * vCoLits, * vMap, * vFinal;
+    int i, k, iLit, iNew, status, fFailed;
+    abctime clk = Abc_Clock();
+    assert( nThreads > 0 && nThreads <= GIA_CONC_THR_MAX );
+    pConc = Gia_ManStart( Gia_ManObjNum(p) );
+    Gia_ManForEachCi( p, pObj, i )
+        Gia_ManAppendCi( pConc );
+    vCoLits = Vec_IntStartFull( Gia_ManCoNum(p) );
+    pCon = Gia_ManConcStart( pConc, Gia_ManObjNum(p), nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].pCon    = pCon;
+        ThData[i].vCopies = Vec_IntStartFull( Gia_ManObjNum(p) );
+        ThData[i].vCoLits = vCoLits;
+        ThData[i].iThread = i;
+        Vec_IntWriteEntry( ThData[i].vCopies, 0, 0 );
+        Gia_ManForEachCi( p, pObj, k )
+            Vec_IntWriteEntry( ThData[i].vCopies, Gia_ObjId(p, pObj), Abc_Var2Lit(1 + k, 0) );
+        status = pthread_create( WorkerThread + i, NULL, Gia_ManConcWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    fFailed = pCon->fFailed;
+    vMap = Gia_ManConcStop( pCon, fVerbose );
+    if ( fFailed )
+    {
+        if ( fVerbose )
+            printf( "Concurrent construction has exhausted the object storage. Rehashing sequentially.\n" );
+        pNew = NULL;
+    }
+    else
+    {
+        // renumber the nodes in the order of the original AIG
+        pNew = Gia_ManStart( Gia_ManObjNum(pConc) );
+        pNew->pName = Abc_UtilStrsav( p->pName );
+        pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+        vFinal = Vec_IntStartFull( Gia_ManObjNum(pConc) );
+        Vec_IntWriteEntry( vFinal, 0, 0 );
+        Gia_ManForEachCi( pConc, pObjNew, i )
+            Vec_IntWriteEntry( vFinal, Gia_ObjId(pConc, pObjNew), Gia_ManAppendCi(pNew) );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            for ( k = 0; k < nThreads; k++ )
+                if ( (iLit = Vec_IntEntry(ThData[k].vCopies, i)) >= 0 )
+                    break;
+            if ( k == nThreads )
+                continue;
+            iNew = Abc_Lit2Var( Vec_IntEntry(vMap, Abc_Lit2Var(iLit)) );
+            if ( Vec_IntEntry(vFinal, iNew) >= 0 )
+                continue;
+            // the fanins of this node are copies of the fanins of pObj
+            pObjNew = Gia_ManObj( pConc, iNew );
+            assert( Gia_ObjIsAnd(pObjNew) );
+            assert( Vec_IntEntry(vFinal, Gia_ObjFaninId0(pObjNew, iNew)) >= 0 );
+            assert( Vec_IntEntry(vFinal, Gia_ObjFaninId1(pObjNew, iNew)) >= 0 );
+            Vec_IntWriteEntry( vFinal, iNew, Gia_ManAppendAnd( pNew,
+                Abc_LitNotCond(Vec_IntEntry(vFinal, Gia_ObjFaninId0(pObjNew, iNew)), Gia_ObjFaninC0(pObjNew)),
+                Abc_LitNotCond(Vec_IntEntry(vFinal, Gia_ObjFaninId1(pObjNew, iNew)), Gia_ObjFaninC1(pObjNew)) ) );
+        }
+        Vec_IntForEachEntry( vCoLits, iLit, i )
+        {
+            iLit = Abc_LitNotCond( Vec_IntEntry(vMap, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+            Gia_ManAppendCo( pNew, Abc_LitNotCond(Vec_IntEntry(vFinal, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit)) );
+        }
+        Vec_IntFree( vFinal );
+        Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+        pNew = Gia_ManCleanup( pTemp = pNew );
+        Gia_ManStop( pTemp );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        Vec_IntFree( ThData[i].vCopies );
+    Vec_IntFree( vCoLits );
+    Vec_IntFree( vMap );
+    Gia_ManStop( pConc );
+    if ( pNew == NULL )
+        return Gia_ManRehash( p, 0 );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Concurrent rehashing time", Abc_Clock() - clk );
+    return pNew;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
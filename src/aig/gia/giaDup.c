@@ -744,11 +744,19 @@ Gia_Man_t * Gia_ManDup2( Gia_Man_t * p1, Gia_Man_t * p2 )
     Gia_ManHashStop( pNew );
     return pNew;
 }
-Gia_Man_t * Gia_ManDupWithAttributes( Gia_Man_t * p )
+/**Function*************************************************************
+
+  Synopsis    [Copies the attributes that do not depend on the object IDs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManDupAttributes( Gia_Man_t * pNew, Gia_Man_t * p )
 {
-    Gia_Man_t * pNew = Gia_ManDup(p);
-    Gia_ManTransferMapping( pNew, p );
-    Gia_ManTransferPacking( pNew, p );
     if ( p->pManTime )
         pNew->pManTime = Tim_ManDup( (Tim_Man_t *)p->pManTime, 0 );
     if ( p->pAigExtra )
@@ -763,6 +771,67 @@ Gia_Man_t * Gia_ManDupWithAttributes( Gia_Man_t * p )
         pNew->vConfigs = Vec_IntDup( p->vConfigs );
     if ( p->pCellStr )
         pNew->pCellStr = Abc_UtilStrsav( p->pCellStr );
+    if ( p->vAigerExtra )
+        pNew->vAigerExtra = Vec_StrDup( p->vAigerExtra );
+}
+Gia_Man_t * Gia_ManDupWithAttributes( Gia_Man_t * p )
+{
+    Gia_Man_t * pNew = Gia_ManDup(p);
+    Gia_ManTransferMapping( pNew, p );
+    Gia_ManTransferPacking( pNew, p );
+    Gia_ManDupAttributes( pNew, p );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a snapshot of the AIG.]
+
+  Description [The snapshot has the same objects and attributes as the 
+  result of Gia_ManDupWithAttributes(), but the objects are copied as
+  they are, without rebuilding the AIG and transferring the attributes.
+  The snapshot has no spare storage for new objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManDupSnapshot( Gia_Man_t * p )
+{
+    Gia_Man_t * pNew = ABC_CALLOC( Gia_Man_t, 1 );
+    pNew->nObjs       = p->nObjs;
+    pNew->nObjsAlloc  = p->nObjs;
+    pNew->pObjs       = ABC_ALLOC( Gia_Obj_t, p->nObjs );
+    memcpy( pNew->pObjs, p->pObjs, sizeof(Gia_Obj_t) * p->nObjs );
+    Gia_ManCleanMark01( pNew );
+    pNew->vCis        = Vec_IntDup( p->vCis );
+    pNew->vCos        = Vec_IntDup( p->vCos );
+    pNew->nRegs       = p->nRegs;
+    pNew->nXors       = p->nXors;
+    pNew->nMuxes      = p->nMuxes;
+    pNew->nBufs       = p->nBufs;
+    pNew->fGiaSimple  = p->fGiaSimple;
+    pNew->pName       = Abc_UtilStrsav( p->pName );
+    pNew->pSpec       = Abc_UtilStrsav( p->pSpec );
+    if ( p->pMuxes )
+    {
+        pNew->pMuxes = ABC_ALLOC( unsigned, p->nObjs );
+        memcpy( pNew->pMuxes, p->pMuxes, sizeof(unsigned) * p->nObjs );
+    }
+    if ( p->pSibls )
+    {
+        pNew->pSibls = ABC_ALLOC( int, p->nObjs );
+        memcpy( pNew->pSibls, p->pSibls, sizeof(int) * p->nObjs );
+    }
+    if ( p->pCexSeq )
+        pNew->pCexSeq = Abc_CexDup( p->pCexSeq, Gia_ManRegNum(p) );
+    // the object IDs are the same, so the mapping is copied as it is
+    if ( p->vMapping )
+        pNew->vMapping = Vec_IntDup( p->vMapping );
+    if ( p->vPacking )
+        pNew->vPacking = Vec_IntDup( p->vPacking );
+    Gia_ManDupAttributes( pNew, p );
     return pNew;
 }
 Gia_Man_t * Gia_ManDupRemovePis( Gia_Man_t * p, int nRemPis )
@@ -27,6 +27,12 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the open-addressing table stores four integers per slot (Lit0, Lit1, LitC, Id);
+// the slots are 16-byte aligned and never straddle a cache line; the number 
+// of slots is a power of two and the table is kept at most half full
+
+static int s_fHashOpen = 0; // the default hashing mode for new hash tables
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -51,9 +57,35 @@ static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize
     Key += Abc_LitIsCompl(iLit1) * 353;
     return (int)(Key % TableSize);
 }
+static inline int Gia_ManHashOpenOne( int iLit0, int iLit1, int iLitC, int Mask ) 
+{
+    word Key = ((word)(unsigned)iLit0 << 32) | (word)(unsigned)iLit1;
+    Key ^= (word)(unsigned)iLitC * ABC_CONST(0x9E3779B97F4A7C15);
+    Key *= ABC_CONST(0xFF51AFD7ED558CCD);
+    return (int)(Key >> 32) & Mask;
+}
+static inline int * Gia_ManHashOpenFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
+{
+    int Mask = Vec_IntSize(&p->vHTable) / 4 - 1;
+    int i = Gia_ManHashOpenOne( iLit0, iLit1, iLitC, Mask );
+    int * pSlot;
+    assert( p->pMuxes || iLit0 < iLit1 );
+    assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
+    assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
+    for ( ; ; i = (i + 1) & Mask )
+    {
+        pSlot = Vec_IntEntryP( &p->vHTable, 4 * i );
+        if ( pSlot[3] == 0 || (pSlot[0] == iLit0 && pSlot[1] == iLit1 && pSlot[2] == iLitC) )
+            return pSlot + 3;
+    }
+    return NULL;
+}
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
+    int iThis, * pPlace;
+    if ( p->fHashOpen )
+        return Gia_ManHashOpenFind( p, iLit0, iLit1, iLitC );
+    pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
     assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
@@ -66,6 +98,24 @@ static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iL
     }
     return pPlace;
 }
+static inline void Gia_ManHashSet( Gia_Man_t * p, int * pPlace, int iLit0, int iLit1, int iLitC, int iNode )
+{
+    assert( *pPlace == 0 && iNode > 0 );
+    if ( p->fHashOpen )
+    {
+        pPlace[-3] = iLit0;
+        pPlace[-2] = iLit1;
+        pPlace[-1] = iLitC;
+        p->nHashOpen++;
+    }
+    *pPlace = iNode;
+}
+static inline int Gia_ManHashIsFull( Gia_Man_t * p )
+{
+    if ( p->fHashOpen )
+        return 8 * (p->nHashOpen + 1) > Vec_IntSize(&p->vHTable);
+    return (p->nObjs & 0xFF) == 0 && Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) / 2;
+}
 
 /**Function*************************************************************
 
@@ -105,6 +155,15 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
     assert( Vec_IntSize(&p->vHTable) == 0 );
+    if ( s_fHashOpen )
+        p->fHashOpen = 1;
+    if ( p->fHashOpen )
+    {
+        int nSlots = 1 << Abc_Base2Log( Gia_ManAndNum(p) ? 2 * (Gia_ManAndNum(p) + 1000) : p->nObjsAlloc );
+        Vec_IntFill( &p->vHTable, 4 * Abc_MaxInt(nSlots, 1024), 0 );
+        p->nHashOpen = 0;
+        return;
+    }
     Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
     Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
     Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
@@ -130,8 +189,7 @@ void Gia_ManHashStart( Gia_Man_t * p )
     Gia_ManForEachAnd( p, pObj, i )
     {
         pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
-        assert( *pPlace == 0 );
-        *pPlace = i;
+        Gia_ManHashSet( p, pPlace, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i), i );
     }
 }
 
@@ -150,6 +208,7 @@ void Gia_ManHashStop( Gia_Man_t * p )
 {
     Vec_IntErase( &p->vHTable );
     Vec_IntErase( &p->vHash );
+    p->nHashOpen = 0;
 }
 
 /**Function*************************************************************
@@ -163,11 +222,57 @@ void Gia_ManHashStop( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
+void Gia_ManHashResizeOpen( Gia_Man_t * p )
+{
+    int i, * pSlot, * pPlace, Counter = p->nHashOpen;
+    Vec_Int_t vOld = p->vHTable;
+    assert( Vec_IntSize(&vOld) > 0 );
+    // replace the table
+    Vec_IntZero( &p->vHTable );
+    p->nHashOpen = 0;
+    if ( Vec_IntSize(&vOld) > 0x7FFFFFFF / 2 )
+    {
+        // the table cannot be doubled within the int range; continue with the chained table
+        p->fHashOpen = 0;
+        Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 );
+        Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
+        for ( i = 0; i < Vec_IntSize(&vOld); i += 4 )
+        {
+            pSlot = Vec_IntEntryP( &vOld, i );
+            if ( pSlot[3] == 0 )
+                continue;
+            pPlace = Gia_ManHashFind( p, pSlot[0], pSlot[1], pSlot[2] );
+            assert( *pPlace == 0 );
+            *pPlace = pSlot[3];
+            Counter--;
+        }
+        assert( Counter == 0 );
+        Vec_IntErase( &vOld );
+        return;
+    }
+    Vec_IntFill( &p->vHTable, 2 * Vec_IntSize(&vOld), 0 );
+    // rehash the entries from the old table
+    for ( i = 0; i < Vec_IntSize(&vOld); i += 4 )
+    {
+        pSlot = Vec_IntEntryP( &vOld, i );
+        if ( pSlot[3] == 0 )
+            continue;
+        pPlace = Gia_ManHashOpenFind( p, pSlot[0], pSlot[1], pSlot[2] );
+        Gia_ManHashSet( p, pPlace, pSlot[0], pSlot[1], pSlot[2], pSlot[3] );
+    }
+    assert( Counter == p->nHashOpen );
+    Vec_IntErase( &vOld );
+}
 void Gia_ManHashResize( Gia_Man_t * p )
 {
     int i, iThis, iNext, Counter, Counter2, * pPlace;
     Vec_Int_t vOld = p->vHTable;
     assert( Vec_IntSize(&vOld) > 0 );
+    if ( p->fHashOpen )
+    {
+        Gia_ManHashResizeOpen( p );
+        return;
+    }
     // replace the table
     Vec_IntZero( &p->vHTable );
     Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
@@ -204,10 +309,37 @@ void Gia_ManHashResize( Gia_Man_t * p )
   SeeAlso     []
 
 ******************************************************************************/
+void Gia_ManHashProfileOpen( Gia_Man_t * p )
+{
+    int nSlots = Vec_IntSize(&p->vHTable) / 4;
+    int i, * pSlot, Dist, DistMax = 0, Hist[8] = {0};
+    word DistTotal = 0;
+    printf( "Table size = %d. Entries = %d. ", nSlots, p->nHashOpen );
+    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
+    for ( i = 0; i < nSlots; i++ )
+    {
+        pSlot = Vec_IntEntryP( &p->vHTable, 4 * i );
+        if ( pSlot[3] == 0 )
+            continue;
+        Dist = (i - Gia_ManHashOpenOne( pSlot[0], pSlot[1], pSlot[2], nSlots - 1 )) & (nSlots - 1);
+        DistMax = Abc_MaxInt( DistMax, Dist );
+        DistTotal += Dist;
+        Hist[Abc_MinInt(Dist, 7)]++;
+    }
+    printf( "Probe distance: Ave = %.2f. Max = %d. Histogram: ", p->nHashOpen ? 1.0*DistTotal/p->nHashOpen : 0.0, DistMax );
+    for ( i = 0; i < 8; i++ )
+        printf( "%s%d=%d ", i == 7 ? ">=" : "", i, Hist[i] );
+    printf( "\n" );
+}
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
     int iEntry;
     int i, Counter, Limit;
+    if ( p->fHashOpen )
+    {
+        Gia_ManHashProfileOpen( p );
+        return;
+    }
     printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
     Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
@@ -478,7 +610,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( Gia_ManHashIsFull(p) )
         Gia_ManHashResize( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
@@ -494,14 +626,13 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
+        if ( p->fHashOpen || Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
+            Gia_ManHashSet( p, pPlace, iLit0, iLit1, -1, Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) ) );
         else
         {
             int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
             pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
+            Gia_ManHashSet( p, pPlace, iLit0, iLit1, -1, Abc_Lit2Var( iNode ) );
         }
         return Abc_Var2Lit( *pPlace, fCompl );
     }
@@ -541,6 +672,8 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
     if ( Abc_LitIsCompl(iLit1) )
         iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+    if ( p->fHashOpen && Gia_ManHashIsFull(p) )
+        Gia_ManHashResize( p );
     {
         int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
         if ( *pPlace )
@@ -549,14 +682,13 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
+        if ( p->fHashOpen || Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
+            Gia_ManHashSet( p, pPlace, iLit0, iLit1, iLitC, Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) ) );
         else
         {
             int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
             pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
+            Gia_ManHashSet( p, pPlace, iLit0, iLit1, iLitC, Abc_Lit2Var( iNode ) );
         }
         return Abc_Var2Lit( *pPlace, fCompl );
     }
@@ -588,7 +720,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
+    if ( Gia_ManHashIsFull(p) )
         Gia_ManHashResize( p );
     if ( p->fAddStrash )
     {
@@ -606,14 +738,13 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
+        if ( p->fHashOpen || Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
+            Gia_ManHashSet( p, pPlace, iLit0, iLit1, -1, Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) ) );
         else
         {
             int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
             pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
+            Gia_ManHashSet( p, pPlace, iLit0, iLit1, -1, Abc_Lit2Var( iNode ) );
         }
         return Abc_Var2Lit( *pPlace, 0 );
     }
@@ -768,6 +899,83 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Sets the default hashing mode for new hash tables.]
+
+  Description [Returns the previous mode. When the mode is on, 
+  Gia_ManHashAlloc() starts the open-addressing table regardless of
+  the value of the fHashOpen flag of the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashSetOpen( int fOpen )  
+{
+    int fOpenOld = s_fHashOpen;
+    s_fHashOpen = fOpen;
+    return fOpenOld;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares chained and open-addressing hash tables.]
+
+  Description [Runs rehashing (&st), normalization with hashing and 
+  the round trip through MUXes and XORs (&st -m followed by &st), which 
+  hashes two- and three-input nodes, with each hashing mode and reports 
+  the runtime.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashCompare( Gia_Man_t * p, int nIters, int fVerbose )  
+{
+    char * pNames[3] = { "&st", "normalize", "&st -m" };
+    abctime clk, clkTotal[3][2] = {{0}};
+    int nAnds[3][2] = {{0}};
+    int i, k, m, fOpenOld = s_fHashOpen;
+    for ( m = 0; m < 2; m++ )
+    {
+        s_fHashOpen = m;
+        for ( i = 0; i < nIters; i++ )
+        for ( k = 0; k < 3; k++ )
+        {
+            Gia_Man_t * pNew, * pTemp;
+            clk = Abc_Clock();
+            if ( k == 0 )
+                pNew = Gia_ManRehash( p, 0 );
+            else if ( k == 1 )
+                pNew = Gia_ManDupNormalize( p, 1 );
+            else
+            {
+                pTemp = Gia_ManDupMuxes( p, 2 );
+                pNew  = Gia_ManDupNoMuxes( pTemp, 0 );
+                Gia_ManStop( pTemp );
+            }
+            clkTotal[k][m] += Abc_Clock() - clk;
+            nAnds[k][m] = Gia_ManAndNum(pNew);
+            if ( fVerbose && i == 0 && k == 0 )
+                Gia_ManPrintStats( pNew, NULL );
+            Gia_ManStop( pNew );
+        }
+    }
+    s_fHashOpen = fOpenOld;
+    printf( "Comparing hash tables on %d iterations:\n", nIters );
+    for ( k = 0; k < 3; k++ )
+    {
+        printf( "%-10s : Nodes = %9d  Chained = %9.2f sec  Open = %9.2f sec  Ratio = %6.2f\n", pNames[k], nAnds[k][0],
+            1.0*((double)(clkTotal[k][0]))/((double)CLOCKS_PER_SEC), 1.0*((double)(clkTotal[k][1]))/((double)CLOCKS_PER_SEC), 
+            clkTotal[k][1] ? 1.0*clkTotal[k][0]/clkTotal[k][1] : 0.0 );
+        if ( nAnds[k][0] != nAnds[k][1] )
+            printf( "Warning: The number of nodes differs (%d vs %d).\n", nAnds[k][0], nAnds[k][1] );
+    }
+}
+
 
 /**Function*************************************************************
 
@@ -78,6 +78,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->fPower      =  0;
     p->fCutMin     =  0;
     p->fVerbose    =  0;
+    p->nThreads    =  1;
     p->pLutStruct  =  NULL;
     // internal parameters
     p->fTruth      =  0;
@@ -2410,6 +2411,69 @@ Gia_Man_t * Gia_ManPerformMapping( Gia_Man_t * p, void * pp )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks the kernels for merging and filtering cuts.]
+
+  Description [Maps the AIG into K-input LUTs several times using each 
+  cut kernel supported by the CPU (or only kernel iKernel, if it is not -1)
+  and reports the number of merged cuts per second. The mapping results 
+  of all kernels should be the same. The kernel selected for the other 
+  commands is restored.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManIfCutBench( Gia_Man_t * p, int nLutSize, int nCutsMax, int nRounds, int iKernel, int fVerbose )
+{
+    If_Par_t Pars, * pPars = &Pars;
+    If_Man_t * pIfMan;
+    int r, iKer, iKerBest = If_CutKernelBest();
+    int iKerOld = If_CutKernelSet( -1 );
+    double nCuts;
+    float Area = 0, Area0 = 0, Delay = 0, Delay0 = 0;
+    abctime clk, clkMap;
+    Abc_Print( 1, "Mapping %d nodes into %d-LUTs with %d cuts per node for %d rounds.\n", Gia_ManAndNum(p), nLutSize, nCutsMax, nRounds );
+    if ( iKernel > iKerBest )
+        Abc_Print( 1, "Kernel %d is not supported by the CPU. Using kernel %d.\n", iKernel, iKerBest );
+    for ( iKer = 0; iKer <= iKerBest; iKer++ )
+    {
+        if ( iKernel >= 0 && iKer != Abc_MinInt(iKernel, iKerBest) )
+            continue;
+        If_CutKernelSet( iKer );
+        nCuts  = 0;
+        clkMap = 0;
+        for ( r = 0; r < nRounds; r++ )
+        {
+            Gia_ManSetIfParsDefault( pPars );
+            pPars->nLutSize = nLutSize;
+            pPars->nCutsMax = nCutsMax;
+            pIfMan = Gia_ManToIf( p, pPars );
+            clk = Abc_Clock();
+            If_ManPerformMapping( pIfMan );
+            clkMap += Abc_Clock() - clk;
+            nCuts  += pIfMan->nCutsTotal;
+            Area    = pIfMan->AreaGlo;
+            Delay   = pIfMan->RequiredGlo;
+            If_ManStop( pIfMan );
+        }
+        if ( iKer == 0 || iKernel >= 0 )
+            Area0 = Area, Delay0 = Delay;
+        Abc_Print( 1, "%-7s : Cuts =%10.2f M cuts/sec   Area = %9.1f   Delay = %7.2f%s\n", 
+            If_CutKernelName(), 
+            nCuts / 1000000 / Abc_MaxDouble(1.0 * clkMap / CLOCKS_PER_SEC, 0.000001),
+            Area, Delay, (Area == Area0 && Delay == Delay0) ? "" : "  (MISMATCH)" );
+        if ( fVerbose )
+        {
+            Abc_Print( 1, "Merged cuts = %.0f.  ", nCuts / nRounds );
+            Abc_PrintTime( 1, "Mapping", clkMap );
+        }
+    }
+    If_CutKernelSet( iKerOld );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Interface of other mapping-based procedures.]
@@ -24,6 +24,15 @@
 #include "misc/vec/vecMem.h"
 #include "misc/util/utilTruth.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -37,6 +46,8 @@ ABC_NAMESPACE_IMPL_START
 #define LF_CUT_WORDS (4+LF_LEAF_MAX/2)
 #define LF_TT_WORDS  ((LF_LEAF_MAX > 6) ? 1 << (LF_LEAF_MAX-6) : 1)
 #define LF_EPSILON 0.005
+#define LF_PROC_MAX  64
+#define LF_PAR_WIDTH 16   // the min average number of nodes per level and thread
 
 typedef struct Lf_Cut_t_ Lf_Cut_t; 
 struct Lf_Cut_t_
@@ -71,8 +82,9 @@ struct Lf_Mem_t_
     int             MaskPage;        // page mask
     int             nCutWords;       // cut size in words
     int             iCur;            // writing position 
+    int             fLevOrder;       // the cuts are saved in the order of levels
     Vec_Ptr_t       vPages;          // memory pages
-    Vec_Ptr_t *     vFree;           // free pages 
+    Gia_MmPage_t *  pMemPages;       // page memory 
 };
 typedef struct Lf_Man_t_ Lf_Man_t; 
 struct Lf_Man_t_
@@ -87,7 +99,7 @@ struct Lf_Man_t_
     Vec_Ptr_t       vMemSets;        // memory for cutsets
     Vec_Int_t       vFreeSets;       // free cutsets
     Vec_Mem_t *     vTtMem;          // truth tables
-    Vec_Ptr_t       vFreePages;      // free memory pages
+    Gia_MmPage_t *  pMemPages;       // memory pages of the cut stores
     Lf_Mem_t        vStoreOld;       // previous cuts
     Lf_Mem_t        vStoreNew;       // current cuts
     // mapper data
@@ -98,6 +110,14 @@ struct Lf_Man_t_
     Vec_Int_t       vMapRefs;        // mapping refs
     Vec_Flt_t       vSwitches;       // switching activity
     Vec_Int_t       vCiArrivals;     // arrival times of the CIs
+    // parallel cut computation
+    Vec_Int_t *     vLevOrder;       // internal nodes in the order of levels
+    Vec_Int_t *     vLevStarts;      // the first node of each level in vLevOrder
+    Vec_Wrd_t *     vCutBuf;         // best cuts computed by a worker thread
+    Vec_Wrd_t *     vSetBuf;         // cutsets computed by a worker thread
+    Vec_Wrd_t *     vTtNew;          // truth tables found by a worker thread
+    Vec_Int_t *     vTtIds;          // the IDs of these truth tables in vTtMem
+    int             iTtNew;          // the truth table ID of the first entry in vTtNew
     // statistics
     abctime         clkStart;        // starting time
     double          CutCount[4];     // cut counts
@@ -115,7 +135,7 @@ struct Lf_Man_t_
 
 static inline void        Lf_CutCopy( Lf_Cut_t * p, Lf_Cut_t * q, int n ) { memcpy(p, q, sizeof(word) * n);                                         }
 static inline Lf_Cut_t *  Lf_CutNext( Lf_Cut_t * p, int n )               { return (Lf_Cut_t *)((word *)p + n);                                     }
-static inline word *      Lf_CutTruth( Lf_Man_t * p, Lf_Cut_t * pCut )    { return Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut->iFunc));           }
+static inline int         Lf_CutIsNew( Lf_Man_t * p, Lf_Cut_t * pCut )    { return p->vTtNew && Abc_Lit2Var(pCut->iFunc) >= p->iTtNew;              }
 
 static inline int         Lf_ObjOff( Lf_Man_t * p, int i )                { return Vec_IntEntry(&p->vOffsets, i);                                   }
 static inline int         Lf_ObjRequired( Lf_Man_t * p, int i )           { return Vec_IntEntry(&p->vRequired, i);                                  }
@@ -134,6 +154,13 @@ static inline int         Lf_BestCutIndex( Lf_Bst_t * p )                 { if (
 #define Lf_CutSetForEachCut( nWords, pCutSet, pCut, i, nCuts )  for ( i = 0, pCut = pCutSet; i < nCuts; pCut = Lf_CutNext(pCut, nWords), i++ ) 
 #define Lf_CutForEachVar( pCut, Var, i )                        for ( i = 0; i < (int)pCut->nLeaves && (Var = pCut->pLeaves[i]); i++ ) if ( Lf_ObjOff(p, Var) < 0 ) {} else
 
+static inline word * Lf_CutTruth( Lf_Man_t * p, Lf_Cut_t * pCut )
+{
+    if ( Lf_CutIsNew(p, pCut) ) // temporary ID assigned by a worker thread
+        return Vec_WrdEntryP( p->vTtNew, Vec_MemEntrySize(p->vTtMem) * (Abc_Lit2Var(pCut->iFunc) - p->iTtNew) );
+    return Vec_MemReadEntry( p->vTtMem, Abc_Lit2Var(pCut->iFunc) );
+}
+
 extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_Int_t * vMemory, Vec_Int_t * vLeaves, int fHash );
 
 ////////////////////////////////////////////////////////////////////////
@@ -369,7 +396,9 @@ static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
     int Entry = Vec_IntEntry( &p->vCutSets, iOffSet );
     assert( Gia_ObjIsAndNotBuf(pObj) );
     assert( pObj->Value > 0 );
-    if ( Entry == -1 ) // first visit
+    if ( p->vSetBuf ) // worker thread; the cutset references are updated when the level is committed
+        assert( Entry != -1 );
+    else if ( Entry == -1 ) // first visit
     {
         if ( Vec_IntSize(&p->vFreeSets) == 0 ) // add new
         {
@@ -393,11 +422,10 @@ static inline Lf_Cut_t * Lf_ManFetchSet( Lf_Man_t * p, int i )
     }
     return (Lf_Cut_t *)((word *)Vec_PtrEntry(&p->vMemSets, Entry >> LF_LOG_PAGE) + p->nSetWords * (Entry & uMaskPage));
 }
-static inline int Lf_ManPrepareSet( Lf_Man_t * p, int iObj, int Index, Lf_Cut_t ** ppCutSet )
+static inline int Lf_ManPrepareSet( Lf_Man_t * p, int iObj, word * pCutTemp, Lf_Cut_t ** ppCutSet )
 {
-    static word CutTemp[3][LF_CUT_WORDS];
     if ( Vec_IntEntry(&p->vOffsets, iObj) == -1 )
-        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)CutTemp[Index]), iObj );
+        return Lf_CutCreateUnit( (*ppCutSet = (Lf_Cut_t *)pCutTemp), iObj );
     {
         Lf_Cut_t * pCut; 
         int i, nCutNum = p->pPars->nCutNum;
@@ -515,13 +543,13 @@ static inline int Lf_CutIsMux( Lf_Man_t * p, Lf_Cut_t * pCut, Gia_Obj_t * pMux )
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Lf_MemAlloc( Lf_Mem_t * p, int LogPage, Vec_Ptr_t * vFree, int nCutWords )
+static inline void Lf_MemAlloc( Lf_Mem_t * p, Gia_MmPage_t * pMemPages, int nCutWords )
 {
     memset( p, 0, sizeof(Lf_Mem_t) );
-    p->LogPage   = LogPage;
-    p->MaskPage  = (1 << LogPage) - 1;
+    p->LogPage   = Abc_Base2Log( Gia_MmPageReadPageSize(pMemPages) );
+    p->MaskPage  = (1 << p->LogPage) - 1;
     p->nCutWords = nCutWords;
-    p->vFree     = vFree;
+    p->pMemPages = pMemPages;
 }
 static inline int Lf_MemSaveCut( Lf_Mem_t * p, Lf_Cut_t * pCut, int iObj )
 {
@@ -529,7 +557,7 @@ static inline int Lf_MemSaveCut( Lf_Mem_t * p, Lf_Cut_t * pCut, int iObj )
     int i, iPlace, Prev = iObj, iCur = p->iCur;
     assert( !pCut->fMux7 );
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> p->LogPage) )
-        Vec_PtrPush( &p->vPages, Vec_PtrSize(p->vFree) ? Vec_PtrPop(p->vFree) : ABC_ALLOC(char,p->MaskPage+1) );
+        Vec_PtrPush( &p->vPages, Gia_MmPageFetch(p->pMemPages) );
     assert( p->MaskPage - (p->iCur & p->MaskPage) >= 4 * (LF_LEAF_MAX + 2) );
     iPlace = iCur & p->MaskPage;
     pPlace = (unsigned char *)Vec_PtrEntry(&p->vPages, p->iCur >> p->LogPage);
@@ -557,9 +585,9 @@ static inline Lf_Cut_t * Lf_MemLoadCut( Lf_Mem_t * p, int iCur, int iObj, Lf_Cut
         pCut->pLeaves[i] = Prev - Gia_AigerReadUnsigned(&pPlace), Prev = pCut->pLeaves[i];
     pCut->iFunc = fTruth ? Gia_AigerReadUnsigned(&pPlace) : -1;
     assert( pCut->nLeaves >= 2 || pCut->iFunc <= 3 );
-    if ( fRecycle && Page && Vec_PtrEntry(&p->vPages, Page-1) )
+    if ( fRecycle && !p->fLevOrder && Page && Vec_PtrEntry(&p->vPages, Page-1) )
     {
-        Vec_PtrPush( p->vFree, Vec_PtrEntry(&p->vPages, Page-1) );
+        Gia_MmPageRecycle( p->pMemPages, (char *)Vec_PtrEntry(&p->vPages, Page-1) );
         Vec_PtrWriteEntry( &p->vPages, Page-1, NULL );
     }
     pCut->Sign = fRecycle ? Lf_CutGetSign(pCut) : 0;
@@ -568,13 +596,26 @@ static inline Lf_Cut_t * Lf_MemLoadCut( Lf_Mem_t * p, int iCur, int iObj, Lf_Cut
 }
 static inline void Lf_MemRecycle( Lf_Mem_t * p )
 {
-    void * pPlace; int i;
-    Vec_PtrForEachEntry( void *, &p->vPages, pPlace, i )
-        if ( pPlace )
-            Vec_PtrPush( p->vFree, pPlace );
-    Vec_PtrClear( &p->vPages );
+    Gia_MmPageRecycleAll( p->pMemPages, &p->vPages );
     p->iCur = 0;
 }
+static inline int Lf_ManSaveCut( Lf_Man_t * p, Lf_Cut_t * pCut, int iObj )
+{
+    int i, Handle;
+    if ( p->vCutBuf == NULL )
+        return Lf_MemSaveCut( &p->vStoreNew, pCut, iObj );
+    // worker threads keep the cut until the level is committed
+    Handle = Vec_WrdSize( p->vCutBuf );
+    for ( i = 0; i < p->nCutWords; i++ )
+        Vec_WrdPush( p->vCutBuf, ((word *)pCut)[i] );
+    return Handle;
+}
+static inline Lf_Cut_t * Lf_ManBufferSet( Lf_Man_t * p )
+{
+    int Size = Vec_WrdSize( p->vSetBuf );
+    Vec_WrdFillExtra( p->vSetBuf, Size + p->nSetWords, 0 );
+    return (Lf_Cut_t *)Vec_WrdEntryP( p->vSetBuf, Size );
+}
 static inline Lf_Cut_t * Lf_MemLoadMuxCut( Lf_Man_t * p, int iObj, Lf_Cut_t * pCut )
 {
     Gia_Obj_t * pMux = Gia_ManObj( p->pGia, iObj );
@@ -587,11 +628,6 @@ static inline Lf_Cut_t * Lf_MemLoadMuxCut( Lf_Man_t * p, int iObj, Lf_Cut_t * pC
     pCut->fMux7 = 1;
     return pCut;
 }
-static inline Lf_Cut_t * Lf_ObjCutMux( Lf_Man_t * p, int i )
-{
-    static word CutSet[LF_CUT_WORDS];
-    return Lf_MemLoadMuxCut( p, i, (Lf_Cut_t *)CutSet );
-}
 static inline Lf_Cut_t * Lf_ObjCutBest( Lf_Man_t * p, int i )
 {
     static word CutSet[LF_CUT_WORDS];
@@ -961,6 +997,19 @@ static inline int Lf_ManFindCofVar( word * pTruth, int nWords, int nVars )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Lf_ManTruthInsert( Lf_Man_t * p, word * pTruth )
+{
+    int i, * pSpot, nWords = Vec_MemEntrySize(p->vTtMem);
+    if ( p->vTtNew == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    // worker threads do not update the table; new functions get temporary IDs
+    pSpot = Vec_MemHashLookup( p->vTtMem, pTruth );
+    if ( *pSpot != -1 )
+        return *pSpot;
+    for ( i = 0; i < nWords; i++ )
+        Vec_WrdPush( p->vTtNew, pTruth[i] );
+    return p->iTtNew + Vec_WrdSize(p->vTtNew) / nWords - 1;
+}
 static inline int Lf_CutComputeTruth6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t * pCut1, int fCompl0, int fCompl1, Lf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Mf_ManTruthCanonicize( word * t, int nVars );
@@ -975,7 +1024,7 @@ static inline int Lf_CutComputeTruth6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
 //    p->nCutMux += Lf_ManTtIsMux( t );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -1004,7 +1053,7 @@ static inline int Lf_CutComputeTruth( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManTruthInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1026,7 +1075,7 @@ static inline int Lf_CutComputeTruthMux6( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Lf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1054,7 +1103,7 @@ static inline int Lf_CutComputeTruthMux( Lf_Man_t * p, Lf_Cut_t * pCut0, Lf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Lf_ManTruthInsert(p, uTruth);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
@@ -1186,6 +1235,7 @@ static inline void Lf_CutParams( Lf_Man_t * p, Lf_Cut_t * pCut, int Required, fl
 void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
 {
     word CutSet[LF_CUT_MAX][LF_CUT_WORDS] = {{0}};
+    word CutTemp[3][LF_CUT_WORDS];
     Lf_Cut_t * pCutSet0, * pCutSet1, * pCutSet2, * pCut0, * pCut1, * pCut2;
     Lf_Cut_t * pCutSet = (Lf_Cut_t *)CutSet, * pCutsR[LF_CUT_MAX];
     Gia_Obj_t * pObj = Gia_ManObj(p->pGia, iObj);
@@ -1197,8 +1247,8 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     int nCutWords  = p->nCutWords;
     int fComp0     = Gia_ObjFaninC0(pObj);
     int fComp1     = Gia_ObjFaninC1(pObj);
-    int nCuts0     = Lf_ManPrepareSet( p, Gia_ObjFaninId0(pObj, iObj), 0, &pCutSet0 );
-    int nCuts1     = Lf_ManPrepareSet( p, Gia_ObjFaninId1(pObj, iObj), 1, &pCutSet1 );
+    int nCuts0     = Lf_ManPrepareSet( p, Gia_ObjFaninId0(pObj, iObj), CutTemp[0], &pCutSet0 );
+    int nCuts1     = Lf_ManPrepareSet( p, Gia_ObjFaninId1(pObj, iObj), CutTemp[1], &pCutSet1 );
     int iSibl      = Gia_ObjSibl(p->pGia, iObj);
     int i, k, n, iCutUsed, nCutsR = 0;
     float Value1 = -1, Value2 = -1;
@@ -1233,7 +1283,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     {
         Gia_Obj_t * pObjE = Gia_ObjSiblObj(p->pGia, iObj);
         int fCompE = Gia_ObjPhase(pObj) ^ Gia_ObjPhase(pObjE);
-        int nCutsE = Lf_ManPrepareSet( p, iSibl, 2, &pCutSet2 );
+        int nCutsE = Lf_ManPrepareSet( p, iSibl, CutTemp[2], &pCutSet2 );
         Lf_CutSetForEachCut( nCutWords, pCutSet2, pCut2, n, nCutsE )
         {
             if ( pCut2->pLeaves[0] == iSibl )
@@ -1249,7 +1299,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     {
         Lf_Cut_t * pCutSave = NULL;
         int fComp2 = Gia_ObjFaninC2(p->pGia, pObj);
-        int nCuts2 = Lf_ManPrepareSet( p, Gia_ObjFaninId2(p->pGia, iObj), 2, &pCutSet2 );
+        int nCuts2 = Lf_ManPrepareSet( p, Gia_ObjFaninId2(p->pGia, iObj), CutTemp[2], &pCutSet2 );
         p->CutCount[0] += nCuts0 * nCuts1 * nCuts2;
         Lf_CutSetForEachCut( nCutWords, pCutSet0, pCut0, i, nCuts0 ) if ( (int)pCut0->nLeaves <= nLutSize )
         Lf_CutSetForEachCut( nCutWords, pCutSet1, pCut1, k, nCuts1 ) if ( (int)pCut1->nLeaves <= nLutSize )
@@ -1336,7 +1386,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     // delay cut
     assert( nCutsR == 1 || pCutsR[0]->Delay <= pCutsR[1]->Delay );
     pBest->Cut[0].fUsed = pBest->Cut[1].fUsed = 0;
-    pBest->Cut[0].Handle = pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, pCutsR[0], iObj);
+    pBest->Cut[0].Handle = pBest->Cut[1].Handle = Lf_ManSaveCut(p, pCutsR[0], iObj);
     pBest->Delay[0] = pBest->Delay[1] = pCutsR[0]->Delay;
     pBest->Flow[0] = pBest->Flow[1] = pCutsR[0]->Flow;
     p->nCutCounts[pCutsR[0]->nLeaves]++;
@@ -1346,7 +1396,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     iCutUsed = 0;
     if ( nCutsR > 1 && pCutsR[0]->Flow > pCutsR[1]->Flow + LF_EPSILON )//&& !pCutsR[1]->fLate ) // can remove !fLate
     {
-        pBest->Cut[1].Handle = Lf_MemSaveCut(&p->vStoreNew, pCutsR[1], iObj);
+        pBest->Cut[1].Handle = Lf_ManSaveCut(p, pCutsR[1], iObj);
         pBest->Delay[1] = pCutsR[1]->Delay;
         pBest->Flow[1] = pCutsR[1]->Flow;
         p->nCutCounts[pCutsR[1]->nLeaves]++;
@@ -1357,7 +1407,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     // mux cut
     if ( p->pPars->fUseMux7 && Gia_ObjIsMuxId(p->pGia, iObj) )
     {
-        pCut2 = Lf_ObjCutMux( p, iObj );
+        pCut2 = Lf_MemLoadMuxCut( p, iObj, (Lf_Cut_t *)CutTemp[2] );
         Lf_CutParams( p, pCut2, Required, FlowRefs, pObj );
         pBest->Delay[2] = pCut2->Delay;
         pBest->Flow[2] = pCut2->Flow;
@@ -1380,7 +1430,7 @@ void Lf_ObjMergeOrder( Lf_Man_t * p, int iObj )
     if ( pObj->Value == 0 )
         return;
     // store the cutset
-    pCutSet = Lf_ManFetchSet(p, iObj);
+    pCutSet = p->vSetBuf ? Lf_ManBufferSet(p) : Lf_ManFetchSet(p, iObj);
     Lf_CutSetForEachCut( nCutWords, pCutSet, pCut0, i, nCutNum )
     {
         assert( !pCut0->fMux7 );
@@ -1959,9 +2009,9 @@ Lf_Man_t * Lf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
         Vec_MemAddMuxTT( p->vTtMem, pPars->nLutSize );
     p->pObjBests = ABC_CALLOC( Lf_Bst_t, Gia_ManAndNotBufNum(pGia) );
     Vec_IntGrow( &p->vFreeSets, (1<<14) );
-    Vec_PtrGrow( &p->vFreePages, 256 );
-    Lf_MemAlloc( &p->vStoreOld, 16, &p->vFreePages, p->nCutWords );
-    Lf_MemAlloc( &p->vStoreNew, 16, &p->vFreePages, p->nCutWords );
+    p->pMemPages = Gia_MmPageStart( 16 );
+    Lf_MemAlloc( &p->vStoreOld, p->pMemPages, p->nCutWords );
+    Lf_MemAlloc( &p->vStoreNew, p->pMemPages, p->nCutWords );
     Vec_IntFill( &p->vOffsets,  Gia_ManObjNum(pGia), -1 );
     Vec_IntFill( &p->vRequired, Gia_ManObjNum(pGia), ABC_INFINITY );
     Vec_IntFill( &p->vCutSets,  Gia_ManAndNotBufNum(pGia), -1 );
@@ -1987,14 +2037,10 @@ void Lf_ManFree( Lf_Man_t * p )
     if ( p->pPars->fCutMin )
         Vec_MemFree( p->vTtMem );
     Vec_PtrFreeData( &p->vMemSets );
-    Vec_PtrFreeData( &p->vFreePages );
-    Vec_PtrFreeData( &p->vStoreOld.vPages );
-    Vec_PtrFreeData( &p->vStoreNew.vPages );
+    Gia_MmPageStop( p->pMemPages, 0 );
     ABC_FREE( p->vMemSets.pArray );
-    ABC_FREE( p->vFreePages.pArray );
     ABC_FREE( p->vStoreOld.vPages.pArray );
     ABC_FREE( p->vStoreNew.vPages.pArray );
-    ABC_FREE( p->vFreePages.pArray );
     ABC_FREE( p->vFreeSets.pArray );
     ABC_FREE( p->vOffsets.pArray );
     ABC_FREE( p->vRequired.pArray );
@@ -2004,6 +2050,8 @@ void Lf_ManFree( Lf_Man_t * p )
     ABC_FREE( p->vSwitches.pArray );
     ABC_FREE( p->vCiArrivals.pArray );
     ABC_FREE( p->pObjBests );
+    Vec_IntFreeP( &p->vLevOrder );
+    Vec_IntFreeP( &p->vLevStarts );
     ABC_FREE( p );
 }
 
@@ -2046,6 +2094,7 @@ void Lf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  LF_LEAF_MAX;
     pPars->nCutNumMax   =  LF_CUT_MAX;
+    pPars->nProcNumMax  =  LF_PROC_MAX;
 }
 void Lf_ManPrintStats( Lf_Man_t * p, char * pTitle )
 {
@@ -2086,7 +2135,7 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
 {
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(int) * (2 * Gia_ManObjNum(p->pGia) + 3 * Gia_ManAndNotBufNum(p->pGia)) / (1<<20); // offset, required, cutsets, maprefs, flowrefs
-    float MemCutsB = 1.0 * (p->vStoreOld.MaskPage + 1) * (Vec_PtrSize(&p->vFreePages) + Vec_PtrSize(&p->vStoreOld.vPages)) / (1<<20) + 1.0 * sizeof(Lf_Bst_t) * Gia_ManAndNotBufNum(p->pGia) / (1<<20);
+    float MemCutsB = Gia_MmPageReadMemUsage(p->pMemPages) / (1<<20) + 1.0 * sizeof(Lf_Bst_t) * Gia_ManAndNotBufNum(p->pGia) / (1<<20);
     float MemCutsF = 1.0 * sizeof(word) * p->nSetWords * (1<<LF_LOG_PAGE) * Vec_PtrSize(&p->vMemSets) / (1<<20);
     float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
@@ -2135,13 +2184,272 @@ void Lf_ManPrintQuit( Lf_Man_t * p, Gia_Man_t * pNew )
     Abc_PrintTime( 1, "Time",    Abc_Clock() - p->clkStart );
     fflush( stdout );
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Checks if the cuts can be computed using several threads.]
+
+  Description [Collects the internal nodes in the order of levels if 
+  there are enough of them on each level.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lf_ManParCheck( Lf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pPars->nProcNum < 2 || p->pGia->pManTime != NULL || Gia_ManHasChoices(p->pGia) || Gia_ManBufNum(p->pGia) > 0 )
+        return 0;
+    p->vLevOrder = Gia_ManLevelOrder( p->pGia, &p->vLevStarts );
+    if ( Gia_ManAndNum(p->pGia) >= LF_PAR_WIDTH * p->pPars->nProcNum * (Vec_IntSize(p->vLevStarts) - 2) )
+        return 1;
+    Vec_IntFreeP( &p->vLevOrder );
+    Vec_IntFreeP( &p->vLevStarts );
+#endif
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts using several threads.]
+
+  Description [The nodes are processed level by level and each thread 
+  works on its slice of the level using a copy of the manager. Instead 
+  of updating the shared data, the copy collects the best cuts, the 
+  cutsets, the new truth tables and the statistics. After each level, 
+  the first thread adds the truth tables to the store, updates the 
+  cutset references and saves the cuts in the order of the nodes. 
+  Because the cuts are now saved level by level, the pages of the 
+  previous cut store are recycled once the next level no longer needs 
+  them. The result is the same as with one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Lf_ManPar_t_ Lf_ManPar_t;
+struct Lf_ManPar_t_
+{
+    Lf_Man_t *      pMan;            // mapping manager
+    Lf_Man_t *      pViews;          // shallow copies of the manager (one per thread)
+    int             nThreads;        // the number of threads
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;           // the barrier after each step
+    pthread_cond_t  Cond;
+#endif
+    int             nWaiting;        // the number of threads waiting at the barrier
+    int             Phase;           // the number of barriers passed
+};
+static void Lf_ManParBarrier( Lf_ManPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int Phase;
+    pthread_mutex_lock( &p->Mutex );
+    Phase = p->Phase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->Phase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+        while ( Phase == p->Phase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+static inline void Lf_ManParRemapCut( Lf_Man_t * pView, Lf_Cut_t * pCut )
+{
+    if ( pCut->iFunc >= 0 && Lf_CutIsNew(pView, pCut) )
+        pCut->iFunc = Abc_Var2Lit( Vec_IntEntry(pView->vTtIds, Abc_Lit2Var(pCut->iFunc) - pView->iTtNew), Abc_LitIsCompl(pCut->iFunc) );
+}
+static void Lf_ManParCommitCuts( Lf_Man_t * p, Lf_Man_t * pView, int Beg, int End )
+{
+    Gia_Obj_t * pObj;
+    Lf_Bst_t * pBest;
+    Lf_Cut_t * pCutSet, * pCut;
+    int nWords = p->vTtMem ? Vec_MemEntrySize(p->vTtMem) : 1;
+    int k, c, iObj, Handle0, Handle1, iSet = 0;
+    // add the new truth tables to the store
+    Vec_IntClear( pView->vTtIds );
+    for ( k = 0; pView->vTtNew && k < Vec_WrdSize(pView->vTtNew) / nWords; k++ )
+        Vec_IntPush( pView->vTtIds, Vec_MemHashInsert(p->vTtMem, Vec_WrdEntryP(pView->vTtNew, nWords * k)) );
+    for ( k = Beg; k < End; k++ )
+    {
+        iObj  = Vec_IntEntry( p->vLevOrder, k );
+        pObj  = Gia_ManObj( p->pGia, iObj );
+        pBest = Lf_ObjReadBest( p, iObj );
+        // dereference the fanin cutsets
+        if ( Lf_ObjOff(p, Gia_ObjFaninId0(pObj, iObj)) != -1 )
+            Lf_ManFetchSet( p, Gia_ObjFaninId0(pObj, iObj) );
+        if ( Lf_ObjOff(p, Gia_ObjFaninId1(pObj, iObj)) != -1 )
+            Lf_ManFetchSet( p, Gia_ObjFaninId1(pObj, iObj) );
+        if ( Gia_ObjIsMuxId(p->pGia, iObj) && Lf_ObjOff(p, Gia_ObjFaninId2(p->pGia, iObj)) != -1 )
+            Lf_ManFetchSet( p, Gia_ObjFaninId2(p->pGia, iObj) );
+        // save the best cuts
+        Handle0 = pBest->Cut[0].Handle;
+        Handle1 = pBest->Cut[1].Handle;
+        pCut = (Lf_Cut_t *)Vec_WrdEntryP( pView->vCutBuf, Handle0 );
+        Lf_ManParRemapCut( pView, pCut );
+        pBest->Cut[0].Handle = pBest->Cut[1].Handle = Lf_MemSaveCut( &p->vStoreNew, pCut, iObj );
+        if ( Handle1 != Handle0 )
+        {
+            pCut = (Lf_Cut_t *)Vec_WrdEntryP( pView->vCutBuf, Handle1 );
+            Lf_ManParRemapCut( pView, pCut );
+            pBest->Cut[1].Handle = Lf_MemSaveCut( &p->vStoreNew, pCut, iObj );
+        }
+        if ( pObj->Value == 0 )
+            continue;
+        // move the cutset
+        pCutSet = Lf_ManFetchSet( p, iObj );
+        memcpy( pCutSet, Vec_WrdEntryP(pView->vSetBuf, p->nSetWords * iSet++), sizeof(word) * p->nSetWords );
+        Lf_CutSetForEachCut( p->nCutWords, pCutSet, pCut, c, p->pPars->nCutNum )
+            if ( pCut->nLeaves != LF_NO_LEAF )
+                Lf_ManParRemapCut( pView, pCut );
+    }
+    assert( iSet * p->nSetWords == Vec_WrdSize(pView->vSetBuf) );
+}
+static void Lf_ManParRecycleOld( Lf_Man_t * p, int iObjNext )
+{
+    Lf_Mem_t * pStore = &p->vStoreOld;
+    int Page = Lf_ObjReadBest(p, iObjNext)->Cut[0].Handle >> pStore->LogPage;
+    // the cuts of the remaining nodes are stored on this page or later
+    for ( Page--; Page >= 0 && Vec_PtrEntry(&pStore->vPages, Page); Page-- )
+    {
+        Gia_MmPageRecycle( pStore->pMemPages, (char *)Vec_PtrEntry(&pStore->vPages, Page) );
+        Vec_PtrWriteEntry( &pStore->vPages, Page, NULL );
+    }
+}
+static void Lf_ManParProcess( Lf_ManPar_t * p, int iThread )
+{
+    Lf_Man_t * pMan  = p->pMan;
+    Lf_Man_t * pView = p->pViews + iThread;
+    int Level, Beg, End, k, i;
+    for ( Level = 1; Level + 1 < Vec_IntSize(pMan->vLevStarts); Level++ )
+    {
+        Beg = Vec_IntEntry( pMan->vLevStarts, Level );
+        End = Vec_IntEntry( pMan->vLevStarts, Level + 1 );
+        if ( Beg == End )
+            continue;
+        if ( iThread == 0 )
+            for ( i = 0; i < p->nThreads; i++ )
+            {
+                Vec_WrdClear( p->pViews[i].vCutBuf );
+                Vec_WrdClear( p->pViews[i].vSetBuf );
+                if ( pMan->vTtMem )
+                {
+                    Vec_WrdClear( p->pViews[i].vTtNew );
+                    p->pViews[i].iTtNew = Vec_MemEntryNum( pMan->vTtMem );
+                }
+                // the array may have been reallocated by the previous level
+                p->pViews[i].vMemSets = pMan->vMemSets;
+            }
+        Lf_ManParBarrier( p );
+        for ( k = Beg + (End - Beg) * iThread / p->nThreads; k < Beg + (End - Beg) * (iThread + 1) / p->nThreads; k++ )
+            Lf_ObjMergeOrder( pView, Vec_IntEntry(pMan->vLevOrder, k) );
+        Lf_ManParBarrier( p );
+        if ( iThread > 0 )
+            continue;
+        for ( i = 0; i < p->nThreads; i++ )
+            Lf_ManParCommitCuts( pMan, p->pViews + i, Beg + (End - Beg) * i / p->nThreads, Beg + (End - Beg) * (i + 1) / p->nThreads );
+        if ( pMan->vStoreOld.fLevOrder && End < Vec_IntSize(pMan->vLevOrder) )
+            Lf_ManParRecycleOld( pMan, Vec_IntEntry(pMan->vLevOrder, End) );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+typedef struct Lf_ManThr_t_ Lf_ManThr_t;
+struct Lf_ManThr_t_
+{
+    Lf_ManPar_t *   p;
+    int             iThread;
+};
+static void * Lf_ManParWorkerThread( void * pArg )
+{
+    Lf_ManThr_t * pThData = (Lf_ManThr_t *)pArg;
+    Lf_ManParProcess( pThData->p, pThData->iThread );
+    return NULL;
+}
+#endif
+void Lf_ManComputePar( Lf_Man_t * pMan )
+{
+#ifdef ABC_USE_PTHREADS
+    Lf_ManPar_t Par, * p = &Par;
+    pthread_t WorkerThread[LF_PROC_MAX];
+    Lf_ManThr_t ThData[LF_PROC_MAX];
+    int i, k, status;
+    assert( pMan->vLevOrder != NULL );
+    memset( p, 0, sizeof(Lf_ManPar_t) );
+    p->pMan     = pMan;
+    p->nThreads = Abc_MinInt( pMan->pPars->nProcNum, LF_PROC_MAX );
+    p->pViews   = ABC_ALLOC( Lf_Man_t, p->nThreads );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        memcpy( p->pViews + i, pMan, sizeof(Lf_Man_t) );
+        memset( p->pViews[i].CutCount, 0, sizeof(double) * 4 );
+        memset( p->pViews[i].nCutCounts, 0, sizeof(int) * (LF_LEAF_MAX+1) );
+        p->pViews[i].nTimeFails = 0;
+        p->pViews[i].nCutEqual  = 0;
+        p->pViews[i].vCutBuf = Vec_WrdAlloc( 1000 );
+        p->pViews[i].vSetBuf = Vec_WrdAlloc( 1000 );
+        p->pViews[i].vTtNew  = pMan->vTtMem ? Vec_WrdAlloc( 100 ) : NULL;
+        p->pViews[i].vTtIds  = Vec_IntAlloc( 100 );
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Lf_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    // collect the statistics
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        for ( k = 0; k < 4; k++ )
+            pMan->CutCount[k] += p->pViews[i].CutCount[k];
+        for ( k = 0; k <= LF_LEAF_MAX; k++ )
+            pMan->nCutCounts[k] += p->pViews[i].nCutCounts[k];
+        pMan->nTimeFails += p->pViews[i].nTimeFails;
+        pMan->nCutEqual  += p->pViews[i].nCutEqual;
+        Vec_WrdFree( p->pViews[i].vCutBuf );
+        Vec_WrdFree( p->pViews[i].vSetBuf );
+        Vec_WrdFreeP( &p->pViews[i].vTtNew );
+        Vec_IntFree( p->pViews[i].vTtIds );
+    }
+    ABC_FREE( p->pViews );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Lf_ManComputeMapping( Lf_Man_t * p )
 {
     Gia_Obj_t * pObj;
     int i, arrTime;
     assert( p->vStoreNew.iCur == 0 );
     Lf_ManSetCutRefs( p );
-    if ( p->pGia->pManTime != NULL )
+    p->vStoreNew.fLevOrder = p->vLevOrder && !p->fUseEla;
+    if ( p->vStoreNew.fLevOrder )
+        Lf_ManComputePar( p );
+    else if ( p->pGia->pManTime != NULL )
     {
         assert( !Gia_ManBufNum(p->pGia) );
         Tim_ManIncrementTravId( (Tim_Man_t*)p->pGia->pManTime );
@@ -2201,6 +2509,7 @@ Gia_Man_t * Lf_ManPerformMappingInt( Gia_Man_t * pGia, Jf_Par_t * pPars )
         printf( "Derived " );  Gia_ManPrintMuxStats( pCls );  printf( "\n" );
     }
     Lf_ManPrintInit( p );
+    Lf_ManParCheck( p );
 
     // power mode
     if ( fUsePowerMode && Vec_FltSize(&p->vSwitches) )
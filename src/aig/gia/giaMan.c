@@ -25,6 +25,9 @@
 #include "proof/abs/abs.h"
 #include "opt/dar/dar.h"
 #include "misc/extra/extra.h"
+#include "aig/gia/giaAig.h"
+#include "map/if/if.h"
+#include "proof/cec/cec.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -99,6 +102,9 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_WrdFreeP( &p->vSimsT );
     Vec_WrdFreeP( &p->vSimsPi );
     Vec_WrdFreeP( &p->vSimsPo );
+    Vec_WecFreeP( &p->vSimFanouts );
+    Vec_IntFreeP( &p->vSimChanged );
+    Vec_BitFreeP( &p->vSimMarks );
     Vec_IntFreeP( &p->vTimeStamps );
     Vec_FltFreeP( &p->vTiming );
     Vec_VecFreeP( &p->vClockDoms );
@@ -148,6 +154,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntFreeP( &p->vCoArrs );
     Vec_IntFreeP( &p->vCoAttrs );
     Gia_ManStopP( &p->pAigExtra );
+    Vec_StrFreeP( &p->vAigerExtra );
     Vec_IntFree( p->vCis );
     Vec_IntFree( p->vCos );
     Vec_IntErase( &p->vHash );
@@ -1410,6 +1417,86 @@ void Gia_ManDumpVerilog( Gia_Man_t * p, char * pFileName, Vec_Int_t * vObjs )
     Vec_BitFree( vUsed );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks the core passes in the current object indexing mode.]
+
+  Description [Runs AIGER writing/reading, &st, &dc2, &if -K <nLutSize>,
+  and &cec (of the &st and &dc2 results) on the AIG, reporting the memory
+  of the result and the runtime of each pass. Comparing the output of the
+  binaries built with and without ABC_USE_WIDE_GIA shows the cost of the
+  wide object indexing mode.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManBenchPrint( char * pName, Gia_Man_t * p, abctime clk )
+{
+    Abc_Print( 1, "%-6s: Obj =%11d  ObjMem =%9.2f MB  Mem =%9.2f MB  ", pName, 
+        Gia_ManObjNum(p), 1.0 * sizeof(Gia_Obj_t) * p->nObjsAlloc / (1<<20), Gia_ManMemory(p)/(1<<20) );
+    Abc_PrintTime( 1, "Time", clk );
+}
+void Gia_ManBenchCore( Gia_Man_t * p, int nLutSize, int fVerbose )
+{
+    Gia_Man_t * pAig, * pSt, * pDc2, * pMap, * pMiter;
+    Cec_ParCec_t ParsCec, * pParsCec = &ParsCec;
+    If_Par_t Pars, * pPars = &Pars;
+    Vec_Str_t * vStr;
+    abctime clk, clkTotal = Abc_Clock();
+    int RetValue;
+#ifdef ABC_USE_WIDE_GIA
+    Abc_Print( 1, "Object indexing mode: wide" );
+#else
+    Abc_Print( 1, "Object indexing mode: compact" );
+#endif
+    Abc_Print( 1, " (object = %d bytes, max objects = %d).\n", (int)sizeof(Gia_Obj_t), GIA_OBJ_MAX );
+    // AIGER I/O
+    clk = Abc_Clock();
+    vStr = Gia_AigerWriteIntoMemoryStr( p );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "AIGER writing", Abc_Clock() - clk );
+    pAig = Gia_AigerReadFromMemory( Vec_StrArray(vStr), Vec_StrSize(vStr), 0, 0, 0 );
+    Vec_StrFree( vStr );
+    Gia_ManBenchPrint( "aiger", pAig, Abc_Clock() - clk );
+    // &st
+    clk = Abc_Clock();
+    pSt = Gia_ManRehash( pAig, 0 );
+    Gia_ManBenchPrint( "&st", pSt, Abc_Clock() - clk );
+    Gia_ManStop( pAig );
+    // &dc2
+    clk = Abc_Clock();
+    pDc2 = Gia_ManCompress2( pSt, 1, 0 );
+    Gia_ManBenchPrint( "&dc2", pDc2, Abc_Clock() - clk );
+    // &if
+    clk = Abc_Clock();
+    Gia_ManSetIfParsDefault( pPars );
+    pPars->pLutLib  = NULL;
+    pPars->nLutSize = nLutSize;
+    pMap = Gia_ManPerformMapping( pDc2, pPars );
+    Gia_ManBenchPrint( "&if", pMap, Abc_Clock() - clk );
+    if ( fVerbose )
+        Abc_Print( 1, "The mapping has %d LUTs.\n", Gia_ManLutNum(pMap) );
+    Gia_ManStop( pMap );
+    // &cec
+    clk = Abc_Clock();
+    pMiter = Gia_ManMiter( pSt, pDc2, 0, 1, 0, 0, 0 );
+    if ( pMiter )
+    {
+        Cec_ManCecSetDefaultParams( pParsCec );
+        pParsCec->fSilent = 1;
+        RetValue = Cec_ManVerify( pMiter, pParsCec );
+        Gia_ManBenchPrint( "&cec", pMiter, Abc_Clock() - clk );
+        if ( RetValue != 1 )
+            Abc_Print( 1, "Equivalence checking of &st and &dc2 results %s.\n", RetValue == 0 ? "has failed" : "is undecided" );
+        Gia_ManStop( pMiter );
+    }
+    Gia_ManStop( pDc2 );
+    Gia_ManStop( pSt );
+    Abc_PrintTime( 1, "Total time", Abc_Clock() - clkTotal );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -77,6 +77,15 @@ struct Gia_MmStep_t_
     char **       pChunks;       // the allocated memory
 };
 
+struct Gia_MmPage_t_
+{
+    int           nPageSize;     // the size of one page in bytes
+    int           nPagesUsed;    // the number of pages in use
+    int           nPagesMax;     // the max number of pages in use
+    Vec_Ptr_t *   vPages;        // the allocated pages
+    Vec_Ptr_t *   vFree;         // the pages ready for reuse
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -591,6 +600,129 @@ int Gia_MmStepReadMemUsage( Gia_MmStep_t * p )
     return nMemTotal;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the manager of memory pages.]
+
+  Description [The pages have the same size (2^LogPageSize bytes) and are 
+  handed out one at a time. This manager is shared by the cut stores of 
+  the mappers, which fill the pages with cuts during one mapping round and
+  recycle them before the next round, so that the pages are allocated once
+  for all rounds.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_MmPage_t * Gia_MmPageStart( int LogPageSize )
+{
+    Gia_MmPage_t * p;
+    assert( LogPageSize >= 4 && LogPageSize < 31 );
+    p = ABC_CALLOC( Gia_MmPage_t, 1 );
+    p->nPageSize = (1 << LogPageSize);
+    p->vPages    = Vec_PtrAlloc( 256 );
+    p->vFree     = Vec_PtrAlloc( 256 );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the manager and releases all pages.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_MmPageStop( Gia_MmPage_t * p, int fVerbose )
+{
+    if ( p == NULL )
+        return;
+    if ( fVerbose )
+        printf( "Page memory manager: Page = %d. Pages used = %d. Pages peak = %d. Memory alloc = %.2f MB.\n",
+            p->nPageSize, p->nPagesUsed, p->nPagesMax, Gia_MmPageReadMemUsage(p) / (1<<20) );
+    Vec_PtrFreeFree( p->vPages );
+    Vec_PtrFree( p->vFree );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns a page, reusing a recycled one if possible.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_MmPageFetch( Gia_MmPage_t * p )
+{
+    char * pPage;
+    if ( Vec_PtrSize(p->vFree) )
+        pPage = (char *)Vec_PtrPop( p->vFree );
+    else
+    {
+        pPage = ABC_ALLOC( char, p->nPageSize );
+        Vec_PtrPush( p->vPages, pPage );
+    }
+    p->nPagesUsed++;
+    if ( p->nPagesMax < p->nPagesUsed )
+        p->nPagesMax = p->nPagesUsed;
+    return pPage;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recycles one page or all pages of a cut store.]
+
+  Description [When recycling the pages of a store, the entries equal to 
+  NULL (the pages already recycled) are skipped and the array is cleaned.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_MmPageRecycle( Gia_MmPage_t * p, char * pPage )
+{
+    assert( p->nPagesUsed > 0 );
+    p->nPagesUsed--;
+    Vec_PtrPush( p->vFree, pPage );
+}
+void Gia_MmPageRecycleAll( Gia_MmPage_t * p, Vec_Ptr_t * vStore )
+{
+    char * pPage; int i;
+    Vec_PtrForEachEntry( char *, vStore, pPage, i )
+        if ( pPage )
+            Gia_MmPageRecycle( p, pPage );
+    Vec_PtrClear( vStore );
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_MmPageReadPageSize( Gia_MmPage_t * p )
+{
+    return p->nPageSize;
+}
+double Gia_MmPageReadMemUsage( Gia_MmPage_t * p )
+{
+    return 1.0 * p->nPageSize * Vec_PtrSize(p->vPages);
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
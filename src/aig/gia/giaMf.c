@@ -25,6 +25,15 @@
 #include "sat/cnf/cnf.h"
 #include "opt/dau/dau.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -38,6 +47,8 @@ ABC_NAMESPACE_IMPL_START
 #define MF_TT_WORDS  ((MF_LEAF_MAX > 6) ? 1 << (MF_LEAF_MAX-6) : 1)
 #define MF_NO_FUNC    134217727     // (1<<27)-1
 #define MF_EPSILON 0.005
+#define MF_PROC_MAX  64
+#define MF_PAR_WIDTH 16   // the min average number of nodes per level and thread
 
 typedef struct Mf_Cut_t_ Mf_Cut_t; 
 struct Mf_Cut_t_
@@ -67,6 +78,7 @@ struct Mf_Man_t_
     Jf_Par_t *      pPars;          // parameters
     // cut data
     Mf_Obj_t *      pLfObjs;        // best cuts
+    Gia_MmPage_t *  pMemPages;      // memory pages
     Vec_Ptr_t       vPages;         // cut memory
     Vec_Mem_t *     vTtMem;         // truth tables
     Vec_Int_t       vCnfSizes;      // handles to CNF
@@ -75,6 +87,13 @@ struct Mf_Man_t_
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    // parallel cut computation
+    Vec_Int_t *     vLevOrder;      // internal nodes in the order of levels
+    Vec_Int_t *     vLevStarts;     // the first node of each level in vLevOrder
+    Vec_Int_t *     vCutBuf;        // cutsets computed by a worker thread
+    Vec_Wrd_t *     vTtNew;         // truth tables found by a worker thread
+    Vec_Int_t *     vCnfNew;        // the CNF sizes of these truth tables
+    int             iTtNew;         // the truth table ID of the first entry in vTtNew
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
@@ -540,12 +559,46 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
   SeeAlso     []
 
 ***********************************************************************/
+static inline word * Mf_ManTruth( Mf_Man_t * p, int iFunc )
+{
+    int Id = Abc_Lit2Var(iFunc);
+    if ( p->vTtNew && Id >= p->iTtNew )
+        return Vec_WrdEntryP( p->vTtNew, Vec_MemEntrySize(p->vTtMem) * (Id - p->iTtNew) );
+    return Vec_MemReadEntry( p->vTtMem, Id );
+}
+static inline int Mf_ManCnfSize( Mf_Man_t * p, int Id )
+{
+    if ( p->vTtNew && Id >= p->iTtNew )
+        return Vec_IntEntry( p->vCnfNew, Id - p->iTtNew );
+    return Vec_IntEntry( &p->vCnfSizes, Id );
+}
+static inline int Mf_ManTruthInsert( Mf_Man_t * p, word * pTruth, int nVars )
+{
+    int i, * pSpot, truthId, nWords = Vec_MemEntrySize(p->vTtMem);
+    int fCnfSize = p->pPars->fGenCnf && p->pPars->nLutSize <= 8;
+    if ( p->vTtNew == NULL )
+    {
+        truthId = Vec_MemHashInsert( p->vTtMem, pTruth );
+        if ( fCnfSize && truthId == Vec_IntSize(&p->vCnfSizes) )
+            Vec_IntPush( &p->vCnfSizes, p->pPars->nLutSize <= 6 ? Abc_Tt6CnfSize(*pTruth, nVars) : Abc_Tt8CnfSize(pTruth, nVars) );
+        return truthId;
+    }
+    // worker threads do not update the table; new functions get temporary IDs
+    pSpot = Vec_MemHashLookup( p->vTtMem, pTruth );
+    if ( *pSpot != -1 )
+        return *pSpot;
+    for ( i = 0; i < nWords; i++ )
+        Vec_WrdPush( p->vTtNew, pTruth[i] );
+    if ( fCnfSize )
+        Vec_IntPush( p->vCnfNew, p->pPars->nLutSize <= 6 ? Abc_Tt6CnfSize(*pTruth, nVars) : Abc_Tt8CnfSize(pTruth, nVars) );
+    return p->iTtNew + Vec_WrdSize(p->vTtNew) / nWords - 1;
+}
 static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, int fCompl0, int fCompl1, Mf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Mf_ManTruthCanonicize( word * t, int nVars );
     int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
+    word t0 = *Mf_ManTruth(p, pCut0->iFunc);
+    word t1 = *Mf_ManTruth(p, pCut1->iFunc);
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     t0 = Abc_Tt6Expand( t0, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
@@ -555,10 +608,8 @@ static inline int Mf_CutComputeTruth6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t
     if ( !p->pPars->fCnfObjIds )
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTruthInsert(p, &t, pCutR->nLeaves);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
 //    p->nCutMux += Mf_ManTtIsMux( t );
     assert( (int)pCutR->nLeaves <= nOldSupp );
 //    Mf_ManTruthCanonicize( &t, pCutR->nLeaves );
@@ -573,8 +624,8 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     int nOldSupp   = pCutR->nLeaves, truthId;
     int LutSize    = p->pPars->nLutSize, fCompl;
     int nWords     = Abc_Truth6WordNum(LutSize);
-    word * pTruth0 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word * pTruth1 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
+    word * pTruth0 = Mf_ManTruth(p, pCut0->iFunc);
+    word * pTruth1 = Mf_ManTruth(p, pCut1->iFunc);
     Abc_TtCopy( uTruth0, pTruth0, nWords, Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 );
     Abc_TtCopy( uTruth1, pTruth1, nWords, Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 );
     Abc_TtExpand( uTruth0, LutSize, pCut0->pLeaves, pCut0->nLeaves, pCutR->pLeaves, pCutR->nLeaves );
@@ -586,10 +637,8 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
 //Kit_DsdPrintFromTruth( uTruth, pCutR->nLeaves ), printf("\n" ), printf("\n" );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTruthInsert(p, uTruth, pCutR->nLeaves);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
     }
@@ -597,9 +646,9 @@ static inline int Mf_CutComputeTruth( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t *
 static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_t * pCut1, Mf_Cut_t * pCutC, int fCompl0, int fCompl1, int fComplC, Mf_Cut_t * pCutR )
 {
     int nOldSupp = pCutR->nLeaves, truthId, fCompl; word t;
-    word t0 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word t1 = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
-    word tC = *Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
+    word t0 = *Mf_ManTruth(p, pCut0->iFunc);
+    word t1 = *Mf_ManTruth(p, pCut1->iFunc);
+    word tC = *Mf_ManTruth(p, pCutC->iFunc);
     if ( Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 ) t0 = ~t0;
     if ( Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 ) t1 = ~t1;
     if ( Abc_LitIsCompl(pCutC->iFunc) ^ fComplC ) tC = ~tC;
@@ -610,10 +659,8 @@ static inline int Mf_CutComputeTruthMux6( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Mf_ManTruthInsert(p, &t, pCutR->nLeaves);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt6CnfSize(t, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
 }
@@ -626,9 +673,9 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     int nOldSupp   = pCutR->nLeaves, truthId;
     int LutSize    = p->pPars->nLutSize, fCompl;
     int nWords     = Abc_Truth6WordNum(LutSize);
-    word * pTruth0 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut0->iFunc));
-    word * pTruth1 = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCut1->iFunc));
-    word * pTruthC = Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(pCutC->iFunc));
+    word * pTruth0 = Mf_ManTruth(p, pCut0->iFunc);
+    word * pTruth1 = Mf_ManTruth(p, pCut1->iFunc);
+    word * pTruthC = Mf_ManTruth(p, pCutC->iFunc);
     Abc_TtCopy( uTruth0, pTruth0, nWords, Abc_LitIsCompl(pCut0->iFunc) ^ fCompl0 );
     Abc_TtCopy( uTruth1, pTruth1, nWords, Abc_LitIsCompl(pCut1->iFunc) ^ fCompl1 );
     Abc_TtCopy( uTruthC, pTruthC, nWords, Abc_LitIsCompl(pCutC->iFunc) ^ fComplC );
@@ -640,10 +687,8 @@ static inline int Mf_CutComputeTruthMux( Mf_Man_t * p, Mf_Cut_t * pCut0, Mf_Cut_
     if ( fCompl ) Abc_TtNot( uTruth, nWords );
     pCutR->nLeaves = Abc_TtMinBase( uTruth, pCutR->pLeaves, pCutR->nLeaves, LutSize );
     assert( (uTruth[0] & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, uTruth);
+    truthId        = Mf_ManTruthInsert(p, uTruth, pCutR->nLeaves);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
-    if ( p->pPars->fGenCnf && truthId == Vec_IntSize(&p->vCnfSizes) && LutSize <= 8 )
-        Vec_IntPush( &p->vCnfSizes, Abc_Tt8CnfSize(uTruth, pCutR->nLeaves) );
     assert( (int)pCutR->nLeaves <= nOldSupp );
     return (int)pCutR->nLeaves < nOldSupp;
     }
@@ -726,17 +771,32 @@ static inline int Mf_ManPrepareCuts( Mf_Cut_t * pCuts, Mf_Man_t * p, int iObj, i
     }
     return Mf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+static inline int Mf_ManAllocCutSet( Mf_Man_t * p, int nInts )
 {
-    int i, * pPlace, iCur, nInts = 1;
-    for ( i = 0; i < nCuts; i++ )
-        nInts += pCuts[i]->nLeaves + 1;
+    int iCur;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
         p->iCur = ((p->iCur >> 16) + 1) << 16;
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
-        Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
+        Vec_PtrPush( &p->vPages, Gia_MmPageFetch(p->pMemPages) );
     iCur = p->iCur; p->iCur += nInts;
-    pPlace = Mf_ManCutSet( p, iCur );
+    return iCur;
+}
+static inline int Mf_ManSaveCuts( Mf_Man_t * p, Mf_Cut_t ** pCuts, int nCuts )
+{
+    int i, * pPlace, iCur, nInts = 1;
+    for ( i = 0; i < nCuts; i++ )
+        nInts += pCuts[i]->nLeaves + 1;
+    if ( p->vCutBuf ) // worker thread; the cutset is moved into the cut memory later
+    {
+        iCur = Vec_IntSize( p->vCutBuf );
+        Vec_IntFillExtra( p->vCutBuf, iCur + nInts, 0 );
+        pPlace = Vec_IntEntryP( p->vCutBuf, iCur );
+    }
+    else
+    {
+        iCur = Mf_ManAllocCutSet( p, nInts );
+        pPlace = Mf_ManCutSet( p, iCur );
+    }
     *pPlace++ = nCuts;
     for ( i = 0; i < nCuts; i++ )
     {
@@ -999,7 +1059,7 @@ static inline int Mf_CutArea( Mf_Man_t * p, int nLeaves, int iFunc )
     if ( nLeaves < 2 )
         return 0;
     if ( p->pPars->fGenCnf )
-        return Vec_IntEntry(&p->vCnfSizes, Abc_Lit2Var(iFunc));
+        return Mf_ManCnfSize(p, Abc_Lit2Var(iFunc));
     if ( p->pPars->fOptEdge )
         return nLeaves + p->pPars->nAreaTuner;
     return 1;
@@ -1392,6 +1452,7 @@ Mf_Man_t * Mf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     p->pPars     = pPars;
     p->vTtMem    = pPars->fCutMin ? Vec_MemAllocForTT( pPars->nLutSize, 0 ) : NULL;
     p->pLfObjs   = ABC_CALLOC( Mf_Obj_t, Gia_ManObjNum(pGia) );
+    p->pMemPages = Gia_MmPageStart( 18 );
     p->iCur      = 2;
     Vec_PtrGrow( &p->vPages, 256 );
     if ( pPars->fGenCnf )
@@ -1415,7 +1476,9 @@ void Mf_ManFree( Mf_Man_t * p )
         Vec_MemHashFree( p->vTtMem );
     if ( p->pPars->fCutMin )
         Vec_MemFree( p->vTtMem );
-    Vec_PtrFreeData( &p->vPages );
+    Gia_MmPageStop( p->pMemPages, 0 );
+    Vec_IntFreeP( &p->vLevOrder );
+    Vec_IntFreeP( &p->vLevStarts );
     ABC_FREE( p->vCnfSizes.pArray );
     ABC_FREE( p->vCnfMem.pArray );
     ABC_FREE( p->vPages.pArray );
@@ -1458,6 +1521,7 @@ void Mf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  MF_LEAF_MAX;
     pPars->nCutNumMax   =  MF_CUT_MAX;
+    pPars->nProcNumMax  =  MF_PROC_MAX;
 }
 void Mf_ManPrintStats( Mf_Man_t * p, char * pTitle )
 {
@@ -1491,7 +1555,7 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
 {
     float MemGia   = Gia_ManMemory(p->pGia) / (1<<20);
     float MemMan   = 1.0 * sizeof(Mf_Obj_t) * Gia_ManObjNum(p->pGia) / (1<<20);
-    float MemCuts  = 1.0 * sizeof(int) * (1 << 16) * Vec_PtrSize(&p->vPages) / (1<<20);
+    float MemCuts  = Gia_MmPageReadMemUsage(p->pMemPages) / (1<<20);
     float MemTt    = p->vTtMem ? Vec_MemMemory(p->vTtMem) / (1<<20) : 0;
     float MemMap   = Vec_IntMemory(pNew->vMapping) / (1<<20);
     if ( p->CutCount[0] == 0 )
@@ -1521,14 +1585,6 @@ void Mf_ManPrintQuit( Mf_Man_t * p, Gia_Man_t * pNew )
     }
     fflush( stdout );
 }
-void Mf_ManComputeCuts( Mf_Man_t * p )
-{
-    int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
-    Mf_ManSetMapRefs( p );
-    Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
-}
 
 /**Function*************************************************************
 
@@ -1633,6 +1689,225 @@ static inline void Mf_ObjComputeBestCut( Mf_Man_t * p, int iObj )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if cut computation and mapping can use several threads.]
+
+  Description [The nodes on the same level do not depend on each other 
+  during cut computation and in the area-flow rounds. Choices and buffers
+  are not supported. If several threads can be used, computes the level 
+  order of the nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Mf_ManParCheck( Mf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pPars->nProcNum < 2 || Gia_ManHasChoices(p->pGia) || Gia_ManBufNum(p->pGia) > 0 )
+        return 0;
+    p->vLevOrder = Gia_ManLevelOrder( p->pGia, &p->vLevStarts );
+    if ( Gia_ManAndNum(p->pGia) >= MF_PAR_WIDTH * p->pPars->nProcNum * (Vec_IntSize(p->vLevStarts) - 2) )
+        return 1;
+    Vec_IntFreeP( &p->vLevOrder );
+    Vec_IntFreeP( &p->vLevStarts );
+#endif
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts or best cuts using several threads.]
+
+  Description [The nodes are processed level by level and each thread 
+  works on its slice of the level. When computing cuts (Mode 0), each 
+  thread uses a copy of the manager, which collects the cutsets, the new
+  truth tables and the statistics. After each level, the first thread 
+  adds the truth tables to the store and moves the cutsets into the cut 
+  memory, in the order of the nodes. When selecting the best cuts in 
+  the area-flow rounds (Mode 1), the threads share the manager because 
+  each node only updates its own data. The result is the same as with 
+  one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Mf_ManPar_t_ Mf_ManPar_t;
+struct Mf_ManPar_t_
+{
+    Mf_Man_t *      pMan;           // mapping manager
+    Mf_Man_t *      pViews;         // shallow copies of the manager (one per thread)
+    int             nThreads;       // the number of threads
+    int             Mode;           // cuts (0) or best cuts (1)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;          // the barrier after each step
+    pthread_cond_t  Cond;
+#endif
+    int             nWaiting;       // the number of threads waiting at the barrier
+    int             Phase;          // the number of barriers passed
+};
+static void Mf_ManParBarrier( Mf_ManPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int Phase;
+    pthread_mutex_lock( &p->Mutex );
+    Phase = p->Phase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->Phase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+        while ( Phase == p->Phase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+static void Mf_ManParCommitCuts( Mf_Man_t * p, Mf_Man_t * pView, int Beg, int End )
+{
+    int nWords = p->vTtMem ? Vec_MemEntrySize(p->vTtMem) : 1;
+    int k, c, iObj, iFunc, iCur, nInts, * pList, * pCut;
+    // add the new truth tables to the store
+    Vec_IntClear( &p->vTemp );
+    for ( k = 0; pView->vTtNew && k < Vec_WrdSize(pView->vTtNew) / nWords; k++ )
+    {
+        iFunc = Vec_MemHashInsert( p->vTtMem, Vec_WrdEntryP(pView->vTtNew, nWords * k) );
+        if ( Vec_IntSize(pView->vCnfNew) && iFunc == Vec_IntSize(&p->vCnfSizes) )
+            Vec_IntPush( &p->vCnfSizes, Vec_IntEntry(pView->vCnfNew, k) );
+        Vec_IntPush( &p->vTemp, iFunc );
+    }
+    // move the cutsets
+    for ( k = Beg; k < End; k++ )
+    {
+        iObj  = Vec_IntEntry( p->vLevOrder, k );
+        pList = Vec_IntEntryP( pView->vCutBuf, Mf_ManObj(p, iObj)->iCutSet );
+        Mf_SetForEachCut( pList, pCut, c )
+        {
+            iFunc = Mf_CutFunc( pCut );
+            if ( p->vTtMem && Abc_Lit2Var(iFunc) >= pView->iTtNew )
+                pCut[0] = Mf_CutSetBoth( Mf_CutSize(pCut), Abc_Var2Lit(Vec_IntEntry(&p->vTemp, Abc_Lit2Var(iFunc) - pView->iTtNew), Abc_LitIsCompl(iFunc)) );
+        }
+        nInts = pCut - pList;
+        iCur  = Mf_ManAllocCutSet( p, nInts );
+        memcpy( Mf_ManCutSet(p, iCur), pList, sizeof(int) * nInts );
+        Mf_ManObj(p, iObj)->iCutSet = iCur;
+    }
+}
+static void Mf_ManParProcess( Mf_ManPar_t * p, int iThread )
+{
+    Mf_Man_t * pMan  = p->pMan;
+    Mf_Man_t * pView = p->pViews ? p->pViews + iThread : pMan;
+    int Level, Beg, End, k, i;
+    for ( Level = 1; Level + 1 < Vec_IntSize(pMan->vLevStarts); Level++ )
+    {
+        Beg = Vec_IntEntry( pMan->vLevStarts, Level );
+        End = Vec_IntEntry( pMan->vLevStarts, Level + 1 );
+        if ( Beg == End )
+            continue;
+        if ( p->Mode == 0 && iThread == 0 )
+            for ( i = 0; i < p->nThreads; i++ )
+            {
+                Vec_IntClear( p->pViews[i].vCutBuf );
+                if ( pMan->vTtMem )
+                {
+                    Vec_WrdClear( p->pViews[i].vTtNew );
+                    Vec_IntClear( p->pViews[i].vCnfNew );
+                    p->pViews[i].iTtNew = Vec_MemEntryNum( pMan->vTtMem );
+                }
+                // the arrays may have been reallocated by the previous level
+                p->pViews[i].vPages    = pMan->vPages;
+                p->pViews[i].vCnfSizes = pMan->vCnfSizes;
+            }
+        Mf_ManParBarrier( p );
+        for ( k = Beg + (End - Beg) * iThread / p->nThreads; k < Beg + (End - Beg) * (iThread + 1) / p->nThreads; k++ )
+            if ( p->Mode == 0 )
+                Mf_ObjMergeOrder( pView, Vec_IntEntry(pMan->vLevOrder, k) );
+            else
+                Mf_ObjComputeBestCut( pView, Vec_IntEntry(pMan->vLevOrder, k) );
+        if ( p->Mode == 1 )
+            continue;
+        Mf_ManParBarrier( p );
+        if ( iThread == 0 )
+            for ( i = 0; i < p->nThreads; i++ )
+                Mf_ManParCommitCuts( pMan, p->pViews + i, Beg + (End - Beg) * i / p->nThreads, Beg + (End - Beg) * (i + 1) / p->nThreads );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+typedef struct Mf_ManThr_t_ Mf_ManThr_t;
+struct Mf_ManThr_t_
+{
+    Mf_ManPar_t *   p;
+    int             iThread;
+};
+static void * Mf_ManParWorkerThread( void * pArg )
+{
+    Mf_ManThr_t * pThData = (Mf_ManThr_t *)pArg;
+    Mf_ManParProcess( pThData->p, pThData->iThread );
+    return NULL;
+}
+#endif
+void Mf_ManComputePar( Mf_Man_t * pMan, int Mode )
+{
+#ifdef ABC_USE_PTHREADS
+    Mf_ManPar_t Par, * p = &Par;
+    pthread_t WorkerThread[MF_PROC_MAX];
+    Mf_ManThr_t ThData[MF_PROC_MAX];
+    int i, k, status;
+    assert( pMan->vLevOrder != NULL );
+    memset( p, 0, sizeof(Mf_ManPar_t) );
+    p->pMan     = pMan;
+    p->nThreads = Abc_MinInt( pMan->pPars->nProcNum, MF_PROC_MAX );
+    p->Mode     = Mode;
+    if ( Mode == 0 )
+    {
+        p->pViews = ABC_ALLOC( Mf_Man_t, p->nThreads );
+        for ( i = 0; i < p->nThreads; i++ )
+        {
+            memcpy( p->pViews + i, pMan, sizeof(Mf_Man_t) );
+            memset( p->pViews[i].CutCount, 0, sizeof(double) * 4 );
+            memset( p->pViews[i].nCutCounts, 0, sizeof(int) * (MF_LEAF_MAX+1) );
+            p->pViews[i].vCutBuf = Vec_IntAlloc( 1000 );
+            p->pViews[i].vTtNew  = pMan->vTtMem ? Vec_WrdAlloc( 100 ) : NULL;
+            p->pViews[i].vCnfNew = pMan->vTtMem ? Vec_IntAlloc( 100 ) : NULL;
+        }
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Mf_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    if ( Mode == 0 )
+    {
+        // collect the statistics
+        for ( i = 0; i < p->nThreads; i++ )
+        {
+            for ( k = 0; k < 4; k++ )
+                pMan->CutCount[k] += p->pViews[i].CutCount[k];
+            for ( k = 0; k <= MF_LEAF_MAX; k++ )
+                pMan->nCutCounts[k] += p->pViews[i].nCutCounts[k];
+            Vec_IntFree( p->pViews[i].vCutBuf );
+            Vec_WrdFreeP( &p->pViews[i].vTtNew );
+            Vec_IntFreeP( &p->pViews[i].vCnfNew );
+        }
+        ABC_FREE( p->pViews );
+    }
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Technology mappping.]
@@ -1644,11 +1919,25 @@ static inline void Mf_ObjComputeBestCut( Mf_Man_t * p, int iObj )
   SeeAlso     []
 
 ***********************************************************************/
+void Mf_ManComputeCuts( Mf_Man_t * p )
+{
+    int i;
+    if ( p->vLevOrder )
+        Mf_ManComputePar( p, 0 );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjMergeOrder( p, i );
+    Mf_ManSetMapRefs( p );
+    Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
+}
 void Mf_ManComputeMapping( Mf_Man_t * p )
 {
     int i;
-    Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjComputeBestCut( p, i );
+    if ( p->vLevOrder && !p->fUseEla )
+        Mf_ManComputePar( p, 1 );
+    else
+        Gia_ManForEachAndId( p->pGia, i )
+            Mf_ObjComputeBestCut( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1669,6 +1958,7 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         printf( "Derived " );  Gia_ManPrintMuxStats( pCls );  printf( "\n" );
     }
     Mf_ManPrintInit( p );
+    Mf_ManParCheck( p );
     Mf_ManComputeCuts( p );
     for ( p->Iter = 1; p->Iter < p->pPars->nRounds; p->Iter++ )
         Mf_ManComputeMapping( p );
@@ -31,6 +31,15 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -42,6 +51,8 @@ ABC_NAMESPACE_IMPL_START
 #define NF_NO_LEAF  31
 #define NF_NO_FUNC  0x3FFFFFF
 #define NF_EPSILON  0.001
+#define NF_PROC_MAX  64
+#define NF_PAR_WIDTH 16   // the min average number of nodes per level and thread
 
 typedef struct Nf_Cut_t_ Nf_Cut_t; 
 struct Nf_Cut_t_
@@ -105,6 +116,12 @@ struct Nf_Man_t_
     int             InvDelayI;      // inverter delay
     word            InvAreaW;       // inverter delay
     float           InvAreaF;       // inverter area 
+    // multi-threading
+    Vec_Int_t *     vLevOrder;      // internal nodes in the order of levels
+    Vec_Int_t *     vLevStarts;     // the first node of each level
+    Vec_Int_t *     vCutBuf;        // cutsets computed by a worker thread
+    Vec_Wrd_t *     vTtNew;         // truth tables found by a worker thread
+    int             iTtNew;         // the truth table ID of the first entry in vTtNew
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[6];    // cut counts
@@ -424,6 +441,8 @@ void Nf_StoDelete( Nf_Man_t * p )
     ABC_FREE( p->vCutDelays.pArray );
     ABC_FREE( p->vBackup.pArray );
     ABC_FREE( p->pNfObjs );
+    Vec_IntFreeP( &p->vLevOrder );
+    Vec_IntFreeP( &p->vLevStarts );
     ABC_FREE( p );
 }
 
@@ -441,6 +460,18 @@ void Nf_StoDelete( Nf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Nf_ManTruthInsert( Nf_Man_t * p, word * pTruth )
+{
+    int * pSpot;
+    if ( p->vTtNew == NULL )
+        return Vec_MemHashInsert( p->vTtMem, pTruth );
+    // worker threads do not update the table; new functions get temporary IDs
+    pSpot = Vec_MemHashLookup( p->vTtMem, pTruth );
+    if ( *pSpot != -1 )
+        return *pSpot;
+    Vec_WrdPush( p->vTtNew, *pTruth );
+    return p->iTtNew + Vec_WrdSize(p->vTtNew) - 1;
+}
 static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t * pCut1, int fCompl0, int fCompl1, Nf_Cut_t * pCutR, int fIsXor )
 {
 //    extern int Nf_ManTruthCanonicize( word * t, int nVars );
@@ -455,7 +486,7 @@ static inline int Nf_CutComputeTruth6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut_t
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -477,7 +508,7 @@ static inline int Nf_CutComputeTruthMux6( Nf_Man_t * p, Nf_Cut_t * pCut0, Nf_Cut
     if ( (fCompl = (int)(t & 1)) ) t = ~t;
     pCutR->nLeaves = Abc_Tt6MinBase( &t, pCutR->pLeaves, pCutR->nLeaves );
     assert( (int)(t & 1) == 0 );
-    truthId        = Vec_MemHashInsert(p->vTtMem, &t);
+    truthId        = Nf_ManTruthInsert(p, &t);
     pCutR->iFunc   = Abc_Var2Lit( truthId, fCompl );
     pCutR->Useless = Nf_ObjCutUseless( p, truthId );
     assert( (int)pCutR->nLeaves <= nOldSupp );
@@ -558,18 +589,33 @@ static inline int Nf_ManPrepareCuts( Nf_Cut_t * pCuts, Nf_Man_t * p, int iObj, i
     }
     return Nf_CutCreateUnit( pCuts, iObj );
 }
-static inline int Nf_ManSaveCuts( Nf_Man_t * p, Nf_Cut_t ** pCuts, int nCuts, int fUseful )
+static inline int Nf_ManAllocCutSet( Nf_Man_t * p, int nInts )
 {
-    int i, * pPlace, iCur, nInts = 1, nCutsNew = 0;
-    for ( i = 0; i < nCuts; i++ )
-        if ( !fUseful || !pCuts[i]->Useless )
-            nInts += pCuts[i]->nLeaves + 1, nCutsNew++;
+    int iCur;
     if ( (p->iCur & 0xFFFF) + nInts > 0xFFFF )
         p->iCur = ((p->iCur >> 16) + 1) << 16;
     if ( Vec_PtrSize(&p->vPages) == (p->iCur >> 16) )
         Vec_PtrPush( &p->vPages, ABC_ALLOC(int, (1<<16)) );
     iCur = p->iCur; p->iCur += nInts;
-    pPlace = Nf_ManCutSet( p, iCur );
+    return iCur;
+}
+static inline int Nf_ManSaveCuts( Nf_Man_t * p, Nf_Cut_t ** pCuts, int nCuts, int fUseful )
+{
+    int i, * pPlace, iCur, nInts = 1, nCutsNew = 0;
+    for ( i = 0; i < nCuts; i++ )
+        if ( !fUseful || !pCuts[i]->Useless )
+            nInts += pCuts[i]->nLeaves + 1, nCutsNew++;
+    if ( p->vCutBuf ) // worker thread; the cutset is moved into the cut memory later
+    {
+        iCur = Vec_IntSize( p->vCutBuf );
+        Vec_IntFillExtra( p->vCutBuf, iCur + nInts, 0 );
+        pPlace = Vec_IntEntryP( p->vCutBuf, iCur );
+    }
+    else
+    {
+        iCur = Nf_ManAllocCutSet( p, nInts );
+        pPlace = Nf_ManCutSet( p, iCur );
+    }
     *pPlace++ = nCutsNew;
     for ( i = 0; i < nCuts; i++ )
         if ( !fUseful || !pCuts[i]->Useless )
@@ -1392,6 +1438,209 @@ void Nf_ManComputeMapping( Nf_Man_t * p )
             Nf_ManCutMatch( p, i );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if cut computation and matching can use several threads.]
+
+  Description [The nodes on the same level do not depend on each other 
+  during cut computation and in the delay and area-flow rounds. Choices 
+  and buffers are not supported because their cuts and matches are 
+  derived from nodes that may be on the same level. If several threads 
+  can be used, computes the level order of the nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nf_ManParCheck( Nf_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( p->pPars->nProcNum < 2 || Gia_ManHasChoices(p->pGia) || Gia_ManBufNum(p->pGia) > 0 )
+        return 0;
+    p->vLevOrder = Gia_ManLevelOrder( p->pGia, &p->vLevStarts );
+    if ( Gia_ManAndNum(p->pGia) >= NF_PAR_WIDTH * p->pPars->nProcNum * (Vec_IntSize(p->vLevStarts) - 2) )
+        return 1;
+    Vec_IntFreeP( &p->vLevOrder );
+    Vec_IntFreeP( &p->vLevStarts );
+#endif
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts or matches using several threads.]
+
+  Description [The nodes are processed level by level. Each thread works 
+  on its slice of the level. When computing cuts (Mode 0), each thread 
+  uses its own copy of the manager, which collects the cutsets and the 
+  statistics. The truth table store is not updated by the threads; 
+  the functions not found there get temporary IDs. After each level, 
+  the first thread adds the new functions to the store and moves the 
+  cutsets into the cut memory, in the order of the nodes. When computing
+  matches (Mode 1), the threads share the manager because each node only
+  updates its own data. The result is the same as with one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Nf_ManPar_t_ Nf_ManPar_t;
+struct Nf_ManPar_t_
+{
+    Nf_Man_t *      pMan;           // mapping manager
+    Nf_Man_t *      pViews;         // shallow copies of the manager (one per thread)
+    int             nThreads;       // the number of threads
+    int             Mode;           // cuts (0) or matches (1)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;          // the barrier after each step
+    pthread_cond_t  Cond;
+#endif
+    int             nWaiting;       // the number of threads waiting at the barrier
+    int             Phase;          // the number of barriers passed
+};
+static void Nf_ManParBarrier( Nf_ManPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int Phase;
+    pthread_mutex_lock( &p->Mutex );
+    Phase = p->Phase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->Phase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+        while ( Phase == p->Phase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+static void Nf_ManParCommitCuts( Nf_Man_t * p, Nf_Man_t * pView, int Beg, int End )
+{
+    int k, c, iObj, iFunc, iCur, nInts, * pList, * pCut;
+    for ( k = Beg; k < End; k++ )
+    {
+        iObj  = Vec_IntEntry( p->vLevOrder, k );
+        pList = Vec_IntEntryP( pView->vCutBuf, Nf_ObjCutSetId(p, iObj) );
+        Nf_SetForEachCut( pList, pCut, c )
+        {
+            iFunc = Nf_CutFunc( pCut );
+            if ( Abc_Lit2Var(iFunc) < pView->iTtNew )
+                continue;
+            iFunc = Abc_Var2Lit( Vec_MemHashInsert(p->vTtMem, Vec_WrdEntryP(pView->vTtNew, Abc_Lit2Var(iFunc) - pView->iTtNew)), Abc_LitIsCompl(iFunc) );
+            pCut[0] = Nf_CutSetBoth( Nf_CutSize(pCut), iFunc );
+        }
+        nInts = pCut - pList;
+        iCur  = Nf_ManAllocCutSet( p, nInts );
+        memcpy( Nf_ManCutSet(p, iCur), pList, sizeof(int) * nInts );
+        Vec_IntWriteEntry( &p->vCutSets, iObj, iCur );
+    }
+}
+static void Nf_ManParProcess( Nf_ManPar_t * p, int iThread )
+{
+    Nf_Man_t * pMan  = p->pMan;
+    Nf_Man_t * pView = p->pViews ? p->pViews + iThread : pMan;
+    int Level, Beg, End, k, i;
+    for ( Level = 1; Level + 1 < Vec_IntSize(pMan->vLevStarts); Level++ )
+    {
+        Beg = Vec_IntEntry( pMan->vLevStarts, Level );
+        End = Vec_IntEntry( pMan->vLevStarts, Level + 1 );
+        if ( Beg == End )
+            continue;
+        if ( p->Mode == 0 && iThread == 0 )
+            for ( i = 0; i < p->nThreads; i++ )
+            {
+                Vec_IntClear( p->pViews[i].vCutBuf );
+                Vec_WrdClear( p->pViews[i].vTtNew );
+                p->pViews[i].iTtNew = Vec_MemEntryNum( pMan->vTtMem );
+                p->pViews[i].vPages = pMan->vPages; // pages added by the previous level
+
+            }
+        Nf_ManParBarrier( p );
+        for ( k = Beg + (End - Beg) * iThread / p->nThreads; k < Beg + (End - Beg) * (iThread + 1) / p->nThreads; k++ )
+            if ( p->Mode == 0 )
+                Nf_ObjMergeOrder( pView, Vec_IntEntry(pMan->vLevOrder, k) );
+            else
+                Nf_ManCutMatch( pView, Vec_IntEntry(pMan->vLevOrder, k) );
+        if ( p->Mode == 1 )
+            continue;
+        Nf_ManParBarrier( p );
+        if ( iThread == 0 )
+            for ( i = 0; i < p->nThreads; i++ )
+                Nf_ManParCommitCuts( pMan, p->pViews + i, Beg + (End - Beg) * i / p->nThreads, Beg + (End - Beg) * (i + 1) / p->nThreads );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+typedef struct Nf_ManThr_t_ Nf_ManThr_t;
+struct Nf_ManThr_t_
+{
+    Nf_ManPar_t *   p;
+    int             iThread;
+};
+static void * Nf_ManParWorkerThread( void * pArg )
+{
+    Nf_ManThr_t * pThData = (Nf_ManThr_t *)pArg;
+    Nf_ManParProcess( pThData->p, pThData->iThread );
+    return NULL;
+}
+#endif
+void Nf_ManComputePar( Nf_Man_t * pMan, int Mode )
+{
+#ifdef ABC_USE_PTHREADS
+    Nf_ManPar_t Par, * p = &Par;
+    pthread_t WorkerThread[NF_PROC_MAX];
+    Nf_ManThr_t ThData[NF_PROC_MAX];
+    int i, k, status;
+    assert( pMan->vLevOrder != NULL );
+    memset( p, 0, sizeof(Nf_ManPar_t) );
+    p->pMan     = pMan;
+    p->nThreads = Abc_MinInt( pMan->pPars->nProcNum, NF_PROC_MAX );
+    p->Mode     = Mode;
+    if ( Mode == 0 )
+    {
+        p->pViews = ABC_ALLOC( Nf_Man_t, p->nThreads );
+        for ( i = 0; i < p->nThreads; i++ )
+        {
+            memcpy( p->pViews + i, pMan, sizeof(Nf_Man_t) );
+            memset( p->pViews[i].CutCount, 0, sizeof(double) * 6 );
+            p->pViews[i].nCutUseAll = 0;
+            p->pViews[i].vCutBuf    = Vec_IntAlloc( 1000 );
+            p->pViews[i].vTtNew     = Vec_WrdAlloc( 100 );
+        }
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Nf_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    if ( Mode == 0 )
+    {
+        // collect the statistics
+        for ( i = 0; i < p->nThreads; i++ )
+        {
+            for ( k = 0; k < 6; k++ )
+                pMan->CutCount[k] += p->pViews[i].CutCount[k];
+            pMan->nCutUseAll += p->pViews[i].nCutUseAll;
+            Vec_IntFree( p->pViews[i].vCutBuf );
+            Vec_WrdFree( p->pViews[i].vTtNew );
+        }
+        ABC_FREE( p->pViews );
+    }
+#endif
+}
+
 
 /**Function*************************************************************
 
@@ -2358,6 +2607,7 @@ void Nf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  NF_LEAF_MAX;
     pPars->nCutNumMax   =  NF_CUT_MAX;
+    pPars->nProcNumMax  =  NF_PROC_MAX;
     pPars->MapDelayTarget = 0;
 }
 Gia_Man_t * Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
@@ -2378,7 +2628,10 @@ Gia_Man_t * Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
         printf( "Derived " );  Gia_ManPrintMuxStats( pCls );  printf( "\n" );
     }
     Nf_ManPrintInit( p );
-    Nf_ManComputeCuts( p );
+    if ( Nf_ManParCheck(p) )
+        Nf_ManComputePar( p, 0 );
+    else
+        Nf_ManComputeCuts( p );
     Nf_ManPrintQuit( p );
     if ( Scl_ConIsRunning() )
     {
@@ -2393,7 +2646,10 @@ Gia_Man_t * Nf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
     }
     for ( p->Iter = 0; p->Iter < p->pPars->nRounds; p->Iter++ )
     {
-        Nf_ManComputeMapping( p );
+        if ( p->vLevOrder )
+            Nf_ManComputePar( p, 1 );
+        else
+            Nf_ManComputeMapping( p );
         Nf_ManSetMapRefs( p );
         Nf_ManPrintStats( p, (char *)(p->Iter ? "Area " : "Delay") );
     }
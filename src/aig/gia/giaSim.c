@@ -21,6 +21,15 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -28,6 +37,37 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_SIM_SEQ_THR_MAX 64
+
+// data shared by the threads of sequential simulation
+typedef struct Gia_SimSeq_t_ Gia_SimSeq_t;
+struct Gia_SimSeq_t_
+{
+    Gia_ParSim_t *  pPars;       // simulation parameters
+    abctime         nTimeToStop; // the wall-clock time to stop
+    volatile int    fStop;       // stops all threads
+    int             fFound;      // a failed output is found
+    int             iFrame;      // the frame of the failure
+    int             iOut;        // the failed output
+    int             iPat;        // the failed pattern
+    int             Seed;        // the random seed of the thread finding the failure
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;       // protects the failure data
+#endif
+};
+
+// data of one thread of sequential simulation
+typedef struct Gia_SimSeqThr_t_ Gia_SimSeqThr_t;
+struct Gia_SimSeqThr_t_
+{
+    Gia_SimSeq_t *  pShare;      // shared data
+    Gia_ManSim_t *  pSim;        // simulation manager of this thread
+    int             Seed;        // the random seed of this thread
+    int             nFrames;     // the number of simulated frames
+    unsigned        RandZ;       // the random number generator state
+    unsigned        RandW;
+};
+
 static inline unsigned * Gia_SimData( Gia_ManSim_t * p, int i )    { return p->pDataSim + i * p->nWords;    }
 static inline unsigned * Gia_SimDataCi( Gia_ManSim_t * p, int i )  { return p->pDataSimCis + i * p->nWords; }
 static inline unsigned * Gia_SimDataCo( Gia_ManSim_t * p, int i )  { return p->pDataSimCos + i * p->nWords; }
@@ -173,6 +213,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
+    p->nThreads     =   1;    // the number of threads
 }
 
 /**Function*************************************************************
@@ -243,6 +284,33 @@ Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates simulation manager sharing the frontier AIG.]
+
+  Description [The AIG of the resulting manager should be set to NULL 
+  before the manager is deleted.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_ManSim_t * Gia_ManSimCreateShared( Gia_ManSim_t * pSim )
+{
+    Gia_ManSim_t * p;
+    p = ABC_ALLOC( Gia_ManSim_t, 1 );
+    memset( p, 0, sizeof(Gia_ManSim_t) );
+    p->pAig   = pSim->pAig;
+    p->pPars  = pSim->pPars;
+    p->nWords = pSim->nWords;
+    p->pDataSim    = ABC_ALLOC( unsigned, p->nWords * p->pAig->nFront );
+    p->pDataSimCis = ABC_ALLOC( unsigned, p->nWords * Gia_ManCiNum(p->pAig) );
+    p->pDataSimCos = ABC_ALLOC( unsigned, p->nWords * Gia_ManCoNum(p->pAig) );
+    p->vCis2Ids = Vec_IntDup( pSim->vCis2Ids );
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -585,6 +653,188 @@ void Gia_ManResetRandom( Gia_ParSim_t * pPars )
         Gia_ManRandom( 0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded sequential simulation.]
+
+  Description [Each thread simulates its own batch of nWords words with 
+  its own register state and its own random number generator, seeded by 
+  the thread number and RandSeed. The threads share the frontier AIG and 
+  the stop flag, which is raised by the first thread finding a failed 
+  output or when the runtime limit is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManSimParSeed( Gia_SimSeqThr_t * pThr, int Seed )
+{
+    pThr->RandZ = 3716960521u ^ ((unsigned)Seed * 0x9E3779B9u);
+    pThr->RandW = 2174103536u ^ ((unsigned)Seed * 0x85EBCA6Bu);
+    if ( pThr->RandZ == 0 ) pThr->RandZ = 1;
+    if ( pThr->RandW == 0 ) pThr->RandW = 1;
+}
+static inline unsigned Gia_ManSimParRandom( Gia_SimSeqThr_t * pThr )
+{
+    pThr->RandZ = 36969 * (pThr->RandZ & 65535) + (pThr->RandZ >> 16);
+    pThr->RandW = 18000 * (pThr->RandW & 65535) + (pThr->RandW >> 16);
+    return (pThr->RandZ << 16) + pThr->RandW;
+}
+static inline void Gia_ManSimParInfoRandom( Gia_SimSeqThr_t * pThr, unsigned * pInfo )
+{
+    int w;
+    for ( w = pThr->pSim->nWords-1; w >= 0; w-- )
+        pInfo[w] = Gia_ManSimParRandom( pThr );
+}
+static void Gia_ManSimParInfoInit( Gia_SimSeqThr_t * pThr, int fTransfer )
+{
+    Gia_ManSim_t * p = pThr->pSim;
+    int iPioNum, i;
+    Vec_IntForEachEntry( p->vCis2Ids, iPioNum, i )
+    {
+        if ( iPioNum < Gia_ManPiNum(p->pAig) )
+            Gia_ManSimParInfoRandom( pThr, Gia_SimDataCi(p, i) );
+        else if ( fTransfer )
+            Gia_ManSimInfoCopy( p, Gia_SimDataCi(p, i), Gia_SimDataCo(p, Gia_ManPoNum(p->pAig)+iPioNum-Gia_ManPiNum(p->pAig)) );
+        else
+            Gia_ManSimInfoZero( p, Gia_SimDataCi(p, i) );
+    }
+}
+static void Gia_ManSimParRun( Gia_SimSeqThr_t * pThr )
+{
+    Gia_SimSeq_t * pShare = pThr->pShare;
+    Gia_ParSim_t * pPars = pShare->pPars;
+    int f, iOut, iPat;
+    Gia_ManSimParSeed( pThr, pThr->Seed );
+    for ( f = 0; f < pPars->nIters && !pShare->fStop; f++ )
+    {
+        Gia_ManSimParInfoInit( pThr, f > 0 );
+        Gia_ManSimulateRound( pThr->pSim );
+        pThr->nFrames++;
+        if ( pPars->fCheckMiter && Gia_ManCheckPos( pThr->pSim, &iOut, &iPat ) )
+        {
+#ifdef ABC_USE_PTHREADS
+            pthread_mutex_lock( &pShare->Mutex );
+#endif
+            if ( !pShare->fFound )
+            {
+                pShare->fFound = 1;
+                pShare->fStop  = 1;
+                pShare->iFrame = f;
+                pShare->iOut   = iOut;
+                pShare->iPat   = iPat;
+                pShare->Seed   = pThr->Seed;
+            }
+#ifdef ABC_USE_PTHREADS
+            pthread_mutex_unlock( &pShare->Mutex );
+#endif
+            break;
+        }
+        if ( pShare->nTimeToStop && Abc_ClockWall() > pShare->nTimeToStop )
+            pShare->fStop = 1;
+    }
+}
+#ifdef ABC_USE_PTHREADS
+static void * Gia_ManSimParWorkerThread( void * pArg )
+{
+    Gia_ManSimParRun( (Gia_SimSeqThr_t *)pArg );
+    return NULL;
+}
+#endif
+// replays the random numbers of the given thread to derive the counter-example
+static Abc_Cex_t * Gia_ManSimParGenerateCounter( Gia_Man_t * pAig, int iFrame, int iOut, int nWords, int iPat, int Seed )
+{
+    Gia_SimSeqThr_t Thr, * pThr = &Thr;
+    Abc_Cex_t * p;
+    unsigned * pData;
+    int f, i, w, Counter;
+    p = Abc_CexAlloc( Gia_ManRegNum(pAig), Gia_ManPiNum(pAig), iFrame+1 );
+    p->iFrame = iFrame;
+    p->iPo    = iOut;
+    Counter = p->nRegs;
+    pData = ABC_ALLOC( unsigned, nWords );
+    Gia_ManSimParSeed( pThr, Seed );
+    for ( f = 0; f <= iFrame; f++, Counter += p->nPis )
+    for ( i = 0; i < Gia_ManPiNum(pAig); i++ )
+    {
+        for ( w = nWords-1; w >= 0; w-- )
+            pData[w] = Gia_ManSimParRandom( pThr );
+        if ( Abc_InfoHasBit( pData, iPat ) )
+            Abc_InfoSetBit( p->pData, Counter + i );
+    }
+    ABC_FREE( pData );
+    return p;
+}
+int Gia_ManSimSimulatePar( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
+{
+    Gia_SimSeq_t Share, * pShare = &Share;
+    Gia_SimSeqThr_t ThData[GIA_SIM_SEQ_THR_MAX];
+    Gia_ManSim_t * p;
+    abctime clkTotal = Abc_ClockWall();
+    double nFramePats = 0, Time;
+    int i, nThreads = Abc_MinInt( pPars->nThreads, GIA_SIM_SEQ_THR_MAX ), nFramesMin = pPars->nIters;
+    ABC_FREE( pAig->pCexSeq );
+    p = Gia_ManSimCreate( pAig, pPars );
+    if ( p == NULL )
+        return 0;
+    memset( pShare, 0, sizeof(Gia_SimSeq_t) );
+    pShare->pPars = pPars;
+    pShare->nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + clkTotal : 0;
+    memset( ThData, 0, sizeof(Gia_SimSeqThr_t) * nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pShare = pShare;
+        ThData[i].Seed   = pPars->RandSeed * GIA_SIM_SEQ_THR_MAX + i;
+        ThData[i].pSim   = i ? Gia_ManSimCreateShared( p ) : p;
+    }
+#ifdef ABC_USE_PTHREADS
+    {
+        pthread_t WorkerThread[GIA_SIM_SEQ_THR_MAX];
+        int status;
+        pthread_mutex_init( &pShare->Mutex, NULL );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Gia_ManSimParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        pthread_mutex_destroy( &pShare->Mutex );
+    }
+#else
+    for ( i = 0; i < nThreads; i++ )
+        Gia_ManSimParRun( ThData + i );
+#endif
+    Time = 1.0*(Abc_ClockWall() - clkTotal)/CLOCKS_PER_SEC;
+    for ( i = 0; i < nThreads; i++ )
+    {
+        nFramePats += 32.0 * p->nWords * ThData[i].nFrames;
+        nFramesMin = Abc_MinInt( nFramesMin, ThData[i].nFrames );
+        if ( i ) 
+        {
+            ThData[i].pSim->pAig = NULL;
+            Gia_ManSimDelete( ThData[i].pSim );
+        }
+    }
+    Gia_ManSimDelete( p );
+    if ( pShare->fFound )
+    {
+        pPars->iOutFail = pShare->iOut;
+        pAig->pCexSeq = Gia_ManSimParGenerateCounter( pAig, pShare->iFrame, pShare->iOut, pPars->nWords, pShare->iPat, pShare->Seed );
+        Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d by thread %d.  ", 
+            pShare->iOut, pAig->pName, pShare->iFrame, pShare->Seed % GIA_SIM_SEQ_THR_MAX );
+        if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+            Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
+    }
+    else
+        Abc_Print( 1, "No bug detected after simulating %d frames with %d words in each of %d threads.  ", nFramesMin, pPars->nWords, nThreads );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
+    Abc_Print( 1, "Simulated %.0f frame-patterns (%.2f M/sec).\n", nFramePats, Time > 0 ? nFramePats / Time / 1000000 : 0.0 );
+    return pShare->fFound;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -605,6 +855,8 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
     if ( pAig->pReprs && pAig->pNexts )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
+    if ( pPars->nThreads > 1 )
+        return Gia_ManSimSimulatePar( pAig, pPars );
     ABC_FREE( pAig->pCexSeq );
     p = Gia_ManSimCreate( pAig, pPars );
     Gia_ManResetRandom( pPars );
@@ -754,7 +1006,9 @@ void Gia_ManSimSimulatePattern( Gia_Man_t * p, char * pFileIn, char * pFileOut )
 
   Synopsis    [Bit-parallel simulation during AIG construction.]
 
-  Description []
+  Description [The nodes are simulated one at a time, as they are added
+  to the AIG, so this simulation is not multi-threaded. The complete AIG
+  is simulated on several threads by Gia_ManSimPatSimPar().]
                
   SideEffects []
 
@@ -827,8 +1081,161 @@ void Gia_ManBuiltInSimPerform( Gia_Man_t * p, int iObj )
     for ( w = 0; w < p->nSimWords; w++ )
         Vec_WrdPush( p->vSims, 0 );
     Gia_ManBuiltInSimPerformInt( p, iObj );
+    if ( p->fSimEvent )
+    {
+        Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+        Vec_WecPush( p->vSimFanouts, Gia_ObjFaninId0(pObj, iObj), iObj );
+        Vec_WecPush( p->vSimFanouts, Gia_ObjFaninId1(pObj, iObj), iObj );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Event-driven resimulation.]
+
+  Description [When enabled, the CIs whose simulation info is changed by 
+  the added patterns are recorded. Resimulation starts from their fanouts 
+  and evaluates only the nodes, which have at least one fanin whose info 
+  has changed. The nodes are visited in the order of their IDs using 
+  a bitmap of scheduled nodes, so that each node is evaluated once.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManBuiltInSimSetEvent( Gia_Man_t * p, int fEvent )
+{
+    Gia_Obj_t * pObj; int iObj;
+    assert( p->fBuiltInSim );
+    Vec_WecFreeP( &p->vSimFanouts );
+    Vec_IntFreeP( &p->vSimChanged );
+    Vec_BitFreeP( &p->vSimMarks );
+    p->fSimEvent = fEvent;
+    if ( !fEvent )
+        return;
+    p->vSimFanouts = Vec_WecStart( Gia_ManObjNum(p) );
+    p->vSimChanged = Vec_IntAlloc( 100 );
+    p->vSimMarks   = Vec_BitStart( Gia_ManObjNum(p) );
+    Gia_ManForEachAnd( p, pObj, iObj )
+    {
+        Vec_WecPush( p->vSimFanouts, Gia_ObjFaninId0(pObj, iObj), iObj );
+        Vec_WecPush( p->vSimFanouts, Gia_ObjFaninId1(pObj, iObj), iObj );
+    }
+}
+static inline void Gia_ManBuiltInSimFlipBit( Gia_Man_t * p, int iObj, int iPat )
+{
+    Abc_TtXorBit( Gia_ManBuiltInData(p, iObj), iPat );
+    if ( p->fSimEvent )
+        Vec_IntPush( p->vSimChanged, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Propagates the changed simulation info to the fanouts.]
+
+  Description [The simulation info is stored in p->vSims, p->nSimWords 
+  words per object. Starting from the objects in vChanged, evaluates the 
+  nodes, which have at least one fanin whose info has changed, using the
+  given kernel. The nodes are visited in the order of their IDs using 
+  the bitmap vMarks, so that each node is evaluated once. The bitmap 
+  should be clean and have an entry for each object listed in vFanouts; 
+  it is clean upon return, and vChanged is cleared. Returns the number 
+  of evaluated nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManSimEventMarkFanouts( Vec_Wec_t * vFanouts, Vec_Bit_t * vMarks, int iObj, int * piMin, int * piMax )
+{
+    Vec_Int_t * vFans; int k, iFan;
+    if ( iObj >= Vec_WecSize(vFanouts) )
+        return;
+    vFans = Vec_WecEntry( vFanouts, iObj );
+    Vec_IntForEachEntry( vFans, iFan, k )
+    {
+        Vec_BitWriteEntry( vMarks, iFan, 1 );
+        *piMin = Abc_MinInt( *piMin, iFan );
+        *piMax = Abc_MaxInt( *piMax, iFan );
+    }
 }
+int Gia_ManSimEventPropagate( Gia_Man_t * p, Gia_SimKer_t * pKer, Vec_Wec_t * vFanouts, Vec_Int_t * vChanged, Vec_Bit_t * vMarks )
+{
+    word * pCopy = ABC_ALLOC( word, p->nSimWords );
+    unsigned * pMarks = (unsigned *)Vec_BitArray( vMarks );
+    int i, k, iObj, nEvals = 0, iMin = ABC_INFINITY, iMax = -1;
+    Vec_IntForEachEntry( vChanged, iObj, i )
+        Gia_ManSimEventMarkFanouts( vFanouts, vMarks, iObj, &iMin, &iMax );
+    Vec_IntClear( vChanged );
+    // the fanouts have larger IDs, so iMax may only grow while the bitmap is scanned
+    for ( i = iMin >> 5; i <= (iMax >> 5); i++ )
+        while ( pMarks[i] )
+        {
+            Gia_Obj_t * pObj;
+            word * pSim, * pSim0, * pSim1;
+            k = Abc_Tt6FirstBit( (word)pMarks[i] );
+            pMarks[i] ^= (1u << k);
+            iObj  = (i << 5) + k;
+            pObj  = Gia_ManObj( p, iObj );
+            pSim  = Vec_WrdEntryP( p->vSims, p->nSimWords * iObj );
+            pSim0 = Vec_WrdEntryP( p->vSims, p->nSimWords * Gia_ObjFaninId0(pObj, iObj) );
+            pSim1 = Vec_WrdEntryP( p->vSims, p->nSimWords * Gia_ObjFaninId1(pObj, iObj) );
+            memcpy( pCopy, pSim, sizeof(word) * p->nSimWords );
+            pKer->pFuncAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ? ~(word)0 : 0, Gia_ObjFaninC1(pObj) ? ~(word)0 : 0, p->nSimWords );
+            nEvals++;
+            if ( memcmp( pCopy, pSim, sizeof(word) * p->nSimWords ) )
+                Gia_ManSimEventMarkFanouts( vFanouts, vMarks, iObj, &iMin, &iMax );
+        }
+    ABC_FREE( pCopy );
+    return nEvals;
+}
+void Gia_ManBuiltInSimResimulateEvent( Gia_Man_t * p )
+{
+    // the marks are reset after each resimulation
+    if ( Vec_BitSize(p->vSimMarks) < Gia_ManObjNum(p) )
+    {
+        Vec_BitFree( p->vSimMarks );
+        p->vSimMarks = Vec_BitStart( 2 * Gia_ManObjNum(p) );
+    }
+    p->nSimEvals += Gia_ManSimEventPropagate( p, Gia_SimKernelGet(), p->vSimFanouts, p->vSimChanged, p->vSimMarks );
+}
+
+/**Function*************************************************************
 
+  Synopsis    [Prints statistics of resimulation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManBuiltInSimPrintStats( Gia_Man_t * p )
+{
+    double nSaved = (double)p->nSimEvalsFull - (double)p->nSimEvals;
+    printf( "Resimulation (%s): Patterns = %.0f. Node evals = %.0f. Without events = %.0f. ", 
+        p->fSimEvent ? "event-driven" : "full", (double)p->nSimPats, (double)p->nSimEvals, (double)p->nSimEvalsFull );
+    printf( "Saved per pattern = %.2f (%.2f %%).\n", 
+        p->nSimPats ? nSaved / p->nSimPats : 0.0, p->nSimEvalsFull ? 100.0 * nSaved / p->nSimEvalsFull : 0.0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resimulates the nodes after adding new patterns.]
+
+  Description [In the event-driven mode, only the nodes whose fanin info 
+  has changed are evaluated, and all nodes (not only the cone) are updated.
+  The cone is still traversed to count the evaluations of the default mode,
+  which are reported as the evaluations without events.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Gia_ManBuiltInSimResimulateCone_rec( Gia_Man_t * p, int iObj )
 {
     Gia_Obj_t * pObj;
@@ -841,19 +1248,40 @@ void Gia_ManBuiltInSimResimulateCone_rec( Gia_Man_t * p, int iObj )
     assert( Gia_ObjIsAnd(pObj) );
     Gia_ManBuiltInSimResimulateCone_rec( p, Gia_ObjFaninId0(pObj, iObj) );
     Gia_ManBuiltInSimResimulateCone_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+    p->nSimEvalsFull++;
+    if ( p->fSimEvent )
+        return;
     Gia_ManBuiltInSimPerformInt( p, iObj );
+    p->nSimEvals++;
 }
 void Gia_ManBuiltInSimResimulateCone( Gia_Man_t * p, int iLit0, int iLit1 )
 {
+    // in the event-driven mode, the cone is traversed only to count the evaluations without events
     Gia_ManIncrementTravId( p );
     Gia_ManBuiltInSimResimulateCone_rec( p, Abc_Lit2Var(iLit0) );
     Gia_ManBuiltInSimResimulateCone_rec( p, Abc_Lit2Var(iLit1) );
+    if ( p->fSimEvent )
+        Gia_ManBuiltInSimResimulateEvent( p );
 }
-void Gia_ManBuiltInSimResimulate( Gia_Man_t * p )
+void Gia_ManBuiltInSimResimulateAll( Gia_Man_t * p )
 {
     Gia_Obj_t * pObj;  int iObj;
     Gia_ManForEachAnd( p, pObj, iObj )
         Gia_ManBuiltInSimPerformInt( p, iObj );
+    p->nSimEvals     += Gia_ManAndNum(p);
+    p->nSimEvalsFull += Gia_ManAndNum(p);
+    if ( p->fSimEvent )
+        Vec_IntClear( p->vSimChanged );
+}
+void Gia_ManBuiltInSimResimulate( Gia_Man_t * p )
+{
+    if ( !p->fSimEvent )
+    {
+        Gia_ManBuiltInSimResimulateAll( p );
+        return;
+    }
+    p->nSimEvalsFull += Gia_ManAndNum(p);
+    Gia_ManBuiltInSimResimulateEvent( p );
 }
 
 int Gia_ManBuiltInSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 )
@@ -965,6 +1393,7 @@ int Gia_ManBuiltInSimAddPat( Gia_Man_t * p, Vec_Int_t * vPat )
     int Period = 0xF;
     int fOverflow = p->iPatsPi == 64 * p->nSimWords && p->nSimWords == p->nSimWordsMax;
     int k, iLit, iPat = Gia_ManBuiltInSimPack( p, vPat );
+    p->nSimPats++;
     if ( iPat == -1 )
     {
         if ( fOverflow )
@@ -1021,6 +1450,9 @@ int Gia_ManBuiltInSimAddPat( Gia_Man_t * p, Vec_Int_t * vPat )
                 p->nSimWords++;
                 assert( Vec_WrdSize(p->vSims)   == p->nSimWords * Gia_ManObjNum(p) );
                 assert( Vec_WrdSize(p->vSimsPi) == p->nSimWords * Gia_ManCiNum(p)  );
+                // the new word of the nodes is not derived from the CIs
+                if ( p->fSimEvent )
+                    Gia_ManBuiltInSimResimulateAll( p );
                 //printf( "Resizing to %d words.\n", p->nSimWords );
             }
             iPat = p->iPatsPi++;
@@ -1037,7 +1469,7 @@ int Gia_ManBuiltInSimAddPat( Gia_Man_t * p, Vec_Int_t * vPat )
         Vec_IntForEachEntry( vPat, iLit, k )
         {
             if ( Abc_TtGetBit(Gia_ManBuiltInData(p, 1+Abc_Lit2Var(iLit)), iPat) == Abc_LitIsCompl(iLit) )
-            Abc_TtXorBit(Gia_ManBuiltInData(p, 1+Abc_Lit2Var(iLit)), iPat);
+            Gia_ManBuiltInSimFlipBit(p, 1+Abc_Lit2Var(iLit), iPat);
             Abc_TtXorBit(Gia_ManBuiltInDataPi(p, Abc_Lit2Var(iLit)), iPat);
         }
     }
@@ -1050,7 +1482,7 @@ int Gia_ManBuiltInSimAddPat( Gia_Man_t * p, Vec_Int_t * vPat )
             else 
             {
                 if ( Abc_TtGetBit(Gia_ManBuiltInData(p, 1+Abc_Lit2Var(iLit)), iPat) == Abc_LitIsCompl(iLit) )
-                Abc_TtXorBit(Gia_ManBuiltInData(p, 1+Abc_Lit2Var(iLit)), iPat);
+                Gia_ManBuiltInSimFlipBit(p, 1+Abc_Lit2Var(iLit), iPat);
                 Abc_TtXorBit(Gia_ManBuiltInDataPi(p, Abc_Lit2Var(iLit)), iPat);
             }
         }
@@ -1117,11 +1549,82 @@ int Gia_ManObjCheckOverlap( Gia_Man_t * p, int iLit0, int iLit1, Vec_Int_t * vOb
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks resimulation of the built-in simulator.]
+
+  Description [Rebuilds the AIG with the built-in simulation and emulates 
+  SAT sweeping: each new pattern assigns a small group of CIs, after which 
+  the cones of a random pair of nodes are resimulated and compared. 
+  The result of the comparisons and the final checksum should not depend 
+  on whether the event-driven mode is used.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManBuiltInSimBench( Gia_Man_t * p, int nWords, int nPats, int fEvent, int fVerbose )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vPat = Vec_IntAlloc( 100 );
+    abctime clk = Abc_Clock();
+    int i, k, r, iStart, iLit0, iLit1, nEquals = 0;
+    int nLits = Abc_MinInt( 16, Gia_ManCiNum(p) );
+    unsigned uCheck = 0; word Data;
+    assert( p->pMuxes == NULL );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManBuiltInSimStart( pNew, nWords, Gia_ManObjNum(p) );
+    Gia_ManBuiltInSimSetEvent( pNew, fEvent );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachAnd( p, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManHashStop( pNew );
+    if ( Gia_ManAndNum(pNew) < 2 || nLits == 0 )
+    {
+        printf( "The AIG is too small.\n" );
+        Vec_IntFree( vPat );
+        Gia_ManStop( pNew );
+        return;
+    }
+    Gia_ManRandom( 1 );
+    for ( r = 0; r < nPats; r++ )
+    {
+        // the pattern assigns a group of consecutive CIs
+        Vec_IntClear( vPat );
+        iStart = Gia_ManRandom(0) % Gia_ManCiNum(pNew);
+        for ( k = 0; k < nLits; k++ )
+            Vec_IntPush( vPat, Abc_Var2Lit( (iStart + k) % Gia_ManCiNum(pNew), Gia_ManRandom(0) & 1 ) );
+        Gia_ManBuiltInSimAddPat( pNew, vPat );
+        // compare a pair of nodes
+        iLit0 = Abc_Var2Lit( 1 + Gia_ManCiNum(pNew) + Gia_ManRandom(0) % Gia_ManAndNum(pNew), 0 );
+        iLit1 = Abc_Var2Lit( 1 + Gia_ManCiNum(pNew) + Gia_ManRandom(0) % Gia_ManAndNum(pNew), 0 );
+        Gia_ManBuiltInSimResimulateCone( pNew, iLit0, iLit1 );
+        nEquals += Gia_ManBuiltInSimCheckEqual( pNew, iLit0, iLit1 );
+    }
+    Gia_ManBuiltInSimResimulate( pNew );
+    Vec_WrdForEachEntry( pNew->vSims, Data, i )
+        uCheck += (unsigned)(Data ^ (Data >> 32)) * (unsigned)(i + 1);
+    printf( "Added %d patterns to %d nodes (%d words). Equal pairs = %d. Checksum = %08x.  ", 
+        nPats, Gia_ManAndNum(pNew), pNew->nSimWords, nEquals, uCheck );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    Gia_ManBuiltInSimPrintStats( pNew );
+    Vec_IntFree( vPat );
+    Gia_ManStop( pNew );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bit-parallel simulation during AIG construction.]
 
-  Description []
+  Description [The nodes are simulated one at a time, as they are added
+  to the AIG, so this simulation is not multi-threaded. The complete AIG
+  is simulated on several threads by Gia_ManSimPatSimPar().]
                
   SideEffects []
 
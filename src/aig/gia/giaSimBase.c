@@ -21,7 +21,20 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
-//#include <immintrin.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GIA_SIM_DISPATCH
+#include <immintrin.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -45,6 +58,31 @@ struct Gia_SimRsbMan_t_
     word *         pFunc[3];
 };
 
+#define GIA_SIM_KER_NUM    4
+#define GIA_SIM_THR_MAX   64
+#define GIA_SIM_PAR_WIDTH 64   // the min average number of nodes per level and thread to split levels
+
+typedef struct Gia_SimPar_t_ Gia_SimPar_t;
+struct Gia_SimPar_t_
+{
+    Gia_Man_t *    pGia;       // AIG manager
+    Vec_Wrd_t *    vSims;      // simulation info
+    int            nWords;     // words per object
+    int            nUnit;      // the granularity of splitting words
+    int            nThreads;   // the number of threads
+    int            fCos;       // simulate the COs
+    Vec_Int_t *    vOrder;     // nodes in the order of levels (when splitting levels)
+    Vec_Int_t *    vStarts;    // the first node of each level in vOrder
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;     // the barrier after each level
+    pthread_cond_t Cond;
+#endif
+    int            nWaiting;   // the number of threads waiting at the barrier
+    int            Phase;      // the number of barriers passed
+};
+
+static int s_nSimThreads = 1;
+
 
 typedef struct Gia_SimAbsMan_t_ Gia_SimAbsMan_t;
 struct Gia_SimAbsMan_t_
@@ -70,6 +108,345 @@ struct Gia_SimAbsMan_t_
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Word-parallel simulation kernels.]
+
+  Description [Each kernel processes nWords 64-bit words of simulation info.
+  The masks (0 or ~0) complement the inputs. The hash is the one used by
+  the equivalence class refinement in CEC (XOR of 32-bit halves multiplied
+  by 16 rotating primes, complemented when the first pattern is 1), so
+  all kernels return identical results. The SIMD versions are compiled
+  with target attributes and selected at runtime by the CPU features.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned s_SimPrimes[16] = { 
+    1291, 1699, 1999, 2357, 2953, 3313, 3907, 4177, 
+    4831, 5147, 5647, 6343, 6899, 7103, 7873, 8147 };
+
+static void Gia_SimAndScalar( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ m0) & (p1[w] ^ m1);
+}
+static void Gia_SimXorScalar( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (p0[w] ^ m0) ^ (p1[w] ^ m1);
+}
+static void Gia_SimMuxScalar( word * pOut, word * pC, word * p1, word * p0, word mC, word m1, word m0, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = ((pC[w] ^ mC) & (p1[w] ^ m1)) | (~(pC[w] ^ mC) & (p0[w] ^ m0));
+}
+static int Gia_SimEqualScalar( word * p0, word * p1, word m, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( p0[w] != (p1[w] ^ m) )
+            return 0;
+    return 1;
+}
+static unsigned Gia_SimHashScalar( word * p, int nWords )
+{
+    unsigned uHash = 0, uMask = (p[0] & 1) ? ~0u : 0, * pU = (unsigned *)p;
+    int i;
+    for ( i = 0; i < 2 * nWords; i++ )
+        uHash ^= (pU[i] ^ uMask) * s_SimPrimes[i & 0xf];
+    return uHash;
+}
+
+// simulates the AND nodes of an AIG whose info is stored nWords apart starting at pSims;
+// the loop is compiled for each kernel, so that the node kernel can be inlined
+#define GIA_SIM_ANDS( FuncAnds, FuncAnd )                                                          \
+static void FuncAnds( Gia_Man_t * p, word * pSims, int nWords )                                     \
+{                                                                                                   \
+    Gia_Obj_t * pObj; int i;                                                                        \
+    Gia_ManForEachAnd( p, pObj, i )                                                                 \
+        FuncAnd( pSims + nWords*i, pSims + nWords*Gia_ObjFaninId0(pObj, i), pSims + nWords*Gia_ObjFaninId1(pObj, i), \
+            Gia_ObjFaninC0(pObj) ? ~(word)0 : 0, Gia_ObjFaninC1(pObj) ? ~(word)0 : 0, nWords );    \
+}
+
+GIA_SIM_ANDS( Gia_SimAndsScalar, Gia_SimAndScalar )
+
+#ifdef GIA_SIM_DISPATCH
+
+// SSE4.2 (128-bit)
+__attribute__((target("sse4.2"))) static void Gia_SimAndSse( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    __m128i M0 = _mm_set1_epi64x( (long long)m0 ), M1 = _mm_set1_epi64x( (long long)m1 );
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_and_si128( _mm_xor_si128(_mm_loadu_si128((__m128i *)(p0 + w)), M0), _mm_xor_si128(_mm_loadu_si128((__m128i *)(p1 + w)), M1) ) );
+    Gia_SimAndScalar( pOut + w, p0 + w, p1 + w, m0, m1, nWords - w );
+}
+__attribute__((target("sse4.2"))) static void Gia_SimXorSse( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    __m128i M = _mm_set1_epi64x( (long long)(m0 ^ m1) );
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_xor_si128( _mm_xor_si128(_mm_loadu_si128((__m128i *)(p0 + w)), _mm_loadu_si128((__m128i *)(p1 + w))), M ) );
+    Gia_SimXorScalar( pOut + w, p0 + w, p1 + w, m0, m1, nWords - w );
+}
+__attribute__((target("sse4.2"))) static void Gia_SimMuxSse( word * pOut, word * pC, word * p1, word * p0, word mC, word m1, word m0, int nWords )
+{
+    __m128i MC = _mm_set1_epi64x( (long long)mC ), M1 = _mm_set1_epi64x( (long long)m1 ), M0 = _mm_set1_epi64x( (long long)m0 );
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        __m128i C = _mm_xor_si128( _mm_loadu_si128((__m128i *)(pC + w)), MC );
+        __m128i A = _mm_xor_si128( _mm_loadu_si128((__m128i *)(p1 + w)), M1 );
+        __m128i B = _mm_xor_si128( _mm_loadu_si128((__m128i *)(p0 + w)), M0 );
+        _mm_storeu_si128( (__m128i *)(pOut + w), _mm_or_si128( _mm_and_si128(C, A), _mm_andnot_si128(C, B) ) );
+    }
+    Gia_SimMuxScalar( pOut + w, pC + w, p1 + w, p0 + w, mC, m1, m0, nWords - w );
+}
+__attribute__((target("sse4.2"))) static int Gia_SimEqualSse( word * p0, word * p1, word m, int nWords )
+{
+    __m128i M = _mm_set1_epi64x( (long long)m ), D;
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        D = _mm_xor_si128( _mm_xor_si128(_mm_loadu_si128((__m128i *)(p0 + w)), _mm_loadu_si128((__m128i *)(p1 + w))), M );
+        if ( !_mm_testz_si128(D, D) )
+            return 0;
+    }
+    return Gia_SimEqualScalar( p0 + w, p1 + w, m, nWords - w );
+}
+__attribute__((target("sse4.2"))) static unsigned Gia_SimHashSse( word * p, int nWords )
+{
+    unsigned uHash = 0, uMask = (p[0] & 1) ? ~0u : 0, * pU = (unsigned *)p, Buf[4];
+    __m128i M = _mm_set1_epi32( (int)uMask ), H = _mm_setzero_si128();
+    __m128i P0 = _mm_loadu_si128( (__m128i *)(s_SimPrimes + 0) ), P1 = _mm_loadu_si128( (__m128i *)(s_SimPrimes + 4) );
+    __m128i P2 = _mm_loadu_si128( (__m128i *)(s_SimPrimes + 8) ), P3 = _mm_loadu_si128( (__m128i *)(s_SimPrimes + 12) );
+    int i, k, nU = 2 * nWords;
+    for ( i = 0; i + 16 <= nU; i += 16 )
+    {
+        H = _mm_xor_si128( H, _mm_mullo_epi32(_mm_xor_si128(_mm_loadu_si128((__m128i *)(pU + i +  0)), M), P0) );
+        H = _mm_xor_si128( H, _mm_mullo_epi32(_mm_xor_si128(_mm_loadu_si128((__m128i *)(pU + i +  4)), M), P1) );
+        H = _mm_xor_si128( H, _mm_mullo_epi32(_mm_xor_si128(_mm_loadu_si128((__m128i *)(pU + i +  8)), M), P2) );
+        H = _mm_xor_si128( H, _mm_mullo_epi32(_mm_xor_si128(_mm_loadu_si128((__m128i *)(pU + i + 12)), M), P3) );
+    }
+    _mm_storeu_si128( (__m128i *)Buf, H );
+    for ( k = 0; k < 4; k++ )
+        uHash ^= Buf[k];
+    for ( ; i < nU; i++ )
+        uHash ^= (pU[i] ^ uMask) * s_SimPrimes[i & 0xf];
+    return uHash;
+}
+
+// AVX2 (256-bit)
+__attribute__((target("avx2"))) static void Gia_SimAndAvx2( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    __m256i M0 = _mm256_set1_epi64x( (long long)m0 ), M1 = _mm256_set1_epi64x( (long long)m1 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256( _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p0 + w)), M0), _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p1 + w)), M1) ) );
+    Gia_SimAndScalar( pOut + w, p0 + w, p1 + w, m0, m1, nWords - w );
+}
+__attribute__((target("avx2"))) static void Gia_SimXorAvx2( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    __m256i M = _mm256_set1_epi64x( (long long)(m0 ^ m1) );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256( _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p0 + w)), _mm256_loadu_si256((__m256i *)(p1 + w))), M ) );
+    Gia_SimXorScalar( pOut + w, p0 + w, p1 + w, m0, m1, nWords - w );
+}
+__attribute__((target("avx2"))) static void Gia_SimMuxAvx2( word * pOut, word * pC, word * p1, word * p0, word mC, word m1, word m0, int nWords )
+{
+    __m256i MC = _mm256_set1_epi64x( (long long)mC ), M1 = _mm256_set1_epi64x( (long long)m1 ), M0 = _mm256_set1_epi64x( (long long)m0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i C = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pC + w)), MC );
+        __m256i A = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p1 + w)), M1 );
+        __m256i B = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(p0 + w)), M0 );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_or_si256( _mm256_and_si256(C, A), _mm256_andnot_si256(C, B) ) );
+    }
+    Gia_SimMuxScalar( pOut + w, pC + w, p1 + w, p0 + w, mC, m1, m0, nWords - w );
+}
+__attribute__((target("avx2"))) static int Gia_SimEqualAvx2( word * p0, word * p1, word m, int nWords )
+{
+    __m256i M = _mm256_set1_epi64x( (long long)m ), D;
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        D = _mm256_xor_si256( _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p0 + w)), _mm256_loadu_si256((__m256i *)(p1 + w))), M );
+        if ( !_mm256_testz_si256(D, D) )
+            return 0;
+    }
+    return Gia_SimEqualScalar( p0 + w, p1 + w, m, nWords - w );
+}
+__attribute__((target("avx2"))) static unsigned Gia_SimHashAvx2( word * p, int nWords )
+{
+    unsigned uHash = 0, uMask = (p[0] & 1) ? ~0u : 0, * pU = (unsigned *)p, Buf[8];
+    __m256i M = _mm256_set1_epi32( (int)uMask ), H = _mm256_setzero_si256();
+    __m256i P0 = _mm256_loadu_si256( (__m256i *)(s_SimPrimes + 0) ), P1 = _mm256_loadu_si256( (__m256i *)(s_SimPrimes + 8) );
+    int i, k, nU = 2 * nWords;
+    for ( i = 0; i + 16 <= nU; i += 16 )
+    {
+        H = _mm256_xor_si256( H, _mm256_mullo_epi32(_mm256_xor_si256(_mm256_loadu_si256((__m256i *)(pU + i + 0)), M), P0) );
+        H = _mm256_xor_si256( H, _mm256_mullo_epi32(_mm256_xor_si256(_mm256_loadu_si256((__m256i *)(pU + i + 8)), M), P1) );
+    }
+    _mm256_storeu_si256( (__m256i *)Buf, H );
+    for ( k = 0; k < 8; k++ )
+        uHash ^= Buf[k];
+    for ( ; i < nU; i++ )
+        uHash ^= (pU[i] ^ uMask) * s_SimPrimes[i & 0xf];
+    return uHash;
+}
+
+// AVX-512 (512-bit)
+__attribute__((target("avx512f"))) static void Gia_SimAndAvx512( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    __m512i M0 = _mm512_set1_epi64( (long long)m0 ), M1 = _mm512_set1_epi64( (long long)m1 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512( _mm512_xor_si512(_mm512_loadu_si512((void *)(p0 + w)), M0), _mm512_xor_si512(_mm512_loadu_si512((void *)(p1 + w)), M1) ) );
+    Gia_SimAndScalar( pOut + w, p0 + w, p1 + w, m0, m1, nWords - w );
+}
+__attribute__((target("avx512f"))) static void Gia_SimXorAvx512( word * pOut, word * p0, word * p1, word m0, word m1, int nWords )
+{
+    __m512i M = _mm512_set1_epi64( (long long)(m0 ^ m1) );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512( _mm512_xor_si512(_mm512_loadu_si512((void *)(p0 + w)), _mm512_loadu_si512((void *)(p1 + w))), M ) );
+    Gia_SimXorScalar( pOut + w, p0 + w, p1 + w, m0, m1, nWords - w );
+}
+__attribute__((target("avx512f"))) static void Gia_SimMuxAvx512( word * pOut, word * pC, word * p1, word * p0, word mC, word m1, word m0, int nWords )
+{
+    __m512i MC = _mm512_set1_epi64( (long long)mC ), M1 = _mm512_set1_epi64( (long long)m1 ), M0 = _mm512_set1_epi64( (long long)m0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i C = _mm512_xor_si512( _mm512_loadu_si512((void *)(pC + w)), MC );
+        __m512i A = _mm512_xor_si512( _mm512_loadu_si512((void *)(p1 + w)), M1 );
+        __m512i B = _mm512_xor_si512( _mm512_loadu_si512((void *)(p0 + w)), M0 );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_or_si512( _mm512_and_si512(C, A), _mm512_andnot_si512(C, B) ) );
+    }
+    Gia_SimMuxScalar( pOut + w, pC + w, p1 + w, p0 + w, mC, m1, m0, nWords - w );
+}
+__attribute__((target("avx512f"))) static int Gia_SimEqualAvx512( word * p0, word * p1, word m, int nWords )
+{
+    __m512i M = _mm512_set1_epi64( (long long)m ), D;
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        D = _mm512_xor_si512( _mm512_xor_si512(_mm512_loadu_si512((void *)(p0 + w)), _mm512_loadu_si512((void *)(p1 + w))), M );
+        if ( _mm512_test_epi64_mask(D, D) )
+            return 0;
+    }
+    return Gia_SimEqualScalar( p0 + w, p1 + w, m, nWords - w );
+}
+__attribute__((target("avx512f"))) static unsigned Gia_SimHashAvx512( word * p, int nWords )
+{
+    unsigned uHash = 0, uMask = (p[0] & 1) ? ~0u : 0, * pU = (unsigned *)p, Buf[16];
+    __m512i M = _mm512_set1_epi32( (int)uMask ), H = _mm512_setzero_si512();
+    __m512i P = _mm512_loadu_si512( (void *)s_SimPrimes );
+    int i, k, nU = 2 * nWords;
+    for ( i = 0; i + 16 <= nU; i += 16 )
+        H = _mm512_xor_si512( H, _mm512_mullo_epi32(_mm512_xor_si512(_mm512_loadu_si512((void *)(pU + i)), M), P) );
+    _mm512_storeu_si512( (void *)Buf, H );
+    for ( k = 0; k < 16; k++ )
+        uHash ^= Buf[k];
+    for ( ; i < nU; i++ )
+        uHash ^= (pU[i] ^ uMask) * s_SimPrimes[i & 0xf];
+    return uHash;
+}
+
+__attribute__((target("sse4.2")))  GIA_SIM_ANDS( Gia_SimAndsSse,    Gia_SimAndSse    )
+__attribute__((target("avx2")))    GIA_SIM_ANDS( Gia_SimAndsAvx2,   Gia_SimAndAvx2   )
+__attribute__((target("avx512f"))) GIA_SIM_ANDS( Gia_SimAndsAvx512, Gia_SimAndAvx512 )
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the simulation kernels.]
+
+  Description [Gia_SimKernelSet() takes the kernel number (0 = scalar,
+  1 = SSE4.2, 2 = AVX2, 3 = AVX-512) or -1 for the best one supported by
+  the CPU, and returns the previous number. The numbers above the best
+  supported one are reduced to it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_SimKer_t s_SimKers[GIA_SIM_KER_NUM] = {
+    { "scalar",  Gia_SimAndScalar, Gia_SimXorScalar, Gia_SimMuxScalar, Gia_SimEqualScalar, Gia_SimHashScalar, Gia_SimAndsScalar },
+#ifdef GIA_SIM_DISPATCH
+    { "sse4.2",  Gia_SimAndSse,    Gia_SimXorSse,    Gia_SimMuxSse,    Gia_SimEqualSse,    Gia_SimHashSse,    Gia_SimAndsSse    },
+    { "avx2",    Gia_SimAndAvx2,   Gia_SimXorAvx2,   Gia_SimMuxAvx2,   Gia_SimEqualAvx2,   Gia_SimHashAvx2,   Gia_SimAndsAvx2   },
+    { "avx512",  Gia_SimAndAvx512, Gia_SimXorAvx512, Gia_SimMuxAvx512, Gia_SimEqualAvx512, Gia_SimHashAvx512, Gia_SimAndsAvx512 },
+#endif
+};
+static int s_SimKerCur = -1;
+
+int Gia_SimKernelBest()
+{
+#ifdef GIA_SIM_DISPATCH
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return 3;
+    if ( __builtin_cpu_supports("avx2") )
+        return 2;
+    if ( __builtin_cpu_supports("sse4.2") )
+        return 1;
+#endif
+    return 0;
+}
+int Gia_SimKernelSet( int iKer )
+{
+    int iKerOld = s_SimKerCur, iKerBest = Gia_SimKernelBest();
+    s_SimKerCur = (iKer < 0 || iKer > iKerBest) ? iKerBest : iKer;
+    return iKerOld;
+}
+char * Gia_SimKernelName()
+{
+    if ( s_SimKerCur < 0 )
+        Gia_SimKernelSet( -1 );
+    return s_SimKers[s_SimKerCur].pName;
+}
+static inline Gia_SimKer_t * Gia_SimKer()
+{
+    if ( s_SimKerCur < 0 )
+        Gia_SimKernelSet( -1 );
+    return s_SimKers + s_SimKerCur;
+}
+Gia_SimKer_t * Gia_SimKernelGet()
+{
+    return Gia_SimKer();
+}
+void Gia_SimKernelAnd( word * pOut, word * p0, word * p1, int fCompl0, int fCompl1, int nWords )
+{
+    Gia_SimKer()->pFuncAnd( pOut, p0, p1, fCompl0 ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0, nWords );
+}
+void Gia_SimKernelXor( word * pOut, word * p0, word * p1, int fCompl0, int fCompl1, int nWords )
+{
+    Gia_SimKer()->pFuncXor( pOut, p0, p1, fCompl0 ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0, nWords );
+}
+void Gia_SimKernelMux( word * pOut, word * pC, word * p1, word * p0, int fComplC, int fCompl1, int fCompl0, int nWords )
+{
+    Gia_SimKer()->pFuncMux( pOut, pC, p1, p0, fComplC ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0, fCompl0 ? ~(word)0 : 0, nWords );
+}
+int Gia_SimKernelEqual( word * p0, word * p1, int fCompl, int nWords )
+{
+    return Gia_SimKer()->pFuncEqual( p0, p1, fCompl ? ~(word)0 : 0, nWords );
+}
+unsigned Gia_SimKernelHash( word * p, int nWords )
+{
+    return Gia_SimKer()->pFuncHash( p, nWords );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -89,32 +466,36 @@ void Gia_ManSimPatAssignInputs( Gia_Man_t * p, int nWords, Vec_Wrd_t * vSims, Ve
     Gia_ManForEachCiId( p, Id, i )
         memcpy( Vec_WrdEntryP(vSims, Id*nWords), Vec_WrdEntryP(vSimsIn, i*nWords), sizeof(word)*nWords );
 }
-static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+// simulates nUse words of the node, whose info is stored nWords apart starting at pSims
+static inline void Gia_ManSimPatSimAndInt( Gia_Man_t * p, int i, Gia_Obj_t * pObj, word * pSims, int nWords, int nUse )
 {
-    word pComps[2] = { 0, ~(word)0 };
-    word Diff0 = pComps[Gia_ObjFaninC0(pObj)];
-    word Diff1 = pComps[Gia_ObjFaninC1(pObj)];
-    word * pSims  = Vec_WrdArray(vSims);
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
-    word * pSims2 = pSims + nWords*i; int w;
-    if ( Gia_ObjIsXor(pObj) )
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
+    word * pSims2 = pSims + nWords*i;
+    if ( Gia_ObjIsMuxId(p, i) )
+        Gia_SimKernelMux( pSims2, pSims + nWords*Gia_ObjFaninId2(p, i), pSims1, pSims0, Gia_ObjFaninC2(p, pObj), Gia_ObjFaninC1(pObj), Gia_ObjFaninC0(pObj), nUse );
+    else if ( Gia_ObjIsXor(pObj) )
+        Gia_SimKernelXor( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nUse );
     else
-        for ( w = 0; w < nWords; w++ )
-            pSims2[w] = (pSims0[w] ^ Diff0) & (pSims1[w] ^ Diff1);
+        Gia_SimKernelAnd( pSims2, pSims0, pSims1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nUse );
 }
-static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+static inline void Gia_ManSimPatSimPoInt( Gia_Man_t * p, int i, Gia_Obj_t * pObj, word * pSims, int nWords, int nUse )
 {
     word pComps[2] = { 0, ~(word)0 };
     word Diff0     = pComps[Gia_ObjFaninC0(pObj)];
-    word * pSims   = Vec_WrdArray(vSims);
     word * pSims0  = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims2  = pSims + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
+    for ( w = 0; w < nUse; w++ )
         pSims2[w] = (pSims0[w] ^ Diff0);
 }
+static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_ManSimPatSimAndInt( p, i, pObj, Vec_WrdArray(vSims), nWords, nWords );
+}
+static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_ManSimPatSimPoInt( p, i, pObj, Vec_WrdArray(vSims), nWords, nWords );
+}
 Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
     Gia_Obj_t * pObj;
@@ -122,6 +503,11 @@ Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
     Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
+    if ( s_nSimThreads > 1 )
+    {
+        Gia_ManSimPatSimPar( pGia, vSims, nWords, s_nSimThreads, 1 );
+        return vSims;
+    }
     Gia_ManForEachAnd( pGia, pObj, i ) 
         Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
     Gia_ManForEachCo( pGia, pObj, i )
@@ -129,6 +515,346 @@ Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
     return vSims;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Sets the number of threads used by the pattern simulator.]
+
+  Description [Returns the previous number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimSetThreads( int nThreads )
+{
+    int nThreadsOld = s_nSimThreads;
+    s_nSimThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, GIA_SIM_THR_MAX) );
+    return nThreadsOld;
+}
+int Gia_ManSimGetThreads()
+{
+    return s_nSimThreads;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded combinational simulation.]
+
+  Description [Simulates the internal nodes (and the COs if fCos is set) 
+  of the AIG, whose CI simulation info is already in vSims (nWords words 
+  per object, stored in the order of object IDs). When there are enough 
+  words, each thread simulates all nodes for its own block of words. 
+  Otherwise, if the AIG is wide, the nodes of each logic level are divided 
+  among the threads, which synchronize after each level. The result does 
+  not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSimParBarrier( Gia_SimPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int Phase;
+    pthread_mutex_lock( &p->Mutex );
+    Phase = p->Phase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->Phase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+        while ( Phase == p->Phase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+static void Gia_ManSimParOrder( Gia_SimPar_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i, Level, nLevels = Gia_ManLevelNum( p->pGia );
+    int * pPlace;
+    // count the nodes on each level and find where each level starts
+    p->vStarts = Vec_IntStart( nLevels + 2 );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+        Vec_IntAddToEntry( p->vStarts, Gia_ObjLevelId(p->pGia, i) + 1, 1 );
+    for ( Level = 1; Level < Vec_IntSize(p->vStarts); Level++ )
+        Vec_IntAddToEntry( p->vStarts, Level, Vec_IntEntry(p->vStarts, Level-1) );
+    // place the nodes in the order of levels (and IDs within a level)
+    p->vOrder = Vec_IntStart( Gia_ManAndNum(p->pGia) );
+    pPlace = ABC_ALLOC( int, Vec_IntSize(p->vStarts) );
+    memcpy( pPlace, Vec_IntArray(p->vStarts), sizeof(int) * Vec_IntSize(p->vStarts) );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+        Vec_IntWriteEntry( p->vOrder, pPlace[Gia_ObjLevelId(p->pGia, i)]++, i );
+    ABC_FREE( pPlace );
+}
+static void Gia_ManSimParProcess( Gia_SimPar_t * p, int iThread )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Gia_Obj_t * pObj;
+    word * pSims = Vec_WrdArray( p->vSims );
+    int i, k, Level, Beg, End;
+    if ( p->vOrder == NULL )
+    {
+        // simulate a block of words for all objects
+        int nUnits = (p->nWords + p->nUnit - 1) / p->nUnit;
+        int wStart = Abc_MinInt( p->nWords, p->nUnit * (nUnits * iThread / p->nThreads) );
+        int wStop  = Abc_MinInt( p->nWords, p->nUnit * (nUnits * (iThread + 1) / p->nThreads) );
+        if ( wStart == wStop )
+            return;
+        Gia_ManForEachAnd( pGia, pObj, i )
+            Gia_ManSimPatSimAndInt( pGia, i, pObj, pSims + wStart, p->nWords, wStop - wStart );
+        if ( p->fCos )
+            Gia_ManForEachCo( pGia, pObj, i )
+                Gia_ManSimPatSimPoInt( pGia, Gia_ObjId(pGia, pObj), pObj, pSims + wStart, p->nWords, wStop - wStart );
+        return;
+    }
+    // simulate a slice of each level
+    for ( Level = 1; Level + 1 < Vec_IntSize(p->vStarts); Level++ )
+    {
+        Beg = Vec_IntEntry( p->vStarts, Level );
+        End = Vec_IntEntry( p->vStarts, Level + 1 );
+        for ( k = Beg + (End - Beg) * iThread / p->nThreads; k < Beg + (End - Beg) * (iThread + 1) / p->nThreads; k++ )
+        {
+            i = Vec_IntEntry( p->vOrder, k );
+            Gia_ManSimPatSimAndInt( pGia, i, Gia_ManObj(pGia, i), pSims, p->nWords, p->nWords );
+        }
+        Gia_ManSimParBarrier( p );
+    }
+    if ( p->fCos )
+        for ( k = Gia_ManCoNum(pGia) * iThread / p->nThreads; k < Gia_ManCoNum(pGia) * (iThread + 1) / p->nThreads; k++ )
+        {
+            pObj = Gia_ManCo( pGia, k );
+            Gia_ManSimPatSimPoInt( pGia, Gia_ObjId(pGia, pObj), pObj, pSims, p->nWords, p->nWords );
+        }
+}
+#ifdef ABC_USE_PTHREADS
+typedef struct Gia_SimThr_t_ Gia_SimThr_t;
+struct Gia_SimThr_t_
+{
+    Gia_SimPar_t *  p;
+    int             iThread;
+};
+static void * Gia_ManSimParWorkerThread( void * pArg )
+{
+    Gia_SimThr_t * pThData = (Gia_SimThr_t *)pArg;
+    Gia_ManSimParProcess( pThData->p, pThData->iThread );
+    return NULL;
+}
+#endif
+void Gia_ManSimPatSimPar( Gia_Man_t * pGia, Vec_Wrd_t * vSims, int nWords, int nThreads, int fCos )
+{
+    Gia_SimPar_t Par, * p = &Par;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( Vec_WrdSize(vSims) == nWords * Gia_ManObjNum(pGia) );
+    memset( p, 0, sizeof(Gia_SimPar_t) );
+    p->pGia     = pGia;
+    p->vSims    = vSims;
+    p->nWords   = nWords;
+    p->fCos     = fCos;
+    p->nThreads = Abc_MinInt( nThreads, GIA_SIM_THR_MAX );
+#ifdef ABC_USE_PTHREADS
+    if ( p->nThreads > 1 && nWords >= 4 * p->nThreads )
+    {
+        // split the words (by cache lines when there are enough of them)
+        p->nUnit = nWords >= 8 * p->nThreads ? 8 : 1;
+    }
+    else if ( p->nThreads > 1 && Gia_ManAndNum(pGia) >= GIA_SIM_PAR_WIDTH * p->nThreads * Gia_ManLevelNum(pGia) )
+    {
+        // split the levels of a wide AIG
+        Gia_ManSimParOrder( p );
+        pthread_mutex_init( &p->Mutex, NULL );
+        pthread_cond_init( &p->Cond, NULL );
+    }
+    else
+        p->nThreads = 1;
+    if ( p->nThreads > 1 )
+    {
+        pthread_t WorkerThread[GIA_SIM_THR_MAX];
+        Gia_SimThr_t ThData[GIA_SIM_THR_MAX];
+        int status;
+        for ( i = 0; i < p->nThreads; i++ )
+        {
+            ThData[i].p       = p;
+            ThData[i].iThread = i;
+            status = pthread_create( WorkerThread + i, NULL, Gia_ManSimParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < p->nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        if ( p->vOrder )
+        {
+            pthread_mutex_destroy( &p->Mutex );
+            pthread_cond_destroy( &p->Cond );
+            Vec_IntFree( p->vOrder );
+            Vec_IntFree( p->vStarts );
+        }
+        return;
+    }
+#endif
+    Gia_ManForEachAnd( pGia, pObj, i ) 
+        Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
+    if ( fCos )
+        Gia_ManForEachCo( pGia, pObj, i )
+            Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Random simulation of a combinational AIG.]
+
+  Description [Simulates nIters rounds of nWords random words using 
+  the multi-threaded simulator. If fCheckMiter is set, stops when 
+  a PO is asserted and saves the counter-example in pCexSeq (with 
+  one timeframe). Returns 1 if a counter-example is found.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimSimulateComb( Gia_Man_t * p, Gia_ParSim_t * pPars )
+{
+    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(p) * pPars->nWords );
+    Gia_Obj_t * pObj;
+    abctime clkTotal = Abc_ClockWall();
+    abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + clkTotal : 0;
+    int i, r, w, Id, iPat = -1, RetValue = 0, nWords = pPars->nWords;
+    assert( Gia_ManRegNum(p) == 0 );
+    ABC_FREE( p->pCexSeq );
+    pPars->iOutFail = -1;
+    Gia_ManRandomW( 1 );
+    for ( i = 0; i < pPars->RandSeed; i++ )
+        Gia_ManRandomW( 0 );
+    for ( r = 0; r < pPars->nIters; r++ )
+    {
+        Gia_ManForEachCiId( p, Id, i )
+            for ( w = 0; w < nWords; w++ )
+                Vec_WrdWriteEntry( vSims, Id*nWords+w, Gia_ManRandomW(0) );
+        Gia_ManSimPatSimPar( p, vSims, nWords, pPars->nThreads, 1 );
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Round %4d out of %4d and timeout %3d sec. ", r+1, pPars->nIters, pPars->TimeLimit );
+            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_ClockWall()-clkTotal)/CLOCKS_PER_SEC );
+        }
+        if ( pPars->fCheckMiter )
+        {
+            Gia_ManForEachPo( p, pObj, i )
+                if ( (iPat = Abc_TtFindFirstBit2(Vec_WrdEntryP(vSims, Gia_ObjId(p, pObj)*nWords), nWords)) >= 0 )
+                    break;
+            if ( i < Gia_ManPoNum(p) )
+            {
+                pPars->iOutFail = i;
+                p->pCexSeq = Abc_CexAlloc( 0, Gia_ManPiNum(p), 1 );
+                p->pCexSeq->iFrame = 0;
+                p->pCexSeq->iPo = i;
+                Gia_ManForEachPi( p, pObj, i )
+                    if ( Abc_TtGetBit(Vec_WrdEntryP(vSims, Gia_ObjId(p, pObj)*nWords), iPat) )
+                        Abc_InfoSetBit( p->pCexSeq->pData, i );
+                Abc_Print( 1, "Output %d of miter \"%s\" was asserted in round %d.  ", pPars->iOutFail, p->pName, r );
+                if ( !Gia_ManVerifyCex( p, p->pCexSeq, 0 ) )
+                    Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
+                RetValue = 1;
+                r++;
+                break;
+            }
+        }
+        if ( nTimeToStop && Abc_ClockWall() > nTimeToStop )
+        {
+            r++;
+            break;
+        }
+    }
+    Vec_WrdFree( vSims );
+    if ( p->pCexSeq == NULL )
+        Abc_Print( 1, "No bug detected after simulating %d rounds with %d words.  ", r, nWords );
+    Abc_PrintTime( 1, "Time", Abc_ClockWall() - clkTotal );
+    if ( pPars->fVerbose )
+    {
+        double Time = 1.0*(Abc_ClockWall() - clkTotal)/CLOCKS_PER_SEC;
+        Abc_Print( 1, "Simulated %.0f node-patterns using %d thread(s) (%.2f M/sec).\n", 
+            64.0 * nWords * r * Gia_ManAndNum(p), pPars->nThreads, Time > 0 ? 64.0 * nWords * r * Gia_ManAndNum(p) / Time / 1000000 : 0.0 );
+    }
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks the simulation kernels.]
+
+  Description [Simulates the AIG with random patterns using each kernel
+  supported by the CPU (or only kernel iKernel, if it is not -1) and 
+  reports the number of simulated node-patterns per second for simulation
+  and for hashing/comparing used by the class refinement. The checksums 
+  of all kernels should be the same. The kernel selected for the other 
+  commands is restored.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimKernelBench( Gia_Man_t * p, int nWords, int nRounds, int iKernel, int fVerbose )
+{
+    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(p) * nWords );
+    Gia_Obj_t * pObj;
+    int i, r, w, Id, nEquals, iKer, iKerBest = Gia_SimKernelBest();
+    int iKerOld = Gia_SimKernelSet( -1 );
+    unsigned uCheck, uCheck0 = 0;
+    double nPats = 64.0 * nWords * nRounds * Gia_ManAndNum(p);
+    abctime clk, clkSim, clkCmp;
+    Gia_ManRandomW( 1 );
+    Gia_ManForEachCiId( p, Id, i )
+        for ( w = 0; w < nWords; w++ )
+            Vec_WrdWriteEntry( vSims, Id*nWords+w, Gia_ManRandomW(0) );
+    Abc_Print( 1, "Simulating %d nodes with %d patterns for %d rounds.\n", Gia_ManAndNum(p), 64 * nWords, nRounds );
+    if ( iKernel > iKerBest )
+        Abc_Print( 1, "Kernel %d is not supported by the CPU. Using kernel %d.\n", iKernel, iKerBest );
+    for ( iKer = 0; iKer <= iKerBest; iKer++ )
+    {
+        if ( iKernel >= 0 && iKer != Abc_MinInt(iKernel, iKerBest) )
+            continue;
+        Gia_SimKernelSet( iKer );
+        clk = Abc_Clock();
+        for ( r = 0; r < nRounds; r++ )
+            Gia_ManForEachAnd( p, pObj, i )
+                Gia_ManSimPatSimAnd( p, i, pObj, nWords, vSims );
+        clkSim = Abc_Clock() - clk;
+        clk = Abc_Clock();
+        uCheck = 0;
+        nEquals = 0;
+        for ( r = 0; r < nRounds; r++ )
+            Gia_ManForEachAnd( p, pObj, i )
+            {
+                word * pSim  = Vec_WrdEntryP( vSims, nWords*i );
+                word * pSim0 = Vec_WrdEntryP( vSims, nWords*Gia_ObjFaninId0(pObj, i) );
+                uCheck  += Gia_SimKernelHash( pSim, nWords );
+                nEquals += Gia_SimKernelEqual( pSim, pSim0, (pSim[0] ^ pSim0[0]) & 1, nWords );
+            }
+        clkCmp = Abc_Clock() - clk;
+        if ( iKer == 0 || iKernel >= 0 )
+            uCheck0 = uCheck;
+        Abc_Print( 1, "%-7s : Sim =%10.2f M node-pats/sec   Hash+cmp =%10.2f M node-pats/sec   Check = %08x%s\n", 
+            Gia_SimKernelName(), 
+            nPats / 1000000 / Abc_MaxDouble(1.0 * clkSim / CLOCKS_PER_SEC, 0.000001),
+            nPats / 1000000 / Abc_MaxDouble(1.0 * clkCmp / CLOCKS_PER_SEC, 0.000001),
+            uCheck, uCheck == uCheck0 ? "" : "  (MISMATCH)" );
+        if ( fVerbose )
+        {
+            Abc_PrintTime( 1, "Simulation", clkSim );
+            Abc_PrintTime( 1, "Hash+cmp  ", clkCmp );
+            Abc_Print( 1, "Nodes equal to their first fanin = %d.\n", nEquals / nRounds );
+        }
+    }
+    Gia_SimKernelSet( iKerOld );
+    Vec_WrdFree( vSims );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -157,18 +883,10 @@ static inline void Gia_ManSimPatSimAnd2( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims0 = pSims + nWords*Gia_ObjFaninLit0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninLit1(pObj, i);
     word * pSims2 = pSims + nWords*(2*i+0); 
-    word * pSims3 = pSims + nWords*(2*i+1); int w;
+    word * pSims3 = pSims + nWords*(2*i+1);
     assert( !Gia_ObjIsXor(pObj) );
-//    if ( Gia_ObjIsXor(pObj) )
-//        for ( w = 0; w < nWords; w++ )
-//            pSims2[w] = pSims0[w] ^ pSims1[w];
-//    else
-    for ( w = 0; w < nWords; w++ )
-    {
-        pSims2[w] = pSims0[w] & pSims1[w];
-        pSims3[w] = ~pSims2[w];
-    }
-    //_mm256_storeu_ps( (float *)pSims2, _mm256_and_ps(_mm256_loadu_ps((float *)pSims0), _mm256_loadu_ps((float *)pSims1)) );
+    Gia_SimKernelAnd( pSims2, pSims0, pSims1, 0, 0, nWords );
+    Abc_TtCopy( pSims3, pSims2, nWords, 1 );
 }
 static inline void Gia_ManSimPatSimPo2( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilTruth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -38,9 +39,6 @@ static inline void Gia_ManTerSimInfoSet( unsigned * pInfo, int i, int Value )
     pInfo[i >> 4] ^= (Value << ((i & 15) << 1));
 }
 
-static inline unsigned * Gia_ManTerStateNext( unsigned * pState, int nWords )                      { return *((unsigned **)(pState + nWords));  }
-static inline void       Gia_ManTerStateSetNext( unsigned * pState, int nWords, unsigned * pNext ) { *((unsigned **)(pState + nWords)) = pNext; }
-
 // ternary simulation manager
 typedef struct Gia_ManTer_t_ Gia_ManTer_t;
 struct Gia_ManTer_t_
@@ -54,15 +52,59 @@ struct Gia_ManTer_t_
     char *         pRetired;     // retired registers
     int *          pCount0;
     int *          pCountX;
+    int *          pSince;       // the first state where the register has its current value
     // hash table for states
     int            nBins;
-    unsigned **    pBins;
-    // simulation information
-    unsigned *     pDataSim;     // simulation data
-    unsigned *     pDataSimCis;  // simulation data for CIs
-    unsigned *     pDataSimCos;  // simulation data for COs
+    int *          pBins;        // the first state in each bin
+    Vec_Int_t *    vNexts;       // the next state in the same bin
+    Vec_Wrd_t *    vKeys;        // the Zobrist key of each state
+    word           Key;          // the Zobrist key of the last state
+    // dual-rail simulation information
+    word *         pRail0;       // objects that can be 0
+    word *         pRail1;       // objects that can be 1
+    word *         pEvents;      // AND nodes scheduled for evaluation
+    int            iEventMin;
+    int            iEventMax;
+    Vec_Int_t *    vRiChanged;   // registers whose next-state value may have changed
+    Vec_Int_t *    vRiSpare;
+    Vec_Int_t *    vRoChanged;   // registers whose current value may have changed
+    char *         pRiMarks;
+    char *         pRoMarks;
+    // statistics
+    word           nEvals;       // the number of node evaluations
+    word           nChanges;     // the number of register value changes
 };
 
+static inline int Gia_ManTerObjGet( Gia_ManTer_t * p, int iObj )
+{
+    return (int)((p->pRail0[iObj >> 6] >> (iObj & 63)) & 1) | ((int)((p->pRail1[iObj >> 6] >> (iObj & 63)) & 1) << 1);
+}
+static inline void Gia_ManTerObjSet( Gia_ManTer_t * p, int iObj, int Value )
+{
+    word Mask = (word)1 << (iObj & 63);
+    assert( Value >= GIA_ZER && Value <= GIA_UND );
+    if ( Value & 1 ) p->pRail0[iObj >> 6] |= Mask; else p->pRail0[iObj >> 6] &= ~Mask;
+    if ( Value & 2 ) p->pRail1[iObj >> 6] |= Mask; else p->pRail1[iObj >> 6] &= ~Mask;
+}
+static inline int Gia_ManTerLitGet( Gia_ManTer_t * p, int iObj, int fCompl )
+{
+    int Value = Gia_ManTerObjGet( p, iObj );
+    return fCompl ? ((Value >> 1) | (Value << 1)) & 3 : Value;
+}
+static inline int Gia_ManTerRoGet( Gia_ManTer_t * p, int iReg )
+{
+    return Gia_ManTerObjGet( p, Gia_ObjId(p->pAig, Gia_ManRo(p->pAig, iReg)) );
+}
+
+// random key of the register having the given ternary value (splitmix64)
+static inline word Gia_ManTerZobrist( int iReg, int Value )
+{
+    word x = (((word)iReg << 2) | (word)Value) + ABC_CONST(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -71,8 +113,10 @@ struct Gia_ManTer_t_
 
   Synopsis    [Creates fast simulation manager.]
 
-  Description []
-               
+  Description [The values are kept in dual-rail form: one bit-plane
+  records whether the object can be 0, the other whether it can be 1.
+  Static fanouts are used to propagate the changes between the frames.]
+
   SideEffects []
 
   SeeAlso     []
@@ -81,19 +125,32 @@ struct Gia_ManTer_t_
 Gia_ManTer_t * Gia_ManTerCreate( Gia_Man_t * pAig )
 {
     Gia_ManTer_t * p;
+    int nObjWords;
     p = ABC_CALLOC( Gia_ManTer_t, 1 );
-    p->pAig   = Gia_ManFront( pAig );
+    p->pAig   = Gia_ManDup( pAig );
     p->nIters = 300;
-    p->pDataSim    = ABC_ALLOC( unsigned, Abc_BitWordNum(2*p->pAig->nFront) );
-    p->pDataSimCis = ABC_ALLOC( unsigned, Abc_BitWordNum(2*Gia_ManCiNum(p->pAig)) );
-    p->pDataSimCos = ABC_ALLOC( unsigned, Abc_BitWordNum(2*Gia_ManCoNum(p->pAig)) );
+    Gia_ManStaticFanoutStart( p->pAig );
+    nObjWords   = Abc_Bit6WordNum( Gia_ManObjNum(p->pAig) );
+    p->pRail0   = ABC_CALLOC( word, nObjWords );
+    p->pRail1   = ABC_CALLOC( word, nObjWords );
+    p->pEvents  = ABC_CALLOC( word, nObjWords );
+    p->iEventMin = Gia_ManObjNum(p->pAig);
+    p->iEventMax = -1;
+    p->vRiChanged = Vec_IntAlloc( Gia_ManRegNum(pAig) );
+    p->vRiSpare   = Vec_IntAlloc( Gia_ManRegNum(pAig) );
+    p->vRoChanged = Vec_IntAlloc( Gia_ManRegNum(pAig) );
+    p->pRiMarks = ABC_CALLOC( char, Gia_ManRegNum(pAig) );
+    p->pRoMarks = ABC_CALLOC( char, Gia_ManRegNum(pAig) );
     // allocate storage for terminary states
     p->nStateWords = Abc_BitWordNum( 2*Gia_ManRegNum(pAig) );
     p->vStates  = Vec_PtrAlloc( 1000 );
     p->pCount0  = ABC_CALLOC( int, Gia_ManRegNum(pAig) );
     p->pCountX  = ABC_CALLOC( int, Gia_ManRegNum(pAig) );
-    p->nBins    = Abc_PrimeCudd( 500 );
-    p->pBins    = ABC_CALLOC( unsigned *, p->nBins );
+    p->pSince   = ABC_CALLOC( int, Gia_ManRegNum(pAig) );
+    p->nBins    = 1024;
+    p->pBins    = ABC_FALLOC( int, p->nBins );
+    p->vNexts   = Vec_IntAlloc( 1000 );
+    p->vKeys    = Vec_WrdAlloc( 1000 );
     p->vRetired = Vec_IntAlloc( 100 );
     p->pRetired = ABC_CALLOC( char, Gia_ManRegNum(pAig) );
     return p;
@@ -104,7 +161,7 @@ Gia_ManTer_t * Gia_ManTerCreate( Gia_Man_t * pAig )
   Synopsis    []
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
@@ -124,7 +181,7 @@ void Gia_ManTerStatesFree( Vec_Ptr_t * vStates )
   Synopsis    []
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
@@ -132,79 +189,97 @@ void Gia_ManTerStatesFree( Vec_Ptr_t * vStates )
 ***********************************************************************/
 void Gia_ManTerDelete( Gia_ManTer_t * p )
 {
-    if ( p->vStates ) 
+    if ( p->vStates )
         Gia_ManTerStatesFree( p->vStates );
-    if ( p->vFlops ) 
+    if ( p->vFlops )
         Gia_ManTerStatesFree( p->vFlops );
     Gia_ManStop( p->pAig );
     Vec_IntFree( p->vRetired );
+    Vec_IntFree( p->vRiChanged );
+    Vec_IntFree( p->vRiSpare );
+    Vec_IntFree( p->vRoChanged );
+    Vec_IntFree( p->vNexts );
+    Vec_WrdFree( p->vKeys );
     ABC_FREE( p->pRetired );
+    ABC_FREE( p->pRiMarks );
+    ABC_FREE( p->pRoMarks );
     ABC_FREE( p->pCount0 );
     ABC_FREE( p->pCountX );
+    ABC_FREE( p->pSince );
     ABC_FREE( p->pBins );
-    ABC_FREE( p->pDataSim );
-    ABC_FREE( p->pDataSimCis );
-    ABC_FREE( p->pDataSimCos );
+    ABC_FREE( p->pRail0 );
+    ABC_FREE( p->pRail1 );
+    ABC_FREE( p->pEvents );
     ABC_FREE( p );
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
+  Synopsis    [Schedules the fanouts of the object whose value changed.]
 
-***********************************************************************/
-static inline void Gia_ManTerSimulateCi( Gia_ManTer_t * p, Gia_Obj_t * pObj, int iCi )
-{
-    Gia_ManTerSimInfoSet( p->pDataSim, Gia_ObjValue(pObj), Gia_ManTerSimInfoGet(p->pDataSimCis, iCi) );
-}
+  Description [AND nodes are marked for evaluation in the current round.
+  Register inputs are recorded to be transferred at the end of the round.]
 
-/**Function*************************************************************
-
-  Synopsis    []
-
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManTerSimulateCo( Gia_ManTer_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManTerScheduleFanouts( Gia_ManTer_t * p, int iObj )
 {
-    int Value = Gia_ManTerSimInfoGet( p->pDataSim, Gia_ObjDiff0(pObj) );
-    Gia_ManTerSimInfoSet( p->pDataSimCos, iCo, Gia_XsimNotCond( Value, Gia_ObjFaninC0(pObj) ) );
+    Gia_Obj_t * pFan;
+    int k, iFan, iReg;
+    Gia_ObjForEachFanoutStaticId( p->pAig, iObj, iFan, k )
+    {
+        pFan = Gia_ManObj( p->pAig, iFan );
+        if ( Gia_ObjIsAnd(pFan) )
+        {
+            p->pEvents[iFan >> 6] |= (word)1 << (iFan & 63);
+            p->iEventMin = Abc_MinInt( p->iEventMin, iFan );
+            p->iEventMax = Abc_MaxInt( p->iEventMax, iFan );
+        }
+        else if ( Gia_ObjIsRi(p->pAig, pFan) )
+        {
+            iReg = Gia_ObjCioId(pFan) - Gia_ManPoNum(p->pAig);
+            if ( p->pRiMarks[iReg] )
+                continue;
+            p->pRiMarks[iReg] = 1;
+            Vec_IntPush( p->vRiChanged, iReg );
+        }
+    }
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Sets the value of the register output.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManTerSimulateNode( Gia_ManTer_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManTerSetRo( Gia_ManTer_t * p, int iReg, int Value )
 {
-    int Value0 = Gia_ManTerSimInfoGet( p->pDataSim, Gia_ObjDiff0(pObj) );
-    int Value1 = Gia_ManTerSimInfoGet( p->pDataSim, Gia_ObjDiff1(pObj) );
-    Gia_ManTerSimInfoSet( p->pDataSim, Gia_ObjValue(pObj), Gia_XsimAndCond( Value0, Gia_ObjFaninC0(pObj), Value1, Gia_ObjFaninC1(pObj) ) );
+    int iObj = Gia_ObjId( p->pAig, Gia_ManRo(p->pAig, iReg) );
+    if ( Gia_ManTerObjGet(p, iObj) == Value )
+        return;
+    Gia_ManTerObjSet( p, iObj, Value );
+    Gia_ManTerScheduleFanouts( p, iObj );
+    if ( p->pRoMarks[iReg] )
+        return;
+    p->pRoMarks[iReg] = 1;
+    Vec_IntPush( p->vRoChanged, iReg );
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Sets the values of the first frame.]
+
+  Description [Primary inputs are undefined and registers are zero.
+  All internal nodes are scheduled for evaluation.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
@@ -212,19 +287,32 @@ static inline void Gia_ManTerSimulateNode( Gia_ManTer_t * p, Gia_Obj_t * pObj )
 ***********************************************************************/
 static inline void Gia_ManTerSimInfoInit( Gia_ManTer_t * p )
 {
-    int i = 0;
-    for ( ; i < Gia_ManPiNum(p->pAig); i++ )
-        Gia_ManTerSimInfoSet( p->pDataSimCis, i, GIA_UND );
-    for ( ; i < Gia_ManCiNum(p->pAig); i++ )
-        Gia_ManTerSimInfoSet( p->pDataSimCis, i, GIA_ZER );
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_ManTerObjSet( p, 0, GIA_ZER );
+    Gia_ManForEachPi( p->pAig, pObj, i )
+        Gia_ManTerObjSet( p, Gia_ObjId(p->pAig, pObj), GIA_UND );
+    Gia_ManForEachRo( p->pAig, pObj, i )
+        Gia_ManTerObjSet( p, Gia_ObjId(p->pAig, pObj), GIA_ZER );
+    Gia_ManForEachAnd( p->pAig, pObj, i )
+    {
+        p->pEvents[i >> 6] |= (word)1 << (i & 63);
+        p->iEventMin = Abc_MinInt( p->iEventMin, i );
+        p->iEventMax = Abc_MaxInt( p->iEventMax, i );
+    }
+    for ( i = 0; i < Gia_ManRegNum(p->pAig); i++ )
+    {
+        p->pRiMarks[i] = 1;
+        Vec_IntPush( p->vRiChanged, i );
+    }
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Transfers the changed register inputs to the outputs.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
@@ -232,48 +320,46 @@ static inline void Gia_ManTerSimInfoInit( Gia_ManTer_t * p )
 ***********************************************************************/
 static inline void Gia_ManTerSimInfoTransfer( Gia_ManTer_t * p )
 {
-    int i = 0;
-    for ( ; i < Gia_ManPiNum(p->pAig); i++ )
-        Gia_ManTerSimInfoSet( p->pDataSimCis, i, GIA_UND );
-    for ( ; i < Gia_ManCiNum(p->pAig); i++ )
-        Gia_ManTerSimInfoSet( p->pDataSimCis, i, Gia_ManTerSimInfoGet( p->pDataSimCos, Gia_ManCoNum(p->pAig)-Gia_ManCiNum(p->pAig)+i ) );
+    Vec_Int_t * vRiChanged = p->vRiChanged;
+    Gia_Obj_t * pObj;
+    int i, iReg, Entry;
+    // read all the inputs before the outputs are updated
+    Vec_IntForEachEntry( vRiChanged, iReg, i )
+    {
+        pObj = Gia_ManRi( p->pAig, iReg );
+        p->pRiMarks[iReg] = 0;
+        Vec_IntWriteEntry( vRiChanged, i, (iReg << 2) | Gia_ManTerLitGet(p, Gia_ObjFaninId0p(p->pAig, pObj), Gia_ObjFaninC0(pObj)) );
+    }
+    // the outputs may schedule the inputs of the next round
+    p->vRiChanged = p->vRiSpare;
+    Vec_IntForEachEntry( vRiChanged, Entry, i )
+        Gia_ManTerSetRo( p, Entry >> 2, Entry & 3 );
+    Vec_IntClear( vRiChanged );
+    p->vRiSpare = vRiChanged;
 }
 
-
 /**Function*************************************************************
 
-  Synopsis    [Computes hash value of the node using its simulation info.]
+  Synopsis    [Looks up the state in the table.]
+
+  Description [Returns the first state equal to the given one, or -1.
+  The states are compared by their Zobrist keys before comparing the
+  state words.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManTerStateHash( unsigned * pState, int nWords, int nTableSize )
-{
-    static int s_FPrimes[128] = { 
-        1009, 1049, 1093, 1151, 1201, 1249, 1297, 1361, 1427, 1459, 
-        1499, 1559, 1607, 1657, 1709, 1759, 1823, 1877, 1933, 1997, 
-        2039, 2089, 2141, 2213, 2269, 2311, 2371, 2411, 2467, 2543, 
-        2609, 2663, 2699, 2741, 2797, 2851, 2909, 2969, 3037, 3089, 
-        3169, 3221, 3299, 3331, 3389, 3461, 3517, 3557, 3613, 3671, 
-        3719, 3779, 3847, 3907, 3943, 4013, 4073, 4129, 4201, 4243, 
-        4289, 4363, 4441, 4493, 4549, 4621, 4663, 4729, 4793, 4871, 
-        4933, 4973, 5021, 5087, 5153, 5227, 5281, 5351, 5417, 5471, 
-        5519, 5573, 5651, 5693, 5749, 5821, 5861, 5923, 6011, 6073, 
-        6131, 6199, 6257, 6301, 6353, 6397, 6481, 6563, 6619, 6689, 
-        6737, 6803, 6863, 6917, 6977, 7027, 7109, 7187, 7237, 7309, 
-        7393, 7477, 7523, 7561, 7607, 7681, 7727, 7817, 7877, 7933, 
-        8011, 8039, 8059, 8081, 8093, 8111, 8123, 8147
-    };
-    unsigned uHash;
-    int i;
-    uHash = 0;
-    for ( i = 0; i < nWords; i++ )
-        uHash ^= pState[i] * s_FPrimes[i & 0x7F];
-    return uHash % nTableSize;
+int Gia_ManTerStateLookup( Gia_ManTer_t * p, int iState )
+{
+    unsigned * pState = (unsigned *)Vec_PtrEntry( p->vStates, iState );
+    word Key = Vec_WrdEntry( p->vKeys, iState );
+    int iEntry;
+    for ( iEntry = p->pBins[Key & (p->nBins-1)]; iEntry >= 0; iEntry = Vec_IntEntry(p->vNexts, iEntry) )
+        if ( Vec_WrdEntry(p->vKeys, iEntry) == Key && !memcmp( Vec_PtrEntry(p->vStates, iEntry), pState, sizeof(unsigned) * p->nStateWords ) )
+            return iEntry;
+    return -1;
 }
 
 /**Function*************************************************************
@@ -281,63 +367,87 @@ int Gia_ManTerStateHash( unsigned * pState, int nWords, int nTableSize )
   Synopsis    [Inserts value into the table.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-unsigned * Gia_ManTerStateLookup( unsigned * pState, int nWords, unsigned ** pBins, int nBins )
+void Gia_ManTerStateInsert( Gia_ManTer_t * p, int iState )
 {
-    unsigned * pEntry;
-    int Hash = Gia_ManTerStateHash( pState, nWords, nBins );
-    for ( pEntry = pBins[Hash]; pEntry; pEntry = Gia_ManTerStateNext(pEntry, nWords) )
-        if ( !memcmp( pEntry, pState, sizeof(unsigned) * nWords ) )
-            return pEntry;
-    return NULL;
+    int i, Hash;
+    assert( Gia_ManTerStateLookup(p, iState) == -1 );
+    assert( Vec_IntSize(p->vNexts) == iState );
+    Vec_IntPush( p->vNexts, -1 );
+    if ( Vec_IntSize(p->vNexts) > p->nBins )
+    {
+        // double the table and rehash the states
+        p->nBins *= 2;
+        ABC_FREE( p->pBins );
+        p->pBins = ABC_FALLOC( int, p->nBins );
+        for ( i = 0; i < iState; i++ )
+        {
+            Hash = (int)(Vec_WrdEntry(p->vKeys, i) & (p->nBins-1));
+            Vec_IntWriteEntry( p->vNexts, i, p->pBins[Hash] );
+            p->pBins[Hash] = i;
+        }
+    }
+    Hash = (int)(Vec_WrdEntry(p->vKeys, iState) & (p->nBins-1));
+    Vec_IntWriteEntry( p->vNexts, iState, p->pBins[Hash] );
+    p->pBins[Hash] = iState;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Inserts value into the table.]
+  Synopsis    [Allocs new ternary state.]
 
   Description []
-               
+
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManTerStateInsert( unsigned * pState, int nWords, unsigned ** pBins, int nBins )
+unsigned * Gia_ManTerStateAlloc( int nWords )
 {
-    int Hash = Gia_ManTerStateHash( pState, nWords, nBins );
-    assert( !Gia_ManTerStateLookup( pState, nWords, pBins, nBins ) );
-    Gia_ManTerStateSetNext( pState, nWords, pBins[Hash] );
-    pBins[Hash] = pState;    
+    return ABC_CALLOC( unsigned, nWords );
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Allocs new ternary state.]
+  Synopsis    [Accumulates the value counters of the register.]
+
+  Description [The counters are updated lazily: the register contributes
+  its previous value to all states recorded since its last change.]
 
-  Description []
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-unsigned * Gia_ManTerStateAlloc( int nWords )
+static inline void Gia_ManTerCountFlush( Gia_ManTer_t * p, int iReg, int Value, int iState )
 {
-    return (unsigned *)ABC_CALLOC( char, sizeof(unsigned) * nWords + sizeof(unsigned *) );
+    if ( Value == GIA_ZER )
+        p->pCount0[iReg] += iState - p->pSince[iReg];
+    if ( Value == GIA_UND )
+        p->pCountX[iReg] += iState - p->pSince[iReg];
+    p->pSince[iReg] = iState;
+}
+void Gia_ManTerCountUpdate( Gia_ManTer_t * p )
+{
+    unsigned * pLast = (unsigned *)Vec_PtrEntryLast( p->vStates );
+    int i;
+    for ( i = 0; i < Gia_ManRegNum(p->pAig); i++ )
+        Gia_ManTerCountFlush( p, i, Gia_ManTerSimInfoGet(pLast, i), Vec_PtrSize(p->vStates) );
 }
 
 /**Function*************************************************************
 
   Synopsis    [Creates new ternary state.]
 
-  Description []
-               
+  Description [The new state is derived from the previous one by updating
+  the registers whose value changed, together with the Zobrist key.]
+
   SideEffects []
 
   SeeAlso     []
@@ -345,27 +455,47 @@ unsigned * Gia_ManTerStateAlloc( int nWords )
 ***********************************************************************/
 unsigned * Gia_ManTerStateCreate( Gia_ManTer_t * p )
 {
-    int i, Value, nPis = Gia_ManPiNum(p->pAig);
     unsigned * pRes = Gia_ManTerStateAlloc( p->nStateWords );
-    for ( i = nPis; i < Gia_ManCiNum(p->pAig); i++ )
+    int i, iReg, Value, ValueOld, iState = Vec_PtrSize(p->vStates);
+    if ( iState == 0 )
     {
-        Value = Gia_ManTerSimInfoGet( p->pDataSimCis, i );
-        Gia_ManTerSimInfoSet( pRes, i-nPis, Value );
-        if ( Value == GIA_ZER )
-            p->pCount0[i-nPis]++;
-        if ( Value == GIA_UND )
-            p->pCountX[i-nPis]++;
+        for ( iReg = 0; iReg < Gia_ManRegNum(p->pAig); iReg++ )
+        {
+            Value = Gia_ManTerRoGet( p, iReg );
+            Gia_ManTerSimInfoSet( pRes, iReg, Value );
+            p->Key ^= Gia_ManTerZobrist( iReg, Value );
+        }
+    }
+    else
+    {
+        memcpy( pRes, Vec_PtrEntryLast(p->vStates), sizeof(unsigned) * p->nStateWords );
+        Vec_IntForEachEntry( p->vRoChanged, iReg, i )
+        {
+            Value    = Gia_ManTerRoGet( p, iReg );
+            ValueOld = Gia_ManTerSimInfoGet( pRes, iReg );
+            if ( Value == ValueOld )
+                continue;
+            Gia_ManTerCountFlush( p, iReg, ValueOld, iState );
+            Gia_ManTerSimInfoSet( pRes, iReg, Value );
+            p->Key ^= Gia_ManTerZobrist( iReg, ValueOld ) ^ Gia_ManTerZobrist( iReg, Value );
+            p->nChanges++;
+        }
     }
+    Vec_IntForEachEntry( p->vRoChanged, iReg, i )
+        p->pRoMarks[iReg] = 0;
+    Vec_IntClear( p->vRoChanged );
     Vec_PtrPush( p->vStates, pRes );
-    return pRes;    
+    Vec_WrdPush( p->vKeys, p->Key );
+    return pRes;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Performs one round of ternary simulation.]
 
-  Description []
-               
+  Description [Evaluates the scheduled nodes in the topological order.
+  Only the nodes in the fanout of the changed objects are visited.]
+
   SideEffects []
 
   SeeAlso     []
@@ -374,30 +504,45 @@ unsigned * Gia_ManTerStateCreate( Gia_ManTer_t * p )
 static inline void Gia_ManTerSimulateRound( Gia_ManTer_t * p )
 {
     Gia_Obj_t * pObj;
-    int i, iCis = 0, iCos = 0;
-    assert( p->pAig->nFront > 0 );
-    assert( Gia_ManConst0(p->pAig)->Value == 0 );
-    Gia_ManTerSimInfoSet( p->pDataSim, 0, GIA_ZER );
-    Gia_ManForEachObj1( p->pAig, pObj, i )
-    {
-        if ( Gia_ObjIsAndOrConst0(pObj) )
-        {
-            assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManTerSimulateNode( p, pObj );
-        }
-        else if ( Gia_ObjIsCi(pObj) )
-        {
-            assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManTerSimulateCi( p, pObj, iCis++ );
-        }
-        else // if ( Gia_ObjIsCo(pObj) )
+    int w, iObj, Value0, Value1, Value;
+    for ( w = p->iEventMin >> 6; w <= (p->iEventMax >> 6); w++ )
+        while ( p->pEvents[w] )
         {
-            assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManTerSimulateCo( p, iCos++, pObj );
+            iObj = (w << 6) + Abc_Tt6FirstBit( p->pEvents[w] );
+            p->pEvents[w] &= p->pEvents[w] - 1;
+            pObj = Gia_ManObj( p->pAig, iObj );
+            Value0 = Gia_ManTerLitGet( p, Gia_ObjFaninId0(pObj, iObj), Gia_ObjFaninC0(pObj) );
+            Value1 = Gia_ManTerLitGet( p, Gia_ObjFaninId1(pObj, iObj), Gia_ObjFaninC1(pObj) );
+            Value  = ((Value0 | Value1) & 1) | (Value0 & Value1 & 2);
+            p->nEvals++;
+            if ( Value == Gia_ManTerObjGet(p, iObj) )
+                continue;
+            Gia_ManTerObjSet( p, iObj, Value );
+            Gia_ManTerScheduleFanouts( p, iObj );
         }
-    }
-    assert( Gia_ManCiNum(p->pAig) == iCis );
-    assert( Gia_ManCoNum(p->pAig) == iCos );
+    p->iEventMin = Gia_ManObjNum(p->pAig);
+    p->iEventMax = -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the register undefined in the next round.]
+
+  Description [The register input is rescheduled, so that the value
+  computed in the next round is transferred even if it did not change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManTerRetireReg( Gia_ManTer_t * p, int iReg )
+{
+    Gia_ManTerSetRo( p, iReg, GIA_UND );
+    if ( p->pRiMarks[iReg] )
+        return;
+    p->pRiMarks[iReg] = 1;
+    Vec_IntPush( p->vRiChanged, iReg );
 }
 
 /**Function*************************************************************
@@ -415,6 +560,7 @@ static inline void Gia_ManTerSimulateRound( Gia_ManTer_t * p )
 int Gia_ManTerRetire2( Gia_ManTer_t * p, unsigned * pState )
 {
     int i, Entry, iMaxTerValue = -1;
+    Gia_ManTerCountUpdate( p );
     // find non-retired register with this value
     for ( i = 0; i < Gia_ManRegNum(p->pAig); i++ )
         if ( Gia_ManTerSimInfoGet( pState, i ) != GIA_UND && !p->pRetired[i] && iMaxTerValue < p->pCountX[i] )
@@ -432,7 +578,7 @@ int Gia_ManTerRetire2( Gia_ManTer_t * p, unsigned * pState )
         }
     // update all the retired registers
     Vec_IntForEachEntry( p->vRetired, Entry, i )
-        Gia_ManTerSimInfoSet( p->pDataSimCis, Gia_ManPiNum(p->pAig)+Entry, GIA_UND );
+        Gia_ManTerRetireReg( p, Entry );
     return Vec_IntSize(p->vRetired);
 }
 
@@ -458,7 +604,7 @@ int Gia_ManTerRetire( Gia_ManTer_t * p, unsigned * pThis, unsigned * pPrev )
             Vec_IntPush( p->vRetired, i );
     // set all of them to zero
     Vec_IntForEachEntry( p->vRetired, Entry, i )
-        Gia_ManTerSimInfoSet( p->pDataSimCis, Gia_ManPiNum(p->pAig)+Entry, GIA_UND );
+        Gia_ManTerRetireReg( p, Entry );
     return Vec_IntSize(p->vRetired);
 }
 
@@ -668,28 +814,17 @@ int * Gia_ManTerCreateMap( Gia_ManTer_t * p, int fVerbose )
 Gia_ManTer_t * Gia_ManTerSimulate( Gia_Man_t * pAig, int fVerbose )
 {
     Gia_ManTer_t * p;
-    unsigned * pState, * pPrev, * pLoop;
-    int i, Counter;
-    abctime clk, clkTotal = Abc_Clock();
+    unsigned * pState, * pPrev;
+    int i, iLoop, Counter;
+    abctime clkTotal = Abc_Clock();
     assert( Gia_ManRegNum(pAig) > 0 );
     // create manager
-    clk = Abc_Clock();
     p = Gia_ManTerCreate( pAig );
-    if ( 0 )
-    {
-        printf( "Obj = %8d (%8d). F = %6d. ", 
-            pAig->nObjs, Gia_ManCiNum(pAig) + Gia_ManAndNum(pAig), p->pAig->nFront );
-        printf( "AIG = %7.2f MB. F-mem = %7.2f MB. Other = %7.2f MB.  ", 
-            12.0*Gia_ManObjNum(p->pAig)/(1<<20), 
-            4.0*Abc_BitWordNum(2 * p->pAig->nFront)/(1<<20), 
-            4.0*Abc_BitWordNum(2 * (Gia_ManCiNum(pAig) + Gia_ManCoNum(pAig)))/(1<<20) );
-        ABC_PRT( "Time", Abc_Clock() - clk );
-    }
     // perform simulation
     Gia_ManTerSimInfoInit( p );
     // hash the first state
     pState = Gia_ManTerStateCreate( p );
-    Gia_ManTerStateInsert( pState, p->nStateWords, p->pBins, p->nBins );
+    Gia_ManTerStateInsert( p, 0 );
 //Gia_ManTerStatePrint( pState, Gia_ManRegNum(pAig), 0 );
     // perform simuluation till convergence
     pPrev = NULL;
@@ -699,13 +834,13 @@ Gia_ManTer_t * Gia_ManTerSimulate( Gia_Man_t * pAig, int fVerbose )
         Gia_ManTerSimInfoTransfer( p );
         pState = Gia_ManTerStateCreate( p );
 //Gia_ManTerStatePrint( pState, Gia_ManRegNum(pAig), i+1 );
-        if ( (pLoop = Gia_ManTerStateLookup(pState, p->nStateWords, p->pBins, p->nBins)) )
+        if ( (iLoop = Gia_ManTerStateLookup(p, Vec_PtrSize(p->vStates)-1)) >= 0 )
         {
             pAig->nTerStates = Vec_PtrSize( p->vStates );
-            pAig->nTerLoop = Vec_PtrFind( p->vStates, pLoop );
+            pAig->nTerLoop = iLoop;
             break;
         }
-        Gia_ManTerStateInsert( pState, p->nStateWords, p->pBins, p->nBins );
+        Gia_ManTerStateInsert( p, Vec_PtrSize(p->vStates)-1 );
         if ( i >= p->nIters && i % 10 == 0 )
         {
             Counter = Gia_ManTerRetire( p, pState, pPrev );
@@ -715,9 +850,13 @@ Gia_ManTer_t * Gia_ManTerSimulate( Gia_Man_t * pAig, int fVerbose )
         }
         pPrev = pState;
     }
+    Gia_ManTerCountUpdate( p );
     if ( fVerbose )
     {
         printf( "Ternary simulation saturated after %d iterations. ", i+1 );
+        printf( "Evals = %.2f %%.  Changes = %.2f %%.  ", 
+            100.0 * (double)p->nEvals / Abc_MaxDouble(1, (double)(i+1) * Gia_ManAndNum(pAig)), 
+            100.0 * (double)p->nChanges / ((double)(i+1) * Gia_ManRegNum(pAig)) );
         ABC_PRT( "Time", Abc_Clock() - clkTotal );
     }
     return p;
@@ -647,6 +647,51 @@ Vec_Int_t * Gia_ManReverseLevel( Gia_Man_t * p )
     return vLevelRev;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Orders the internal nodes by level.]
+
+  Description [Returns the IDs of the internal nodes sorted by level and 
+  by ID within each level. The first node of each level is stored in 
+  the array returned through pvStarts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_ManLevelOrder( Gia_Man_t * pGia, Vec_Int_t ** pvStarts )
+{
+    Vec_Int_t * vLevels = Vec_IntStart( Gia_ManObjNum(pGia) );
+    Vec_Int_t * vOrder, * vStarts;
+    Gia_Obj_t * pObj;
+    int i, Level, LevelMax = 0, * pPlace;
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        Level = Abc_MaxInt( Vec_IntEntry(vLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(vLevels, Gia_ObjFaninId1(pObj, i)) );
+        if ( Gia_ObjIsMuxId(pGia, i) )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevels, Gia_ObjFaninId2(pGia, i)) );
+        Vec_IntWriteEntry( vLevels, i, Level + 1 );
+        LevelMax = Abc_MaxInt( LevelMax, Level + 1 );
+    }
+    // count the nodes on each level and find where each level starts
+    vStarts = Vec_IntStart( LevelMax + 2 );
+    Gia_ManForEachAnd( pGia, pObj, i )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevels, i) + 1, 1 );
+    for ( Level = 1; Level < Vec_IntSize(vStarts); Level++ )
+        Vec_IntAddToEntry( vStarts, Level, Vec_IntEntry(vStarts, Level-1) );
+    // place the nodes in the order of levels
+    vOrder = Vec_IntStart( Gia_ManAndNum(pGia) );
+    pPlace = ABC_ALLOC( int, Vec_IntSize(vStarts) );
+    memcpy( pPlace, Vec_IntArray(vStarts), sizeof(int) * Vec_IntSize(vStarts) );
+    Gia_ManForEachAnd( pGia, pObj, i )
+        Vec_IntWriteEntry( vOrder, pPlace[Vec_IntEntry(vLevels, i)]++, i );
+    ABC_FREE( pPlace );
+    Vec_IntFree( vLevels );
+    *pvStarts = vStarts;
+    return vOrder;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Compute required levels.]
@@ -282,6 +282,7 @@ static int Abc_CommandTimeScale              ( Abc_Frame_t * pAbc, int argc, cha
 //static int Abc_CommandFpgaFast               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandIf                     ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandIfif                   ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandIfCache                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 
 static int Abc_CommandDsdSave                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandDsdLoad                ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -407,6 +408,10 @@ static int Abc_CommandAbc9RexWalk            ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9Show               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SetRegNum          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Strash             ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9HashCmp            ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9ObjBench           ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9SimBench           ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9IfBench            ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Topand             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Add1Hot            ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Cof                ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -421,6 +426,7 @@ static int Abc_CommandAbc9WriteSim           ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9PrintSim           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9GenSim             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SimRsb             ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9SimResim           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Resim              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SpecI              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Equiv              ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -516,6 +522,7 @@ static int Abc_CommandAbc9MultiProve         ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9SplitProve         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Bmc                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SBmc               ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Pfolio             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9ChainBmc           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9BCore              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9ICheck             ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -1003,6 +1010,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
 //    Cmd_CommandAdd( pAbc, "FPGA mapping", "ffpga",         Abc_CommandFpgaFast,         1 );
     Cmd_CommandAdd( pAbc, "FPGA mapping", "if",            Abc_CommandIf,               1 );
     Cmd_CommandAdd( pAbc, "FPGA mapping", "ifif",          Abc_CommandIfif,             1 );
+    Cmd_CommandAdd( pAbc, "FPGA mapping", "ifcache",       Abc_CommandIfCache,          0 );
 
     Cmd_CommandAdd( pAbc, "DSD manager",  "dsd_save",      Abc_CommandDsdSave,          0 );
     Cmd_CommandAdd( pAbc, "DSD manager",  "dsd_load",      Abc_CommandDsdLoad,          0 );
@@ -1129,6 +1137,10 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&show",         Abc_CommandAbc9Show,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&setregnum",    Abc_CommandAbc9SetRegNum,    0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&st",           Abc_CommandAbc9Strash,       0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&hashcmp",      Abc_CommandAbc9HashCmp,      0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&objbench",     Abc_CommandAbc9ObjBench,     0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&simbench",     Abc_CommandAbc9SimBench,     0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&ifbench",      Abc_CommandAbc9IfBench,      0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&topand",       Abc_CommandAbc9Topand,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&add1hot",      Abc_CommandAbc9Add1Hot,      0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&cof",          Abc_CommandAbc9Cof,          0 );
@@ -1143,6 +1155,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_print",    Abc_CommandAbc9PrintSim,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_gen",      Abc_CommandAbc9GenSim,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&simrsb",       Abc_CommandAbc9SimRsb,       0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&sim_resim",    Abc_CommandAbc9SimResim,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&resim",        Abc_CommandAbc9Resim,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&speci",        Abc_CommandAbc9SpecI,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&equiv",        Abc_CommandAbc9Equiv,        0 );
@@ -1238,6 +1251,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&splitprove",   Abc_CommandAbc9SplitProve,   0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bmc",          Abc_CommandAbc9Bmc,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bmcs",         Abc_CommandAbc9SBmc,         0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&pfolio",       Abc_CommandAbc9Pfolio,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&chainbmc",     Abc_CommandAbc9ChainBmc,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bcore",        Abc_CommandAbc9BCore,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&icheck",       Abc_CommandAbc9ICheck,       0 );
@@ -1298,10 +1312,6 @@ void Abc_Init( Abc_Frame_t * pAbc )
 //        Mf_ManTruthCount();
     }
 
-    {
-        extern void Dar_LibStart();
-        Dar_LibStart();
-    }
     {
 //        extern void Dau_DsdTest();
 //        Dau_DsdTest();
@@ -6834,6 +6844,8 @@ usage:
 int Abc_CommandTestNpn( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int fBinary, int fVerbose );
+    extern int Abc_TtCanonKernelSet( int iKer );
+    extern char * Abc_TtCanonKernelName();
     char * pFileName;
     int c;
     int fVerbose = 0;
@@ -6841,8 +6853,9 @@ int Abc_CommandTestNpn( Abc_Frame_t * pAbc, int argc, char ** argv )
     int nVarNum = -1;
     int fDumpRes = 0;
     int fBinary = 0;
+    int iKernel = -1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "ANdbvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "ANSdbvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -6868,6 +6881,17 @@ int Abc_CommandTestNpn( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nVarNum < 0 )
                 goto usage;
             break;
+        case 'S':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-S\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            iKernel = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( iKernel < 0 )
+                goto usage;
+            break;
         case 'd':
             fDumpRes ^= 1;
             break;
@@ -6896,11 +6920,20 @@ int Abc_CommandTestNpn( Abc_Frame_t * pAbc, int argc, char ** argv )
     // get the output file name
     pFileName = argv[globalUtilOptind];
     // call the testbench
-    Abc_NpnTest( pFileName, NpnType, nVarNum, fDumpRes, fBinary, fVerbose );
+    if ( iKernel >= 0 )
+    {
+        int iKernelOld = Abc_TtCanonKernelSet( iKernel );
+        if ( fVerbose )
+            Abc_Print( 1, "Using %s kernels for canonicization.\n", Abc_TtCanonKernelName() );
+        Abc_NpnTest( pFileName, NpnType, nVarNum, fDumpRes, fBinary, fVerbose );
+        Abc_TtCanonKernelSet( iKernelOld );
+    }
+    else
+        Abc_NpnTest( pFileName, NpnType, nVarNum, fDumpRes, fBinary, fVerbose );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: testnpn [-AN <num>] [-dbvh] <file>\n" );
+    Abc_Print( -2, "usage: testnpn [-ANS <num>] [-dbvh] <file>\n" );
     Abc_Print( -2, "\t           testbench for computing (semi-)canonical forms\n" );
     Abc_Print( -2, "\t           of completely-specified Boolean functions up to 16 varibles\n" );
     Abc_Print( -2, "\t-A <num> : semi-caninical form computation algorithm [default = %d]\n", NpnType );
@@ -6916,7 +6949,9 @@ usage:
     Abc_Print( -2, "\t               9: adjustable algorithm (heuristic) by XueGong Zhou at Fudan University, Shanghai\n" );
     Abc_Print( -2, "\t              10: adjustable algorithm (exact)     by XueGong Zhou at Fudan University, Shanghai\n" );
     Abc_Print( -2, "\t              11: new cost-aware exact algorithm   by XueGong Zhou at Fudan University, Shanghai\n" );
+    Abc_Print( -2, "\t              12: new fast hybrid semi-canonical form (batched)\n" );
     Abc_Print( -2, "\t-N <num> : the number of support variables (binary files only) [default = unused]\n" );
+    Abc_Print( -2, "\t-S <num> : kernels used by algorithms 5 and 12 (0 = scalar, 1 = AVX2) [default = best available]\n" );
     Abc_Print( -2, "\t-d       : toggle dumping resulting functions into a file [default = %s]\n", fDumpRes? "yes": "no" );
     Abc_Print( -2, "\t-b       : toggle dumping in binary format [default = %s]\n", fBinary? "yes": "no" );
     Abc_Print( -2, "\t-v       : toggle verbose printout [default = %s]\n", fVerbose? "yes": "no" );
@@ -19375,6 +19410,75 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandIfCache( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    If_DecCache_t * pCache;
+    int c, nLimitMb = 0, fClean = 0, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Mcvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            nLimitMb = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nLimitMb <= 0 )
+                goto usage;
+            break;
+        case 'c':
+            fClean ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+    {
+        Abc_Print( -1, "The file name of the decomposition cache should be given on the command line.\n" );
+        goto usage;
+    }
+    pCache = If_DecCacheStart( argv[globalUtilOptind], fVerbose );
+    if ( nLimitMb )
+        If_DecCacheSetLimit( pCache, nLimitMb );
+    if ( fClean )
+        If_DecCacheClean( pCache );
+    If_DecCachePrintStats( pCache );
+    If_DecCacheStop( pCache );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: ifcache [-M num] [-cvh] <file>\n" );
+    Abc_Print( -2, "\t         prints and updates the persistent decomposition cache\n" );
+    Abc_Print( -2, "\t         used by \"&if -S <str> -Z <file>\" and \"dsd_match -S <str> -Z <file>\"\n" );
+    Abc_Print( -2, "\t-M num : sets the size bound of the cache in megabytes [default = unchanged]\n" );
+    Abc_Print( -2, "\t-c     : toggles removing all entries from the cache [default = %s]\n", fClean? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggles verbose output [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    Abc_Print( -2, "\t<file> : the cache file\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -19687,10 +19791,11 @@ usage:
 int Abc_CommandDsdMatch( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     char * pStruct = NULL;
+    char * pFileCache = NULL;
     int c, fVerbose = 0, fFast = 0, fAdd = 0, fSpec = 0, LutSize = 0, nConfls = 10000, nProcs = 1;
     If_DsdMan_t * pDsdMan = (If_DsdMan_t *)Abc_FrameReadManDsd();
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCPSfasvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCPSZfasvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -19732,6 +19837,15 @@ int Abc_CommandDsdMatch( Abc_Frame_t * pAbc, int argc, char ** argv )
             pStruct = argv[globalUtilOptind];
             globalUtilOptind++;
             break;
+        case 'Z':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Z\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileCache = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'f':
             fFast ^= 1;
             break;
@@ -19763,14 +19877,14 @@ int Abc_CommandDsdMatch( Abc_Frame_t * pAbc, int argc, char ** argv )
             Abc_Print( -1, "DSD manager matched with cell %s should be cleaned by \"dsd_filter -m\" before matching with cell %s.\n", pStructCur, pStruct );
             return 0;
         }
-        Id_DsdManTuneStr( pDsdMan, pStruct, nConfls, nProcs, fVerbose );
+        Id_DsdManTuneStr( pDsdMan, pStruct, nConfls, nProcs, pFileCache, fVerbose );
     }
     else
         If_DsdManTune( pDsdMan, LutSize, fFast, fAdd, fSpec, fVerbose );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: dsd_match [-KCP num] [-fasvh] [-S str]\n" );
+    Abc_Print( -2, "usage: dsd_match [-KCP num] [-fasvh] [-S str] [-Z file]\n" );
     Abc_Print( -2, "\t         matches DSD structures with the given cell\n" );
     Abc_Print( -2, "\t-K num : LUT size used for tuning [default = %d]\n",        LutSize );
     Abc_Print( -2, "\t-C num : the maximum number of conflicts [default = %d]\n", nConfls );
@@ -19780,6 +19894,7 @@ usage:
     Abc_Print( -2, "\t-s     : toggles using specialized check [default = %s]\n", fSpec? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggles verbose output [default = %s]\n",          fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-S str : string representing programmable cell [default = %s]\n", pStruct ? pStruct : "not used" );
+    Abc_Print( -2, "\t-Z file: persistent cache of matching results used with -S [default = %s]\n", pFileCache ? pFileCache : "not used" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
@@ -26640,7 +26755,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRKNLWaxdursgvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -26776,6 +26891,28 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nLearnedPerce < 0 )
                 goto usage;
             break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nFramesAhead = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nFramesAhead < 0 )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -26886,7 +27023,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQRKN num] [-LW file] [-axdursgvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -26900,6 +27037,8 @@ usage:
     Abc_Print( -2, "\t-P num : the max number of learned clauses to keep (0=unused) [default = %d]\n", pPars->nLearnedStart );
     Abc_Print( -2, "\t-Q num : delta value for learned clause removal [default = %d]\n",          pPars->nLearnedDelta );
     Abc_Print( -2, "\t-R num : percentage to keep for learned clause removal [default = %d]\n",   pPars->nLearnedPerce );
+    Abc_Print( -2, "\t-K num : the number of threads solving the outputs (1 = sequential) [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t-N num : the number of frames unrolled ahead of the solvers with \"-K\" [default = %d]\n", pPars->nFramesAhead );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                               pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-W file: the log file name with per-output details [default = %s]\n",       pPars->pLogFileName ? pPars->pLogFileName : "no logging" );
     Abc_Print( -2, "\t-a     : solve all outputs (do not stop when one is SAT) [default = %s]\n", pPars->fSolveAll? "yes": "no" );
@@ -28601,7 +28740,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Pdr_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSLIaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSPNLIaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -28704,6 +28843,28 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nRandomSeed < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nGenProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nGenProcs <= 0 )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -28829,7 +28990,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: pdr [-MFCDQTHGS <num>] [-LI <file>] [-axrmuyfqipdegjonctkvwzh]\n" );
+    Abc_Print( -2, "usage: pdr [-MFCDQTHGSPN <num>] [-LI <file>] [-axrmuyfqipdegjonctkvwzh]\n" );
     Abc_Print( -2, "\t         model checking using property directed reachability (aka IC3)\n" );
     Abc_Print( -2, "\t         pioneered by Aaron R. Bradley (http://theory.stanford.edu/~arbrad/)\n" );
     Abc_Print( -2, "\t         with improvements by Niklas Een (http://een.se/niklas/)\n" );
@@ -28842,6 +29003,8 @@ usage:
     Abc_Print( -2, "\t-H num : runtime limit per output, in miliseconds (with \"-a\") [default = %d]\n",     pPars->nTimeOutOne );
     Abc_Print( -2, "\t-G num : runtime gap since the last CEX (0 = no limit) [default = %d]\n",              pPars->nTimeOutGap );
     Abc_Print( -2, "\t-S num : * value to seed the SAT solver with [default = %d]\n",                          pPars->nRandomSeed );
+    Abc_Print( -2, "\t-P num : the number of workers solving one output each (no more outputs than workers, no \"-d\") [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t-N num : the number of threads for cube generalization [default = %d]\n",         pPars->nGenProcs );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                                          pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-I file: the invariant file name [default = %s]\n",                                    pPars->pInvFileName ? pPars->pInvFileName : "default name" );
     Abc_Print( -2, "\t-a     : toggle solving all outputs even if one of them is SAT [default = %s]\n",      pPars->fSolveAll? "yes": "no" );
@@ -29960,11 +30123,24 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fVerbose = 0;
     int fGiaSimple = 0;
     int fSkipStrash = 0;
+    int fLazy = 0;
+    int nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "csmnlvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pcsmnlxvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 1 )
+                goto usage;
+            break;
         case 'c':
             fGiaSimple ^= 1;
             break;
@@ -29980,6 +30156,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'l':
             fMiniLut ^= 1;
             break;
+        case 'x':
+            fLazy ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -30020,19 +30199,25 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
 //    else if ( Extra_FileIsType( FileName, ".v", NULL, NULL ) )
 //        Abc3_ReadShowHie( FileName, fSkipStrash );
     else
-        pAig = Gia_AigerRead( FileName, fGiaSimple, fSkipStrash, 0 );
+    {
+        int nThreadsOld = Gia_AigerSetThreads( nProcs );
+        pAig = Gia_AigerReadLazy( FileName, fGiaSimple, fSkipStrash, 0, fLazy );
+        Gia_AigerSetThreads( nThreadsOld );
+    }
     if ( pAig )
         Abc_FrameUpdateGia( pAbc, pAig );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-csmnlvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-P num] [-csmnlxvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
+    Abc_Print( -2, "\t-P num : the number of threads used to decode the AND nodes [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggles reading MiniAIG rather than AIGER file [default = %s]\n", fMiniAig? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggles reading MiniAIG as a set of supergates [default = %s]\n", fMiniAig2? "yes": "no" );
     Abc_Print( -2, "\t-l     : toggles reading MiniLUT rather than AIGER file [default = %s]\n", fMiniLut? "yes": "no" );
+    Abc_Print( -2, "\t-x     : toggles deferring the symbol table until it is used [default = %s]\n", fLazy? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggles additional verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : the file name\n");
@@ -30678,7 +30863,7 @@ int Abc_CommandAbc9Save( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 0;
     // save the design as best
     Gia_ManStopP( &pAbc->pGiaBest );
-    pAbc->pGiaBest = Gia_ManDupWithAttributes( pAbc->pGia );
+    pAbc->pGiaBest = Gia_ManDupSnapshot( pAbc->pGia );
     return 0;
 
 usage:
@@ -30731,7 +30916,7 @@ int Abc_CommandAbc9Save2( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 0;
     // save the design as best
     Gia_ManStopP( &pAbc->pGiaBest2 );
-    pAbc->pGiaBest2 = Gia_ManDupWithAttributes( pAbc->pGia );
+    pAbc->pGiaBest2 = Gia_ManDupSnapshot( pAbc->pGia );
     return 0;
 
 usage:
@@ -30779,7 +30964,7 @@ int Abc_CommandAbc9SaveAig( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 0;
     // save the design as best
     Gia_ManStopP( &pAbc->pGiaSaved );
-    pAbc->pGiaSaved = Gia_ManDupWithAttributes( pAbc->pGia );
+    pAbc->pGiaSaved = Gia_ManDupSnapshot( pAbc->pGia );
     return 0;
 
 usage:
@@ -30822,7 +31007,7 @@ int Abc_CommandAbc9Load( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     Gia_ManStopP( &pAbc->pGia );
-    pAbc->pGia = Gia_ManDupWithAttributes( pAbc->pGiaBest );
+    pAbc->pGia = Gia_ManDupSnapshot( pAbc->pGiaBest );
     return 0;
 
 usage:
@@ -30912,7 +31097,7 @@ int Abc_CommandAbc9LoadAig( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     Gia_ManStopP( &pAbc->pGia );
-    pAbc->pGia = Gia_ManDupWithAttributes( pAbc->pGiaSaved );
+    pAbc->pGia = Gia_ManDupSnapshot( pAbc->pGiaSaved );
     return 0;
 
 usage:
@@ -31025,11 +31210,35 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fMiniLut = 0;
     int fWriteNewLine = 0;
     int fVerbose = 0;
+    int nChunk = 0;
+    int nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "upmlnvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CPupmlnvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nChunk = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nChunk < 0 )
+                goto usage;
+            break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs < 1 )
+                goto usage;
+            break;
         case 'u':
             fUnique ^= 1;
             break;
@@ -31080,12 +31289,20 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     else if ( fMiniLut )
         Gia_ManWriteMiniLut( pAbc->pGia, pFileName );
     else
+    {
+        int nChunkOld   = Gia_AigerSetChunk( nChunk );
+        int nThreadsOld = Gia_AigerSetThreads( nProcs );
         Gia_AigerWrite( pAbc->pGia, pFileName, 0, 0, fWriteNewLine );
+        Gia_AigerSetChunk( nChunkOld );
+        Gia_AigerSetThreads( nThreadsOld );
+    }
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &w [-upmlnvh] <file>\n" );
+    Abc_Print( -2, "usage: &w [-CP num] [-upmlnvh] <file>\n" );
     Abc_Print( -2, "\t         writes the current AIG into the AIGER file\n" );
+    Abc_Print( -2, "\t-C num : the number of AND nodes in one chunk of the index (0 = no index) [default = %d]\n", nChunk );
+    Abc_Print( -2, "\t-P num : the number of threads used to encode the AND nodes [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-u     : toggle writing canonical AIG structure [default = %s]\n", fUnique? "yes" : "no" );
     Abc_Print( -2, "\t-p     : toggle writing Verilog with 'and' and 'not' [default = %s]\n", fVerilog? "yes" : "no" );
     Abc_Print( -2, "\t-m     : toggle writing MiniAIG rather than AIGER [default = %s]\n", fMiniAig? "yes" : "no" );
@@ -32003,14 +32220,16 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern Gia_Man_t * Gia_ManDupMuxRestructure( Gia_Man_t * p );
     Gia_Man_t * pTemp;
-    int c, Limit = 2;
+    int c, Limit = 2, nProcs = 1;
     int fAddStrash = 0;
     int fCollapse = 0;
     int fAddMuxes = 0;
     int fStrMuxes = 0;
     int fRehashMap = 0;
+    int fHashOpen = 0;
+    int fHashOpenOld;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Lacmrsh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "LPacmrsoh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -32025,6 +32244,17 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( Limit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 'a':
             fAddStrash ^= 1;
             break;
@@ -32040,6 +32270,9 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 's':
             fStrMuxes ^= 1;
             break;
+        case 'o':
+            fHashOpen ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
@@ -32051,6 +32284,7 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Strash(): There is no AIG.\n" );
         return 1;
     }
+    fHashOpenOld = Gia_ManHashSetOpen( fHashOpen );
     if ( fStrMuxes )
     {
         if ( Gia_ManHasMapping(pAbc->pGia) )
@@ -32074,6 +32308,7 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( pAbc->pGia->pMuxes )
         {
             Abc_Print( -1, "Abc_CommandAbc9Strash(): The AIG already has MUXes.\n" );
+            Gia_ManHashSetOpen( fHashOpenOld );
             return 1;
         }
         pTemp = Gia_ManDupMuxes( pAbc->pGia, Limit );
@@ -32102,12 +32337,15 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
         if ( !Abc_FrameReadFlag("silentmode") )
             printf( "Generated AIG from AND/XOR/MUX graph.\n" );
     }
+    else if ( nProcs > 1 && !fAddStrash )
+        pTemp = Gia_ManConcRehash( pAbc->pGia, nProcs, 0 );
     else
     {
         pTemp = Gia_ManRehash( pAbc->pGia, fAddStrash );
 //        if ( !Abc_FrameReadFlag("silentmode") )
 //            printf( "Rehashed the current AIG.\n" );
     }
+    Gia_ManHashSetOpen( fHashOpenOld );
     if ( !(fCollapse && pAbc->pGia->pAigExtra) )
     {
         Gia_ManTransferTiming( pTemp, pAbc->pGia );
@@ -32118,15 +32356,323 @@ int Abc_CommandAbc9Strash( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &st [-L num] [-acmrsh]\n" );
+    Abc_Print( -2, "usage: &st [-LP num] [-acmrsoh]\n" );
     Abc_Print( -2, "\t         performs structural hashing\n" );
     Abc_Print( -2, "\t-a     : toggle additional hashing [default = %s]\n", fAddStrash? "yes": "no" );
     Abc_Print( -2, "\t-c     : toggle collapsing hierarchical AIG [default = %s]\n", fCollapse? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle converting to larger gates [default = %s]\n", fAddMuxes? "yes": "no" );
     Abc_Print( -2, "\t-L num : create MUX when sum of refs does not exceed this limit [default = %d]\n", Limit );
     Abc_Print( -2, "\t         (use L = 1 to create AIG with XORs but without MUXes)\n" );
+    Abc_Print( -2, "\t-P num : the number of threads for concurrent hashing [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-r     : toggle rehashing AIG while preserving mapping [default = %s]\n", fRehashMap? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle using MUX restructuring [default = %s]\n", fStrMuxes? "yes": "no" );
+    Abc_Print( -2, "\t-o     : toggle using open-addressing hash table [default = %s]\n", fHashOpen? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9HashCmp( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, nIters = 1, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Nvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nIters = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nIters <= 0 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9HashCmp(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( pAbc->pGia->pMuxes || Gia_ManHasMapping(pAbc->pGia) )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9HashCmp(): The AIG has MUXes or mapping.\n" );
+        return 1;
+    }
+    Gia_ManHashCompare( pAbc->pGia, nIters, fVerbose );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &hashcmp [-N num] [-vh]\n" );
+    Abc_Print( -2, "\t         compares runtime of chained and open-addressing hash tables\n" );
+    Abc_Print( -2, "\t         when running &st, normalization with hashing, and &st -m with &st\n" );
+    Abc_Print( -2, "\t-N num : the number of iterations to run [default = %d]\n", nIters );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9ObjBench( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, nLutSize = 6, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Kvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nLutSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nLutSize < 2 || nLutSize > 6 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9ObjBench(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( pAbc->pGia->pMuxes || Gia_ManBufNum(pAbc->pGia) || Gia_ManCoNum(pAbc->pGia) == 0 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9ObjBench(): The AIG has MUXes, buffers, or no outputs.\n" );
+        return 1;
+    }
+    Gia_ManBenchCore( pAbc->pGia, nLutSize, fVerbose );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &objbench [-K num] [-vh]\n" );
+    Abc_Print( -2, "\t         reports memory and runtime of AIGER I/O, &st, &dc2, &if, and &cec\n" );
+    Abc_Print( -2, "\t         in the object indexing mode of this binary (compact or wide)\n" );
+    Abc_Print( -2, "\t-K num : the LUT size used by &if [default = %d]\n", nLutSize );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9SimBench( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, nWords = 16, nRounds = 10, iKernel = -1, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WNKvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nWords = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nWords <= 0 )
+                goto usage;
+            break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nRounds = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nRounds <= 0 )
+                goto usage;
+            break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            iKernel = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( iKernel < -1 || iKernel > 3 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9SimBench(): There is no AIG.\n" );
+        return 1;
+    }
+    Gia_ManSimKernelBench( pAbc->pGia, nWords, nRounds, iKernel, fVerbose );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &simbench [-WNK num] [-vh]\n" );
+    Abc_Print( -2, "\t         reports simulated node-patterns per second for each simulation kernel\n" );
+    Abc_Print( -2, "\t         (scalar, SSE4.2, AVX2, AVX-512) supported by the CPU\n" );
+    Abc_Print( -2, "\t-W num : the number of 64-bit words of patterns [default = %d]\n", nWords );
+    Abc_Print( -2, "\t-N num : the number of simulation rounds [default = %d]\n", nRounds );
+    Abc_Print( -2, "\t-K num : benchmarks only one kernel (0 = scalar, 1 = SSE4.2, 2 = AVX2, 3 = AVX-512)\n" );
+    Abc_Print( -2, "\t         or all kernels supported by the CPU (-1) [default = %d]\n", iKernel );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9IfBench( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    extern void Gia_ManIfCutBench( Gia_Man_t * p, int nLutSize, int nCutsMax, int nRounds, int iKernel, int fVerbose );
+    int c, nLutSize = 6, nCutsMax = 8, nRounds = 3, iKernel = -1, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCNSvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nLutSize = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nLutSize < 2 || nLutSize > IF_MAX_LUTSIZE )
+                goto usage;
+            break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCutsMax = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCutsMax <= 0 || nCutsMax >= (1<<12) )
+                goto usage;
+            break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nRounds = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nRounds <= 0 )
+                goto usage;
+            break;
+        case 'S':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-S\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            iKernel = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( iKernel < -1 || iKernel > 1 )
+                goto usage;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9IfBench(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( Gia_ManHasMapping(pAbc->pGia) || Gia_ManBufNum(pAbc->pGia) || pAbc->pGia->pManTime )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9IfBench(): The AIG has mapping, buffers, or timing information.\n" );
+        return 1;
+    }
+    Gia_ManIfCutBench( pAbc->pGia, nLutSize, nCutsMax, nRounds, iKernel, fVerbose );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &ifbench [-KCNS num] [-vh]\n" );
+    Abc_Print( -2, "\t         reports merged cuts per second of &if for each cut kernel\n" );
+    Abc_Print( -2, "\t         (scalar, AVX2) supported by the CPU\n" );
+    Abc_Print( -2, "\t-K num : the number of LUT inputs [default = %d]\n", nLutSize );
+    Abc_Print( -2, "\t-C num : the max number of priority cuts [default = %d]\n", nCutsMax );
+    Abc_Print( -2, "\t-N num : the number of mapping runs [default = %d]\n", nRounds );
+    Abc_Print( -2, "\t-S num : benchmarks only one kernel (0 = scalar, 1 = AVX2)\n" );
+    Abc_Print( -2, "\t         or all kernels supported by the CPU (-1) [default = %d]\n", iKernel );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
@@ -32487,7 +33033,7 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Gia_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTImvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTPImvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -32535,6 +33081,17 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads <= 0 )
+                goto usage;
+            break;
         case 'I':
             if ( globalUtilOptind >= argc )
             {
@@ -32563,9 +33120,14 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Sim(): There is no AIG.\n" );
         return 1;
     }
-    if ( Gia_ManRegNum(pAbc->pGia) == 0 )
+    if ( Gia_ManRegNum(pAbc->pGia) == 0 && pFileName == NULL )
     {
-        Abc_Print( -1, "The network is combinational.\n" );
+        pAbc->nFrames = -1;
+        if ( Gia_ManSimSimulateComb( pAbc->pGia, pPars ) )
+            pAbc->Status =  0;
+        else
+            pAbc->Status = -1;
+        Abc_FrameReplaceCex( pAbc, &pAbc->pGia->pCexSeq );
         return 0;
     }
     if ( pFileName != NULL )
@@ -32591,13 +33153,14 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim [-FWNT num] [-mvh] -I <file>\n" );
+    Abc_Print( -2, "usage: &sim [-FWNTP num] [-mvh] -I <file>\n" );
     Abc_Print( -2, "\t         performs random simulation of the sequential miter\n" );
     Abc_Print( -2, "\t         (if candidate equivalences are defined, performs refinement)\n" );
-    Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nIters );
+    Abc_Print( -2, "\t-F num : the number of frames (rounds for combinational AIGs) to simulate [default = %d]\n", pPars->nIters );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-N num : random number seed (1 <= num <= 1000) [default = %d]\n", pPars->RandSeed );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads (each simulating its own batch of words) [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -33295,9 +33858,9 @@ usage:
 int Abc_CommandAbc9SimRsb( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern void Gia_ManSimRsb( Gia_Man_t * p, int nCands, int fVerbose );
-    int c, nCands = 32, fVerbose = 0;
+    int c, nCands = 32, nThreads = 1, nThreadsOld, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Nvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NPvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -33312,6 +33875,17 @@ int Abc_CommandAbc9SimRsb( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nCands < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -33336,13 +33910,93 @@ int Abc_CommandAbc9SimRsb( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9SimRsb(): Does not have simulation information available.\n" );
         return 0;
     }
+    nThreadsOld = Gia_ManSimSetThreads( nThreads );
     Gia_ManSimRsb( pAbc->pGia, nCands, fVerbose );
+    Gia_ManSimSetThreads( nThreadsOld );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &simrsb [-N num] [-vh]\n" );
+    Abc_Print( -2, "usage: &simrsb [-NP num] [-vh]\n" );
     Abc_Print( -2, "\t         performs resubstitution\n" );
     Abc_Print( -2, "\t-C num : the number of candidates to try [default = %d]\n", nCands );
+    Abc_Print( -2, "\t-P num : the number of threads used to simulate the patterns [default = %d]\n", nThreads );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9SimResim( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, nWords = 4, nPats = 10000, fEvent = 1, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WNevh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nWords = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nWords <= 0 )
+                goto usage;
+            break;
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nPats = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nPats < 0 )
+                goto usage;
+            break;
+        case 'e':
+            fEvent ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9SimResim(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( pAbc->pGia->pMuxes )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9SimResim(): This command works only for AIGs without XORs/MUXes.\n" );
+        return 1;
+    }
+    Gia_ManBuiltInSimBench( pAbc->pGia, nWords, nPats, fEvent, fVerbose );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &sim_resim [-WN num] [-evh]\n" );
+    Abc_Print( -2, "\t         benchmarks resimulation of the built-in simulator used by SAT sweeping\n" );
+    Abc_Print( -2, "\t-W num : the initial number of 64-bit words of simulation info [default = %d]\n", nWords );
+    Abc_Print( -2, "\t-N num : the number of patterns to add [default = %d]\n", nPats );
+    Abc_Print( -2, "\t-e     : toggle using event-driven resimulation [default = %s]\n", fEvent? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
@@ -34697,6 +35351,7 @@ int Abc_CommandAbc9Balance( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Gia_Man_t * pTemp = NULL;
     int nNewNodesMax = ABC_INFINITY;
+    int nThreads     = 1;
     int fDelayOnly   = 0;
     int fSimpleAnd   = 0;
     int fStrict      = 0;
@@ -34704,7 +35359,7 @@ int Abc_CommandAbc9Balance( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, fVerbose  = 0;
     int fVeryVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Ndaslvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NPdaslvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -34719,6 +35374,17 @@ int Abc_CommandAbc9Balance( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nNewNodesMax < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
         case 'd':
             fDelayOnly ^= 1;
             break;
@@ -34749,16 +35415,17 @@ int Abc_CommandAbc9Balance( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
     if ( fDelayOnly )
-        pTemp = Gia_ManBalance( pAbc->pGia, fSimpleAnd, fStrict, fVerbose );
+        pTemp = Gia_ManBalancePar( pAbc->pGia, fSimpleAnd, fStrict, nThreads, fVerbose );
     else
-        pTemp = Gia_ManAreaBalance( pAbc->pGia, fSimpleAnd, nNewNodesMax, fVerbose, fVeryVerbose );
+        pTemp = Gia_ManAreaBalancePar( pAbc->pGia, fSimpleAnd, nNewNodesMax, nThreads, fVerbose, fVeryVerbose );
     Abc_FrameUpdateGia( pAbc, pTemp );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &b [-N num] [-dasvwh]\n" );
+    Abc_Print( -2, "usage: &b [-NP num] [-dasvwh]\n" );
     Abc_Print( -2, "\t         performs AIG balancing to reduce delay and area\n" );
     Abc_Print( -2, "\t-N num : the max fanout count to skip a divisor [default = %d]\n", nNewNodesMax );
+    Abc_Print( -2, "\t-P num : the number of threads used to collect supergates [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-d     : toggle delay only balancing [default = %s]\n", fDelayOnly? "yes": "no" );
     Abc_Print( -2, "\t-a     : toggle using AND instead of AND/XOR/MUX [default = %s]\n", fSimpleAnd? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle strict control of area in delay-mode (\"&b -d\") [default = %s]\n", fStrict? "yes": "no" );
@@ -36276,7 +36943,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     Cec_ManFraSetDefaultParams( pPars );
     pPars->fSatSweeping = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WRILDCrmdckngwvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WRILDCPrmdckngewvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36346,6 +37013,17 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nBTLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcNum < 0 )
+                goto usage;
+            break;
         case 'r':
             pPars->fRewriting ^= 1;
             break;
@@ -36367,6 +37045,9 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'g':
             fUseAlgoG ^= 1;
             break;
+        case 'e':
+            pPars->fEventSim ^= 1;
+            break;
         case 'w':
             pPars->fVeryVerbose ^= 1;
             break;
@@ -36392,7 +37073,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &fraig [-WRILDC <num>] [-rmdckngwvh]\n" );
+    Abc_Print( -2, "usage: &fraig [-WRILDCP <num>] [-rmdckngewvh]\n" );
     Abc_Print( -2, "\t         performs combinational SAT sweeping\n" );
     Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-R num : the number of simulation rounds [default = %d]\n", pPars->nRounds );
@@ -36400,6 +37081,7 @@ usage:
     Abc_Print( -2, "\t-L num : the max number of levels of nodes to consider [default = %d]\n", pPars->nLevelMax );
     Abc_Print( -2, "\t-D num : the max number of steps of speculative reduction [default = %d]\n", pPars->nDepthMax );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
+    Abc_Print( -2, "\t-P num : the number of threads solving the SAT calls of \"-g\" (0 = sequential) [default = %d]\n", pPars->nProcNum );
     Abc_Print( -2, "\t-r     : toggle the use of AIG rewriting [default = %s]\n", pPars->fRewriting? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-d     : toggle using double output miters [default = %s]\n", pPars->fDualOut? "yes": "no" );
@@ -36407,6 +37089,7 @@ usage:
     Abc_Print( -2, "\t-k     : toggle using logic cones in the SAT solver [default = %s]\n", pPars->fUseCones? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggle using new implementation [default = %s]\n", fUseAlgo? "yes": "no" );
     Abc_Print( -2, "\t-g     : toggle using another new implementation [default = %s]\n", fUseAlgoG? "yes": "no" );
+    Abc_Print( -2, "\t-e     : toggle event-driven resimulation in \"-g\" (no new random patterns while sweeping) [default = %s]\n", pPars->fEventSim? "yes": "no" );
     Abc_Print( -2, "\t-w     : toggle printing even more verbose information [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -36972,7 +37655,7 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, nArgcNew, fMiter = 0, fDualOutput = 0, fDumpMiter = 0;
     Cec_ManCecSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CTnmdasvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CTPnmdasvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36998,6 +37681,17 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads <= 0 )
+                goto usage;
+            break;
         case 'n':
             pPars->fNaive ^= 1;
             break;
@@ -37171,10 +37865,11 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &cec [-CT num] [-nmdasvh]\n" );
+    Abc_Print( -2, "usage: &cec [-CTP num] [-nmdasvh]\n" );
     Abc_Print( -2, "\t         new combinational equivalence checker\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads for random pre-simulation (1 = none) [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-n     : toggle using naive SAT-based checking [default = %s]\n", pPars->fNaive? "yes":"no");
     Abc_Print( -2, "\t-m     : toggle miter vs. two circuits [default = %s]\n", fMiter? "miter":"two circuits");
     Abc_Print( -2, "\t-d     : toggle using dual output miter [default = %s]\n", fDualOutput? "yes":"no");
@@ -38040,7 +38735,7 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     pPars->pLutLib = (If_LibLut_t *)pAbc->pLibLut;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSTXYqalepmrsdbgxyofuijkztncvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSTXYPZqalepmrsdbgxyofuijkztncvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -38145,6 +38840,17 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nAndDelay < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nThreads < 1 )
+                goto usage;
+            break;
         case 'D':
             if ( globalUtilOptind >= argc )
             {
@@ -38192,6 +38898,15 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
                 goto usage;
             }
             break;
+        case 'Z':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Z\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPars->pDecCache = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'q':
             pPars->fPreprocess ^= 1;
             break;
@@ -38344,6 +39059,11 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Only one additional check can be performed at the same time.\n" );
         return 1;
     }
+    if ( pPars->pDecCache && pPars->pLutStruct == NULL )
+    {
+        Abc_Print( -1, "The decomposition cache (-Z) can only be used with the LUT structure (-S).\n" );
+        return 1;
+    }
     if ( pPars->fEnableCheck07 )
     {
         if ( pPars->nLutSize < 6 || pPars->nLutSize > 7 )
@@ -38560,7 +39280,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: &if [-KCFAGRTXY num] [-DEW float] [-S str] [-qarlepmsdbgxyofuijkztnchvw]\n" );
+    Abc_Print( -2, "usage: &if [-KCFAGRTXYP num] [-DEW float] [-S str] [-Z file] [-qarlepmsdbgxyofuijkztnchvw]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -38571,10 +39291,12 @@ usage:
     Abc_Print( -2, "\t-T num   : the type of LUT structures [default = any]\n", pPars->nStructType );
     Abc_Print( -2, "\t-X num   : delay of AND-gate in LUT library units [default = %d]\n", pPars->nAndDelay );
     Abc_Print( -2, "\t-Y num   : area of AND-gate in LUT library units [default = %d]\n", pPars->nAndArea );
+    Abc_Print( -2, "\t-P num   : the number of threads used for delay-oriented rounds [default = %d]\n", pPars->nThreads );
     Abc_Print( -2, "\t-D float : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-E float : sets epsilon used for tie-breaking [default = %f]\n", pPars->Epsilon );
     Abc_Print( -2, "\t-W float : sets wire delay between adjects LUTs [default = %f]\n", pPars->WireDelay );
     Abc_Print( -2, "\t-S str   : string representing the LUT structure [default = %s]\n", pPars->pLutStruct ? pPars->pLutStruct : "not used" );
+    Abc_Print( -2, "\t-Z file  : persistent cache of LUT structure checks used with -S [default = %s]\n", pPars->pDecCache ? pPars->pDecCache : "not used" );
     Abc_Print( -2, "\t-q       : toggles preprocessing using several starting points [default = %s]\n", pPars->fPreprocess? "yes": "no" );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fArea? "yes": "no" );
     Abc_Print( -2, "\t-r       : enables expansion/reduction of the best cuts [default = %s]\n", pPars->fExpRed? "yes": "no" );
@@ -39279,7 +40001,7 @@ int Abc_CommandAbc9Lf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Lf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWMekmupstgvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWMPekmupstgvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -39402,6 +40124,20 @@ int Abc_CommandAbc9Lf( Abc_Frame_t * pAbc, int argc, char ** argv )
                 goto usage;
             }
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcNum < 0 || pPars->nProcNum > pPars->nProcNumMax )
+            {
+                Abc_Print( -1, "The number of threads (%d) is not supported.\n", pPars->nProcNum );
+                goto usage;
+            }
+            break;
         case 'a':
             pPars->fAreaOnly ^= 1;
             break;
@@ -39480,7 +40216,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &lf [-KCFARLEDM num] [-kmupstgvwh]\n" );
+    Abc_Print( -2, "usage: &lf [-KCFARLEDMP num] [-kmupstgvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n", pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n", pPars->nCutNumMax, pPars->nCutNum );
@@ -39491,6 +40227,7 @@ usage:
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n", pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-M num   : LUT size when cofactoring is performed (0 <= num <= 100) [default = %d]\n", pPars->nLutSizeMux );
+    Abc_Print( -2, "\t-P num   : the number of threads for delay and area-flow rounds (0 <= P <= %d) [default = %d]\n", pPars->nProcNumMax, pPars->nProcNum );
 //    Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-e       : toggles edge vs node minimization [default = %s]\n", pPars->fOptEdge? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n", pPars->fCoarsen? "yes": "no" );
@@ -39524,7 +40261,7 @@ int Abc_CommandAbc9Mf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Mf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWaekmcgvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDWPaekmcgvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -39633,6 +40370,20 @@ int Abc_CommandAbc9Mf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nVerbLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcNum < 0 || pPars->nProcNum > pPars->nProcNumMax )
+            {
+                Abc_Print( -1, "The number of threads (%d) is not supported.\n", pPars->nProcNum );
+                goto usage;
+            }
+            break;
         case 'a':
             pPars->fAreaOnly ^= 1;
             break;
@@ -39685,7 +40436,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &mf [-KCFARLED num] [-akmcgvwh]\n" );
+    Abc_Print( -2, "usage: &mf [-KCFARLEDP num] [-akmcgvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n", pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n", pPars->nCutNumMax, pPars->nCutNum );
@@ -39695,6 +40446,7 @@ usage:
     Abc_Print( -2, "\t-L num   : the fanout limit for coarsening XOR/MUX (num >= 2) [default = %d]\n", pPars->nCoarseLimit );
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n", pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n", Buffer );
+    Abc_Print( -2, "\t-P num   : the number of threads for cuts and area-flow rounds (0 <= P <= %d) [default = %d]\n", pPars->nProcNumMax, pPars->nProcNum );
     Abc_Print( -2, "\t-a       : toggles area-oriented mapping [default = %s]\n", pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-e       : toggles edge vs node minimization [default = %s]\n", pPars->fOptEdge? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n", pPars->fCoarsen? "yes": "no" );
@@ -39728,7 +40480,7 @@ int Abc_CommandAbc9Nf( Abc_Frame_t * pAbc, int argc, char ** argv )
     Gia_Man_t * pNew; int c;
     Nf_ManSetDefaultPars( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDQWakpqfvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFARLEDQWPakpqfvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -39848,6 +40600,20 @@ int Abc_CommandAbc9Nf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nVerbLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcNum = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcNum < 0 || pPars->nProcNum > pPars->nProcNumMax )
+            {
+                Abc_Print( -1, "The number of threads (%d) is not supported.\n", pPars->nProcNum );
+                goto usage;
+            }
+            break;
         case 'a':
             pPars->fAreaOnly ^= 1;
             break;
@@ -39901,7 +40667,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &nf [-KCFARLEDQ num] [-akpqfvwh]\n" );
+    Abc_Print( -2, "usage: &nf [-KCFARLEDQP num] [-akpqfvwh]\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : LUT size for the mapping (2 <= K <= %d) [default = %d]\n",                  pPars->nLutSizeMax, pPars->nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (1 <= C <= %d) [default = %d]\n",           pPars->nCutNumMax, pPars->nCutNum );
@@ -39912,6 +40678,7 @@ usage:
     Abc_Print( -2, "\t-E num   : the area/edge tradeoff parameter (0 <= num <= 100) [default = %d]\n",       pPars->nAreaTuner );
     Abc_Print( -2, "\t-D num   : sets the delay constraint for the mapping [default = %s]\n",                Buffer );
     Abc_Print( -2, "\t-Q num   : internal parameter impacting area of the mapping [default = %d]\n",         pPars->nReqTimeFlex );
+    Abc_Print( -2, "\t-P num   : the number of threads for cuts and area-flow rounds (0 <= P <= %d) [default = %d]\n", pPars->nProcNumMax, pPars->nProcNum );
     Abc_Print( -2, "\t-a       : toggles SAT-based area-oriented mapping (experimental) [default = %s]\n",   pPars->fAreaOnly? "yes": "no" );
     Abc_Print( -2, "\t-k       : toggles coarsening the subject graph [default = %s]\n",                     pPars->fCoarsen? "yes": "no" );
     Abc_Print( -2, "\t-p       : toggles pin permutation (more matches - better quality) [default = %s]\n",  pPars->fPinPerm? "yes": "no" );
@@ -43476,6 +44243,151 @@ usage:
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Pfolio( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Fra_Pfo_t Pars, * pPars = &Pars;
+    Aig_Man_t * pAig;
+    Abc_Cex_t * pCex = NULL;
+    int c;
+    Fra_PfoSetDefaultParams( pPars );
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "TPBIGpbigvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->TimeLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->TimeLimit < 0 )
+                goto usage;
+            break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->TimePdr = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->TimePdr < 0 )
+                goto usage;
+            break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->TimeBmc = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->TimeBmc < 0 )
+                goto usage;
+            break;
+        case 'I':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-I\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->TimeInt = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->TimeInt < 0 )
+                goto usage;
+            break;
+        case 'G':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-G\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->TimeGla = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->TimeGla < 0 )
+                goto usage;
+            break;
+        case 'p':
+            pPars->fUsePdr ^= 1;
+            break;
+        case 'b':
+            pPars->fUseBmc ^= 1;
+            break;
+        case 'i':
+            pPars->fUseInt ^= 1;
+            break;
+        case 'g':
+            pPars->fUseGla ^= 1;
+            break;
+        case 'v':
+            pPars->fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Pfolio(): There is no AIG.\n" );
+        return 0;
+    }
+    if ( Gia_ManRegNum(pAbc->pGia) == 0 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Pfolio(): The network is combinational.\n" );
+        return 0;
+    }
+    if ( !pPars->fUsePdr && !pPars->fUseBmc && !pPars->fUseInt && !pPars->fUseGla )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Pfolio(): No engines are selected.\n" );
+        return 0;
+    }
+    pAig = Gia_ManToAigSimple( pAbc->pGia );
+    pAbc->Status  = Fra_PfoPerform( pAig, pPars, &pCex );
+    pAbc->nFrames = pPars->iFrame;
+    Abc_FrameReplaceCex( pAbc, &pCex );
+    Aig_ManStop( pAig );
+    if ( pAbc->Status == 1 )
+        Abc_Print( 1, "Property proved by %s.\n", Fra_PfoEngineName(pPars->iEngine) );
+    else if ( pAbc->Status == 0 )
+        Abc_Print( 1, "Property disproved by %s in frame %d.\n", Fra_PfoEngineName(pPars->iEngine), pPars->iFrame );
+    else if ( pPars->iFrame >= 0 )
+        Abc_Print( 1, "Property undecided. No counter-example in frames 0-%d.\n", pPars->iFrame );
+    else
+        Abc_Print( 1, "Property undecided.\n" );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &pfolio [-TPBIG num] [-pbigvh]\n" );
+    Abc_Print( -2, "\t         runs several property checkers concurrently; the first answer stops the others\n" );
+    Abc_Print( -2, "\t-T num : the global timeout in seconds of wall-clock time (0 = no limit) [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the timeout of pdr in seconds (0 = global timeout) [default = %d]\n",           pPars->TimePdr );
+    Abc_Print( -2, "\t-B num : the timeout of bmc3 in seconds (0 = global timeout) [default = %d]\n",          pPars->TimeBmc );
+    Abc_Print( -2, "\t-I num : the timeout of int in seconds (0 = global timeout) [default = %d]\n",           pPars->TimeInt );
+    Abc_Print( -2, "\t-G num : the timeout of &gla in seconds (0 = global timeout) [default = %d]\n",          pPars->TimeGla );
+    Abc_Print( -2, "\t-p     : toggle running pdr [default = %s]\n",                       pPars->fUsePdr?  "yes": "no" );
+    Abc_Print( -2, "\t-b     : toggle running bmc3 [default = %s]\n",                      pPars->fUseBmc?  "yes": "no" );
+    Abc_Print( -2, "\t-i     : toggle running int (single-output designs only) [default = %s]\n",  pPars->fUseInt?  "yes": "no" );
+    Abc_Print( -2, "\t-g     : toggle running &gla (single-output designs only) [default = %s]\n", pPars->fUseGla?  "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n",         pPars->fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
 
 /**Function*************************************************************
 
@@ -2406,8 +2406,9 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
     Aig_Man_t * pMan;
     Vec_Int_t * vMap = NULL;
     int status, RetValue = -1;
-    abctime clk = Abc_Clock();
-    abctime nTimeOut = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    int fWall = pPars->nProcs > 1; // several threads are timed in wall-clock time
+    abctime clk = fWall ? Abc_ClockWall() : Abc_Clock();
+    abctime nTimeOut = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + clk: 0;
     if ( fOrDecomp && !pPars->fSolveAll )
         pMan = Abc_NtkToDarBmc( pNtk, &vMap );
     else
@@ -2436,7 +2437,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
             if ( pPars->nFailOuts == 0 )
             {
                 Abc_Print( 1, "No output asserted in %d frames. Resource limit reached ", Abc_MaxInt(pPars->iFrame+1,0) );
-                if ( nTimeOut && Abc_Clock() > nTimeOut )
+                if ( nTimeOut && (fWall ? Abc_ClockWall() : Abc_Clock()) > nTimeOut )
                     Abc_Print( 1, "(timeout %d sec). ", pPars->nTimeOut );
                 else
                     Abc_Print( 1, "(conf limit %d). ", pPars->nConfLimit );
@@ -2444,7 +2445,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
             else
             {
                 Abc_Print( 1, "The total of %d outputs asserted in %d frames. Resource limit reached ", pPars->nFailOuts, pPars->iFrame );
-                if ( Abc_Clock() > nTimeOut )
+                if ( (fWall ? Abc_ClockWall() : Abc_Clock()) > nTimeOut )
                     Abc_Print( 1, "(timeout %d sec). ", pPars->nTimeOut );
                 else
                     Abc_Print( 1, "(conf limit %d). ", pPars->nConfLimit );
@@ -2474,7 +2475,7 @@ int Abc_NtkDarBmc3( Abc_Ntk_t * pNtk, Saig_ParBmc_t * pPars, int fOrDecomp )
                 Abc_Print( 1, ".   " );
             }
         }
-        ABC_PRT( "Time", Abc_Clock() - clk );
+        ABC_PRT( "Time", (fWall ? Abc_ClockWall() : Abc_Clock()) - clk );
     }
     if ( RetValue == 0 && pPars->fSolveAll )
     {
@@ -3034,7 +3035,7 @@ int Abc_NtkDarSec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, Fra_Sec_t * pSecPar )
 int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
 {
     int RetValue = -1;
-    abctime clk = Abc_Clock();
+    abctime clk = Abc_Clock(), clkWall = Abc_ClockWall();
     Aig_Man_t * pMan;
     pMan = Abc_NtkToDar( pNtk, 0, 1 );
     if ( pMan == NULL )
@@ -3069,7 +3070,11 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
             else
                 assert( 0 );
         }
-        ABC_PRT( "Time", Abc_Clock() - clk );
+        // the CPU time of the main thread does not count the workers
+        if ( pPars->nProcs > 1 || pPars->nGenProcs > 1 )
+            ABC_PRT( "Wall time", Abc_ClockWall() - clkWall );
+        else
+            ABC_PRT( "Time", Abc_Clock() - clk );
 /*
         Abc_Print( 1, "Status: " );
         if ( pPars->pOutMap )
@@ -208,6 +208,8 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
         pAlgoName = "adjustable algorithm (exact)     ";
     else if ( NpnType == 11 )
         pAlgoName = "new cost-aware exact algorithm   ";
+    else if ( NpnType == 12 )
+        pAlgoName = "new hybrid fast (batch)";
 
     assert( p->nVars <= 16 );
     if ( pAlgoName )
@@ -288,6 +290,20 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
                 Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
         }
     }
+    else if ( NpnType == 12 )
+    {
+        char * pCanonPerms = ABC_ALLOC( char, p->nFuncs * p->nVars );
+        unsigned * pCanonPhases = ABC_ALLOC( unsigned, p->nFuncs );
+        Abc_TtCanonicizeBatch( p->pFuncs[0], p->nVars, p->nFuncs, pCanonPerms, pCanonPhases );
+        if ( fVerbose )
+            for ( i = 0; i < p->nFuncs; i++ )
+            {
+                printf( "%7d : ", i );
+                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerms + i * p->nVars, pCanonPhases[i], p->nVars), printf( "\n" );
+            }
+        ABC_FREE( pCanonPerms );
+        ABC_FREE( pCanonPhases );
+    }
     else if ( NpnType == 6 )
     {
         for ( i = 0; i < p->nFuncs; i++ )
@@ -419,7 +435,7 @@ int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int f
 {
     if ( fVerbose )
         printf( "Using truth tables from file \"%s\"...\n", pFileName );
-    if ( NpnType >= 0 && NpnType <= 11 )
+    if ( NpnType >= 0 && NpnType <= 12 )
         Abc_TruthNpnTest( pFileName, NpnType, nVarNum, fDumpRes, fBinary, fVerbose );
     else
         printf( "Unknown canonical form value (%d).\n", NpnType );
@@ -234,6 +234,8 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     }
     Vec_IntFreeP( &p->vIndFlops );
     Vec_PtrFreeP( &p->vLTLProperties_global );
+    Vec_PtrFreeP( &p->vInitNames );
+    Vec_WrdFreeP( &p->vInitTimes );
     if ( p->vSignalNames )
     Vec_PtrFreeFree( p->vSignalNames );
     Abc_FrameDeleteAllNetworks( p );
@@ -258,6 +260,54 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     s_GlobalFrame = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Records the runtime of one startup phase.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameAddInitTime( Abc_Frame_t * p, char * pName, abctime Time )
+{
+    if ( p->vInitNames == NULL )
+    {
+        p->vInitNames = Vec_PtrAlloc( 32 );
+        p->vInitTimes = Vec_WrdAlloc( 32 );
+    }
+    Vec_PtrPush( p->vInitNames, pName );
+    Vec_WrdPush( p->vInitTimes, (word)Time );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the runtimes of the startup phases.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FramePrintInitTimes( Abc_Frame_t * p )
+{
+    abctime TimeTotal = 0;
+    char * pName;
+    int i;
+    if ( p->vInitNames == NULL )
+        return;
+    Vec_PtrForEachEntry( char *, p->vInitNames, pName, i )
+    {
+        fprintf( p->Out, "%-12s : %9.3f ms\n", pName, 1000.0 * Vec_WrdEntry(p->vInitTimes, i) / CLOCKS_PER_SEC );
+        TimeTotal += (abctime)Vec_WrdEntry(p->vInitTimes, i);
+    }
+    fprintf( p->Out, "%-12s : %9.3f ms\n", "Total", 1000.0 * TimeTotal / CLOCKS_PER_SEC );
+}
+
 
 /**Function*************************************************************
 
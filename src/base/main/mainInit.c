@@ -88,6 +88,24 @@ void Abc_FrameAddInitializer( Abc_FrameInitializer_t* p )
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Starts one package and records its runtime.]
+
+  Description [The runtimes are printed by "abc -p".]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_FrameInitPackage( Abc_Frame_t * pAbc, Abc_Frame_Initialization_Func pInit, char * pName )
+{
+    abctime clk = Abc_ClockWall();
+    pInit( pAbc );
+    Abc_FrameAddInitTime( pAbc, pName, Abc_ClockWall() - clk );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Starts all the packages.]
@@ -102,27 +120,27 @@ void Abc_FrameAddInitializer( Abc_FrameInitializer_t* p )
 void Abc_FrameInit( Abc_Frame_t * pAbc )
 {
     Abc_FrameInitializer_t* p;
-    Cmd_Init( pAbc );
+    Abc_FrameInitPackage( pAbc, Cmd_Init, "Cmd" );
     Cmd_CommandExecute( pAbc, "set checkread" ); 
-    Io_Init( pAbc );
-    Abc_Init( pAbc );
-    If_Init( pAbc );
-    Map_Init( pAbc );
-    Mio_Init( pAbc );
-    Super_Init( pAbc );
-    Libs_Init( pAbc );
-    Load_Init( pAbc );
-    Scl_Init( pAbc );
-    Wlc_Init( pAbc );
-    Bac_Init( pAbc );
-    Cba_Init( pAbc );
-    Pla_Init( pAbc );
-    Sim_Init( pAbc );
-    Test_Init( pAbc );
-    Glucose_Init( pAbc );
+    Abc_FrameInitPackage( pAbc, Io_Init, "Io" );
+    Abc_FrameInitPackage( pAbc, Abc_Init, "Abc" );
+    Abc_FrameInitPackage( pAbc, If_Init, "If" );
+    Abc_FrameInitPackage( pAbc, Map_Init, "Map" );
+    Abc_FrameInitPackage( pAbc, Mio_Init, "Mio" );
+    Abc_FrameInitPackage( pAbc, Super_Init, "Super" );
+    Abc_FrameInitPackage( pAbc, Libs_Init, "Libs" );
+    Abc_FrameInitPackage( pAbc, Load_Init, "Load" );
+    Abc_FrameInitPackage( pAbc, Scl_Init, "Scl" );
+    Abc_FrameInitPackage( pAbc, Wlc_Init, "Wlc" );
+    Abc_FrameInitPackage( pAbc, Bac_Init, "Bac" );
+    Abc_FrameInitPackage( pAbc, Cba_Init, "Cba" );
+    Abc_FrameInitPackage( pAbc, Pla_Init, "Pla" );
+    Abc_FrameInitPackage( pAbc, Sim_Init, "Sim" );
+    Abc_FrameInitPackage( pAbc, Test_Init, "Test" );
+    Abc_FrameInitPackage( pAbc, Glucose_Init, "Glucose" );
     for( p = s_InitializerStart ; p ; p = p->next )
         if(p->init)
-            p->init(pAbc);
+            Abc_FrameInitPackage( pAbc, p->init, "Plugin" );
 }
 
 
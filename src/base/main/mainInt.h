@@ -162,6 +162,10 @@ struct Abc_Frame_t_
     void *          pNdr;
     int *           pNdrArray;
 
+    // startup profiling
+    Vec_Ptr_t *     vInitNames;    // the names of the startup phases
+    Vec_Wrd_t *     vInitTimes;    // the runtimes of the startup phases
+
     Abc_Frame_Callback_BmcFrameDone_Func pFuncOnFrameDone;
 };
 
@@ -201,6 +205,8 @@ extern ABC_DLL void            Abc_FrameAddInitializer( Abc_FrameInitializer_t*
 /*=== mvFrame.c =====================================================*/
 extern ABC_DLL Abc_Frame_t *   Abc_FrameAllocate();
 extern ABC_DLL void            Abc_FrameDeallocate( Abc_Frame_t * p );
+extern ABC_DLL void            Abc_FrameAddInitTime( Abc_Frame_t * p, char * pName, abctime Time );
+extern ABC_DLL void            Abc_FramePrintInitTimes( Abc_Frame_t * p );
 /*=== mvUtils.c =====================================================*/
 extern ABC_DLL char *          Abc_UtilsGetVersion( Abc_Frame_t * pAbc );
 extern ABC_DLL char *          Abc_UtilsGetUsersInput( Abc_Frame_t * pAbc );
@@ -91,7 +91,7 @@ int Abc_RealMain( int argc, char * argv[] )
     const char * sOutFile, * sInFile;
     char * sCommand;
     int  fStatus = 0;
-    int c, fInitSource, fInitRead, fFinalWrite;
+    int c, fInitSource, fInitRead, fFinalWrite, fInitTimes;
 
     enum {
         INTERACTIVE, // interactive mode
@@ -119,12 +119,13 @@ int Abc_RealMain( int argc, char * argv[] )
     fInitSource = 1;
     fInitRead   = 0;
     fFinalWrite = 0;
+    fInitTimes  = 0;
     sInFile = sOutFile = NULL;
     sprintf( sReadCmd,  "read"  );
     sprintf( sWriteCmd, "write" );
 
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "dm:l:c:q:C:Q:S:hf:F:o:st:T:xb")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "dm:l:c:q:C:Q:S:hf:F:o:spt:T:xb")) != EOF) {
         switch(c) {
 
             case 'd':                                          
@@ -231,6 +232,10 @@ int Abc_RealMain( int argc, char * argv[] )
                 fInitSource = 0;
                 break;
 
+            case 'p':
+                fInitTimes = 1;
+                break;
+
             case 't':
                 if ( TypeCheck( pAbc, globalUtilOptarg ) )
                 {
@@ -314,8 +319,12 @@ int Abc_RealMain( int argc, char * argv[] )
         // source the resource file
         if ( fInitSource )
         {
+            abctime clk = Abc_ClockWall();
             Abc_UtilsSource( pAbc );
+            Abc_FrameAddInitTime( pAbc, "abc.rc", Abc_ClockWall() - clk );
         }
+        if ( fInitTimes )
+            Abc_FramePrintInitTimes( pAbc );
 
         fStatus = 0;
         if ( fInitRead && sInFile )
@@ -355,8 +364,12 @@ int Abc_RealMain( int argc, char * argv[] )
         // source the resource file
         if ( fInitSource )
         {
+            abctime clk = Abc_ClockWall();
             Abc_UtilsSource( pAbc );
+            Abc_FrameAddInitTime( pAbc, "abc.rc", Abc_ClockWall() - clk );
         }
+        if ( fInitTimes )
+            Abc_FramePrintInitTimes( pAbc );
 
         // execute commands given by the user
         while ( !feof(stdin) )
@@ -81,6 +81,7 @@ typedef struct If_Set_t_     If_Set_t;
 typedef struct If_LibLut_t_  If_LibLut_t;
 typedef struct If_LibBox_t_  If_LibBox_t;
 typedef struct If_DsdMan_t_  If_DsdMan_t;
+typedef struct If_DecCache_t_ If_DecCache_t;
 typedef struct Ifn_Ntk_t_    Ifn_Ntk_t;
 
 typedef struct Ifif_Par_t_   Ifif_Par_t;
@@ -112,6 +113,7 @@ struct If_Par_t_
     int                nStructType;   // type of the structure
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
+    int                nThreads;      // the number of threads used in delay-oriented rounds
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -146,6 +148,7 @@ struct If_Par_t_
     int                fVerbose;      // the verbosity flag
     int                fVerboseTrace; // the verbosity flag
     char *             pLutStruct;    // LUT structure
+    char *             pDecCache;     // file name of the persistent decomposition cache
     float              WireDelay;     // wire delay
     // internal parameters
     int                fSkipCutFilter;// skip cut filter
@@ -220,6 +223,10 @@ struct If_Man_t_
     unsigned           uSharedMask;   // mask of shared variables
     int                nShared;       // the number of shared variables
     int                fReqTimeWarn;  // warning about exceeding required times was printed
+    // multi-threaded rounds
+    int                nThreads;      // the number of threads used in delay-oriented rounds
+    Vec_Int_t *        vLevOrder;     // internal nodes in the order of levels (and IDs within a level)
+    Vec_Int_t *        vLevStarts;    // the first node of each level in vLevOrder
     // SOP balancing
     Vec_Int_t *        vCover;        // used to compute ISOP
     Vec_Int_t *        vArray;        // intermediate storage
@@ -270,6 +277,8 @@ struct If_Man_t_
     int                nBestCutSmall[2];
     int                nCountNonDec[2];
     Vec_Int_t *        vCutData;      // cut data storage
+    If_DecCache_t *    pDecCache;     // persistent decomposition cache
+    word               DecCacheKind;  // the key of the structural check in the cache
     int                pArrTimeProfile[IF_MAX_FUNC_LUTSIZE];
     Vec_Ptr_t *        vVisited;
     void *             pUserMan;
@@ -297,7 +306,7 @@ struct If_Cut_t_
     float              Delay;         // delay of the cut
     int                iCutFunc;      // TT ID of the cut
     int                uMaskFunc;     // polarity bitmask
-    unsigned           uSign;         // cut signature
+    word               uSign;         // cut signature (one bit for each leaf ID modulo 64)
     unsigned           Cost    : 12;  // the user's cost of the cut (related to IF_COST_MAX)
     unsigned           fCompl  :  1;  // the complemented attribute 
     unsigned           fUser   :  1;  // using the user's area and delay
@@ -418,8 +427,8 @@ static inline void       If_CutCopy( If_Man_t * p, If_Cut_t * pDst, If_Cut_t * p
 static inline void       If_CutSetup( If_Man_t * p, If_Cut_t * pCut        ) { memset(pCut, 0, (size_t)p->nCutBytes); pCut->nLimit = p->pPars->nLutSize; }
 
 static inline If_Cut_t * If_ObjCutBest( If_Obj_t * pObj )                    { return &pObj->CutBest;                }
-static inline unsigned   If_ObjCutSign( unsigned ObjId )                     { return (1 << (ObjId % 31));           }
-static inline unsigned   If_ObjCutSignCompute( If_Cut_t * p )                { unsigned s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
+static inline word       If_ObjCutSign( unsigned ObjId )                     { return ((word)1 << (ObjId & 63));     }
+static inline word       If_ObjCutSignCompute( If_Cut_t * p )                { word s = 0; int i; for ( i = 0; i < If_CutLeaveNum(p); i++ ) s |= If_ObjCutSign(p->pLeaves[i]); return s; }
 
 static inline float      If_ObjArrTime( If_Obj_t * pObj )                    { return If_ObjCutBest(pObj)->Delay;    }
 static inline void       If_ObjSetArrTime( If_Obj_t * pObj, float ArrTime )  { If_ObjCutBest(pObj)->Delay = ArrTime; }
@@ -504,6 +513,15 @@ static inline float      If_CutLutDelay( If_LibLut_t * p, int Size, int iPin )
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== ifCache.c ==========================================================*/
+extern If_DecCache_t * If_DecCacheStart( char * pFileName, int fVerbose );
+extern void            If_DecCacheStop( If_DecCache_t * p );
+extern word            If_DecCacheKind( char * pKind );
+extern int             If_DecCacheLookup( If_DecCache_t * p, word Kind, word * pTruth, int nVars, word * pValue, int nValueWords );
+extern void            If_DecCacheInsert( If_DecCache_t * p, word Kind, word * pTruth, int nVars, word * pValue, int nValueWords );
+extern void            If_DecCacheSetLimit( If_DecCache_t * p, int nLimitMb );
+extern void            If_DecCacheClean( If_DecCache_t * p );
+extern void            If_DecCachePrintStats( If_DecCache_t * p );
 /*=== ifCore.c ===========================================================*/
 extern void            If_ManSetDefaultPars( If_Par_t * pPars );
 extern int             If_ManPerformMapping( If_Man_t * p );
@@ -516,6 +534,10 @@ extern void            If_CutSort( If_Man_t * p, If_Set_t * pCutSet, If_Cut_t *
 extern void            If_CutOrder( If_Cut_t * pCut );
 extern int             If_CutMergeOrdered( If_Man_t * p, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pCut );
 extern int             If_CutMerge( If_Man_t * p, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pCut );
+extern int             If_CutKernelBest();
+extern int             If_CutKernelCur();
+extern int             If_CutKernelSet( int iKer );
+extern char *          If_CutKernelName();
 extern int             If_CutCheck( If_Cut_t * pCut );
 extern void            If_CutPrint( If_Cut_t * pCut );
 extern void            If_CutPrintTiming( If_Man_t * p, If_Cut_t * pCut );
@@ -564,7 +586,7 @@ extern If_DsdMan_t *   If_DsdManAlloc( int nVars, int nLutSize );
 extern void            If_DsdManAllocIsops( If_DsdMan_t * p, int nLutSize );
 extern void            If_DsdManPrint( If_DsdMan_t * p, char * pFileName, int Number, int Support, int fOccurs, int fTtDump, int fVerbose );
 extern void            If_DsdManTune( If_DsdMan_t * p, int LutSize, int fFast, int fAdd, int fSpec, int fVerbose );
-extern void            Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int fVerbose );
+extern void            Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, char * pFileCache, int fVerbose );
 extern void            If_DsdManFree( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManSave( If_DsdMan_t * p, char * pFileName );
 extern If_DsdMan_t *   If_DsdManLoad( char * pFileName );
@@ -635,6 +657,7 @@ extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+extern int             If_ManPerformMappingParCheck( If_Man_t * p );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
@@ -676,6 +699,8 @@ extern float           If_ManScanMappingDirect( If_Man_t * p );
 extern float           If_ManScanMappingSeq( If_Man_t * p );
 extern void            If_ManResetOriginalRefs( If_Man_t * p );
 extern int             If_ManCrossCut( If_Man_t * p );
+extern Vec_Int_t *     If_ManLevelOrder( If_Man_t * p, Vec_Int_t ** pvStarts );
+extern int             If_ManCrossCutLevel( If_Man_t * p, Vec_Int_t * vOrder, Vec_Int_t * vStarts );
 
 extern Vec_Ptr_t *     If_ManReverseOrder( If_Man_t * p );
 extern void            If_ManMarkMapping( If_Man_t * p );
@@ -20,6 +20,15 @@
 
 #include "if.h"
 #include "misc/vec/vecHsh.h"
+#include <errno.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +36,58 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// The persistent decomposition cache is a file of 64-bit words:
+//   the header (IF_DEC_CACHE_HEADER words):
+//     magic, version, size bound in bytes, entry count, slot count, data size in words
+//   the hash table (slot count words):
+//     one plus the offset of the record in the data section, or zero
+//   the data section (data size words), records in the order of insertion:
+//     the key of the check (If_DecCacheKind)
+//     the variable count (bits 0-7) and the value size in words (bits 8-15)
+//     the truth table (Abc_TtWordNum(nVars) words)
+//     the value (nValueWords words)
+// The file is never modified in place. The processes map the snapshot read-only
+// and keep the new entries in memory. When the cache is stopped, the new entries
+// are merged with the current contents of the file under an exclusive lock on
+// "<file>.lock", the oldest entries are dropped to fit the size bound, and the
+// result is written into a temporary file, which atomically replaces the old one.
+// An existing file that does not load as a cache is never replaced; instead,
+// the cache is not used in this run.
+
+#define IF_DEC_CACHE_MAGIC    ABC_CONST(0x31454843414344A1)
+#define IF_DEC_CACHE_VERSION  1
+#define IF_DEC_CACHE_HEADER   8
+#define IF_DEC_CACHE_LIMIT    64   // the default size bound in MB
+
+struct If_DecCache_t_
+{
+    char *         pFileName;      // the cache file
+    word *         pFile;          // the snapshot of the file
+    size_t         nFileSize;      // the snapshot size in bytes
+    int            fMapped;        // the snapshot is memory-mapped
+    word *         pSlots;         // the hash table of the snapshot
+    word *         pData;          // the records of the snapshot
+    word           nSlots;         // the number of slots
+    word           nData;          // the number of data words
+    word           nEntries;       // the number of records in the snapshot
+    word           nLimit;         // the size bound in bytes
+    Vec_Wrd_t *    vData;          // the records added by this process
+    Vec_Int_t *    vOffs;          // the offsets of the new records
+    Vec_Int_t *    vNexts;         // the collision chains of the new records
+    Vec_Int_t *    vBins;          // the hash table of the new records
+    int            fLimit;         // the size bound was changed by the user
+    int            fClean;         // the old records should be removed
+    int            fDisabled;      // the file is not a valid cache and is not used
+    int            fVerbose;       // verbose output
+    int            nLookups;       // the number of lookups
+    int            nHits;          // the number of successful lookups
+};
+
+static inline int    If_DecCacheRecVars( word * pRec )   { return (int)(pRec[1] & 0xFF);                         }
+static inline int    If_DecCacheRecValues( word * pRec ) { return (int)((pRec[1] >> 8) & 0xFF);                  }
+static inline int    If_DecCacheRecSize( word * pRec )   { return 2 + Abc_TtWordNum(If_DecCacheRecVars(pRec)) + If_DecCacheRecValues(pRec); }
+static inline word * If_DecCacheRecValue( word * pRec )  { return pRec + 2 + Abc_TtWordNum(If_DecCacheRecVars(pRec)); }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -91,6 +152,580 @@ void If_ManCacheAnalize( If_Man_t * p )
     Vec_IntFree( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Hashing of the persistent decomposition cache.]
+
+  Description [The key of a check is derived from the string, which lists
+  everything the result of the check depends on, besides the function.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word If_DecCacheKind( char * pKind )
+{
+    word Hash = ABC_CONST(0xCBF29CE484222325);
+    for ( ; *pKind; pKind++ )
+        Hash = (Hash ^ (unsigned char)*pKind) * ABC_CONST(0x100000001B3);
+    return Hash ? Hash : 1;
+}
+static inline word If_DecCacheHash( word Kind, word * pTruth, int nWords )
+{
+    word Hash = Kind;
+    int i;
+    for ( i = 0; i < nWords; i++ )
+    {
+        Hash = (Hash ^ pTruth[i]) * ABC_CONST(0x9E3779B97F4A7C15);
+        Hash ^= Hash >> 31;
+    }
+    return Hash;
+}
+static inline int If_DecCacheRecEqual( word * pRec, word Kind, word * pTruth, int nVars, int nValueWords )
+{
+    return pRec[0] == Kind && If_DecCacheRecVars(pRec) == nVars && If_DecCacheRecValues(pRec) == nValueWords && 
+        !memcmp( pRec + 2, pTruth, sizeof(word) * Abc_TtWordNum(nVars) );
+}
+static inline word If_DecCacheSlotNum( word nEntries )
+{
+    word nSlots = 16;
+    while ( nSlots < 2 * nEntries )
+        nSlots <<= 1;
+    return nSlots;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the snapshot of the cache file.]
+
+  Description [The file is mapped read-only and shared with other processes
+  when possible, otherwise it is read into memory. A file with the wrong
+  format or version is ignored and will be rebuilt when the cache is stopped.
+  The records and the hash table are checked before use, so that a truncated
+  or corrupted file is dropped rather than read out of bounds.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_DecCacheUnload( If_DecCache_t * p )
+{
+    if ( p->pFile == NULL )
+        return;
+#ifndef _WIN32
+    if ( p->fMapped )
+        munmap( (void *)p->pFile, p->nFileSize );
+    else
+#endif
+        ABC_FREE( p->pFile );
+    p->pFile  = NULL;
+    p->pSlots = p->pData = NULL;
+    p->nFileSize = 0;
+    p->nSlots = p->nData = p->nEntries = 0;
+    p->fMapped = 0;
+}
+static int If_DecCacheCheck( word * pFile, size_t nFileSize )
+{
+    word * pSlots, * pData, * pRec, nSlots, nData, nWords = nFileSize / sizeof(word), nEntries = 0, nUsed = 0, k;
+    Vec_Bit_t * vStarts;
+    int RetValue = 0;
+    nSlots = pFile[4];
+    nData  = pFile[5];
+    if ( nFileSize % sizeof(word) || nSlots > nWords || nData > nWords || nWords != IF_DEC_CACHE_HEADER + nSlots + nData || nData >= 0x7FFFFFFF )
+        return 0;
+    // the hash table should have at least one empty slot
+    if ( nSlots == 0 || (nSlots & (nSlots - 1)) || pFile[3] >= nSlots )
+        return 0;
+    pSlots  = pFile + IF_DEC_CACHE_HEADER;
+    pData   = pSlots + nSlots;
+    vStarts = Vec_BitStart( (int)nData + 1 );
+    // each record should lie inside the data section
+    for ( k = 0; k < nData; k += If_DecCacheRecSize(pRec), nEntries++ )
+    {
+        pRec = pData + k;
+        if ( k + 2 > nData || If_DecCacheRecVars(pRec) > 16 || If_DecCacheRecValues(pRec) == 0 || (pRec[1] >> 16) )
+            break;
+        if ( k + If_DecCacheRecSize(pRec) > nData )
+            break;
+        Vec_BitWriteEntry( vStarts, (int)k, 1 );
+    }
+    if ( k != nData || nEntries != pFile[3] )
+        goto finish;
+    // each slot should point to the beginning of a record
+    for ( k = 0; k < nSlots; k++ )
+    {
+        if ( pSlots[k] == 0 )
+            continue;
+        if ( pSlots[k] > nData || !Vec_BitEntry(vStarts, (int)(pSlots[k] - 1)) )
+            goto finish;
+        nUsed++;
+    }
+    RetValue = (nUsed == nEntries);
+finish:
+    Vec_BitFree( vStarts );
+    return RetValue;
+}
+static int If_DecCacheLoad( If_DecCache_t * p )
+{
+    word * pFile = NULL;
+    size_t nFileSize = 0;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( p->pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return errno == ENOENT;
+    if ( fstat( fd, &Stat ) == 0 && Stat.st_size >= (off_t)(sizeof(word) * IF_DEC_CACHE_HEADER) )
+    {
+        nFileSize = (size_t)Stat.st_size;
+        pFile = (word *)mmap( NULL, nFileSize, PROT_READ, MAP_SHARED, fd, 0 );
+        if ( pFile == (word *)MAP_FAILED )
+            pFile = NULL;
+        else
+            p->fMapped = 1;
+    }
+    close( fd );
+#endif
+    if ( pFile == NULL )
+    {
+        FILE * pF = fopen( p->pFileName, "rb" );
+        if ( pF == NULL )
+            return errno == ENOENT;
+        fseek( pF, 0, SEEK_END );
+        nFileSize = (size_t)ftell( pF );
+        rewind( pF );
+        if ( nFileSize >= sizeof(word) * IF_DEC_CACHE_HEADER && nFileSize % sizeof(word) == 0 )
+        {
+            pFile = ABC_ALLOC( word, nFileSize / sizeof(word) );
+            if ( fread( pFile, nFileSize, 1, pF ) != 1 )
+                ABC_FREE( pFile );
+        }
+        fclose( pF );
+        if ( pFile == NULL )
+        {
+            printf( "The file \"%s\" is not a decomposition cache.\n", p->pFileName );
+            return 0;
+        }
+    }
+    p->pFile = pFile;
+    p->nFileSize = nFileSize;
+    // check the header
+    if ( pFile[0] != IF_DEC_CACHE_MAGIC )
+    {
+        printf( "The file \"%s\" is not a decomposition cache.\n", p->pFileName );
+        If_DecCacheUnload( p );
+        return 0;
+    }
+    if ( pFile[1] != IF_DEC_CACHE_VERSION )
+    {
+        printf( "The decomposition cache \"%s\" has version %d (expected %d).\n", p->pFileName, (int)pFile[1], IF_DEC_CACHE_VERSION );
+        If_DecCacheUnload( p );
+        return 0;
+    }
+    if ( !If_DecCacheCheck(pFile, nFileSize) )
+    {
+        printf( "The decomposition cache \"%s\" is corrupted.\n", p->pFileName );
+        If_DecCacheUnload( p );
+        return 0;
+    }
+    if ( !p->fLimit )
+        p->nLimit = pFile[2];
+    p->nEntries = pFile[3];
+    p->nSlots   = pFile[4];
+    p->nData    = pFile[5];
+    p->pSlots   = pFile + IF_DEC_CACHE_HEADER;
+    p->pData    = p->pSlots + p->nSlots;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the persistent decomposition cache.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+If_DecCache_t * If_DecCacheStart( char * pFileName, int fVerbose )
+{
+    If_DecCache_t * p = ABC_CALLOC( If_DecCache_t, 1 );
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    p->nLimit    = (word)IF_DEC_CACHE_LIMIT << 20;
+    p->fVerbose  = fVerbose;
+    p->vData     = Vec_WrdAlloc( 1000 );
+    p->vOffs     = Vec_IntAlloc( 100 );
+    p->vNexts    = Vec_IntAlloc( 100 );
+    p->vBins     = Vec_IntStart( 1 << 10 );
+    if ( !If_DecCacheLoad( p ) )
+    {
+        printf( "The file \"%s\" is left unchanged and the decomposition cache is not used.\n", pFileName );
+        p->fDisabled = 1;
+    }
+    else if ( fVerbose )
+        printf( "Loaded %d entries from the decomposition cache \"%s\".\n", (int)p->nEntries, pFileName );
+    return p;
+}
+void If_DecCacheSetLimit( If_DecCache_t * p, int nLimitMb )
+{
+    p->nLimit = (word)nLimitMb << 20;
+    p->fLimit = 1;
+}
+void If_DecCacheClean( If_DecCache_t * p )
+{
+    p->fClean = 1;
+    Vec_WrdClear( p->vData );
+    Vec_IntClear( p->vOffs );
+    Vec_IntClear( p->vNexts );
+    Vec_IntFill( p->vBins, Vec_IntSize(p->vBins), 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up the value of the check.]
+
+  Description [Returns 1 and copies the value if the entry is found.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word * If_DecCacheFindOld( If_DecCache_t * p, word Hash, word Kind, word * pTruth, int nVars, int nValueWords )
+{
+    word i, Mask = p->nSlots - 1;
+    if ( p->nSlots == 0 || p->fClean )
+        return NULL;
+    for ( i = Hash & Mask; p->pSlots[i]; i = (i + 1) & Mask )
+    {
+        word * pRec = p->pData + p->pSlots[i] - 1;
+        if ( p->pSlots[i] > p->nData )
+            return NULL;
+        if ( If_DecCacheRecEqual(pRec, Kind, pTruth, nVars, nValueWords) )
+            return pRec;
+    }
+    return NULL;
+}
+static word * If_DecCacheFindNew( If_DecCache_t * p, word Hash, word Kind, word * pTruth, int nVars, int nValueWords )
+{
+    int i = Vec_IntEntry( p->vBins, (int)(Hash & (Vec_IntSize(p->vBins) - 1)) );
+    for ( ; i; i = Vec_IntEntry(p->vNexts, i - 1) )
+    {
+        word * pRec = Vec_WrdEntryP( p->vData, Vec_IntEntry(p->vOffs, i - 1) );
+        if ( If_DecCacheRecEqual(pRec, Kind, pTruth, nVars, nValueWords) )
+            return pRec;
+    }
+    return NULL;
+}
+static inline word * If_DecCacheNormalize( word * pTruth, int nVars, word * pTemp )
+{
+    if ( nVars >= 6 )
+        return pTruth;
+    pTemp[0] = Abc_Tt6Stretch( pTruth[0], nVars );
+    return pTemp;
+}
+int If_DecCacheLookup( If_DecCache_t * p, word Kind, word * pTruth, int nVars, word * pValue, int nValueWords )
+{
+    word Temp, Hash, * pRec;
+    assert( nVars >= 0 && nVars <= 16 && nValueWords > 0 && nValueWords < 256 );
+    if ( p->fDisabled )
+        return 0;
+    pTruth = If_DecCacheNormalize( pTruth, nVars, &Temp );
+    Hash   = If_DecCacheHash( Kind, pTruth, Abc_TtWordNum(nVars) );
+    p->nLookups++;
+    pRec = If_DecCacheFindOld( p, Hash, Kind, pTruth, nVars, nValueWords );
+    if ( pRec == NULL )
+        pRec = If_DecCacheFindNew( p, Hash, Kind, pTruth, nVars, nValueWords );
+    if ( pRec == NULL )
+        return 0;
+    memcpy( pValue, If_DecCacheRecValue(pRec), sizeof(word) * nValueWords );
+    p->nHits++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the value of the check.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_DecCacheResize( If_DecCache_t * p )
+{
+    int i, Offset, nBins = 2 * Vec_IntSize(p->vBins);
+    Vec_IntFill( p->vBins, nBins, 0 );
+    Vec_IntForEachEntry( p->vOffs, Offset, i )
+    {
+        word * pRec = Vec_WrdEntryP( p->vData, Offset );
+        word Hash = If_DecCacheHash( pRec[0], pRec + 2, Abc_TtWordNum(If_DecCacheRecVars(pRec)) );
+        int * pBin = Vec_IntEntryP( p->vBins, (int)(Hash & (nBins - 1)) );
+        Vec_IntWriteEntry( p->vNexts, i, *pBin );
+        *pBin = i + 1;
+    }
+}
+void If_DecCacheInsert( If_DecCache_t * p, word Kind, word * pTruth, int nVars, word * pValue, int nValueWords )
+{
+    word Temp, Hash;
+    int i, * pBin;
+    assert( nVars >= 0 && nVars <= 16 && nValueWords > 0 && nValueWords < 256 );
+    if ( p->fDisabled )
+        return;
+    pTruth = If_DecCacheNormalize( pTruth, nVars, &Temp );
+    Hash   = If_DecCacheHash( Kind, pTruth, Abc_TtWordNum(nVars) );
+    if ( If_DecCacheFindOld(p, Hash, Kind, pTruth, nVars, nValueWords) || If_DecCacheFindNew(p, Hash, Kind, pTruth, nVars, nValueWords) )
+        return;
+    pBin = Vec_IntEntryP( p->vBins, (int)(Hash & (Vec_IntSize(p->vBins) - 1)) );
+    Vec_IntPush( p->vNexts, *pBin );
+    Vec_IntPush( p->vOffs, Vec_WrdSize(p->vData) );
+    *pBin = Vec_IntSize(p->vOffs);
+    Vec_WrdPush( p->vData, Kind );
+    Vec_WrdPush( p->vData, (word)nVars | ((word)nValueWords << 8) );
+    for ( i = 0; i < Abc_TtWordNum(nVars); i++ )
+        Vec_WrdPush( p->vData, pTruth[i] );
+    for ( i = 0; i < nValueWords; i++ )
+        Vec_WrdPush( p->vData, pValue[i] );
+    if ( Vec_IntSize(p->vOffs) > Vec_IntSize(p->vBins) )
+        If_DecCacheResize( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the records into the cache file.]
+
+  Description [The records are given in the order of insertion. The oldest 
+  records are dropped if the file does not fit into the size bound.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_DecCacheWrite( If_DecCache_t * p, Vec_Wrd_t * vRecs, Vec_Int_t * vOffs )
+{
+    char * pFileTemp;
+    FILE * pFile;
+    word pHeader[IF_DEC_CACHE_HEADER] = {0}, * pSlots, nSlots, nData;
+    int i, iFirst, RetValue;
+    // find the oldest record to keep
+    for ( iFirst = Vec_IntSize(vOffs); iFirst > 0; iFirst-- )
+    {
+        nSlots = If_DecCacheSlotNum( Vec_IntSize(vOffs) - iFirst + 1 );
+        nData  = Vec_WrdSize(vRecs) - Vec_IntEntry(vOffs, iFirst - 1);
+        if ( sizeof(word) * (IF_DEC_CACHE_HEADER + nSlots + nData) > p->nLimit )
+            break;
+    }
+    if ( p->fVerbose && iFirst > 0 )
+        printf( "Removed %d oldest entries to fit the size bound (%.2f MB).\n", iFirst, 1.0 * p->nLimit / (1 << 20) );
+    // create the hash table
+    nSlots = If_DecCacheSlotNum( Vec_IntSize(vOffs) - iFirst );
+    nData  = Vec_WrdSize(vRecs) - (iFirst < Vec_IntSize(vOffs) ? Vec_IntEntry(vOffs, iFirst) : Vec_WrdSize(vRecs));
+    pSlots = ABC_CALLOC( word, nSlots );
+    for ( i = iFirst; i < Vec_IntSize(vOffs); i++ )
+    {
+        word * pRec = Vec_WrdEntryP( vRecs, Vec_IntEntry(vOffs, i) );
+        word Hash = If_DecCacheHash( pRec[0], pRec + 2, Abc_TtWordNum(If_DecCacheRecVars(pRec)) );
+        word k, Mask = nSlots - 1;
+        for ( k = Hash & Mask; pSlots[k]; k = (k + 1) & Mask );
+        pSlots[k] = Vec_IntEntry(vOffs, i) - (Vec_WrdSize(vRecs) - nData) + 1;
+    }
+    pHeader[0] = IF_DEC_CACHE_MAGIC;
+    pHeader[1] = IF_DEC_CACHE_VERSION;
+    pHeader[2] = p->nLimit;
+    pHeader[3] = Vec_IntSize(vOffs) - iFirst;
+    pHeader[4] = nSlots;
+    pHeader[5] = nData;
+    // write the temporary file and replace the old one
+    pFileTemp = ABC_ALLOC( char, strlen(p->pFileName) + 30 );
+#ifndef _WIN32
+    sprintf( pFileTemp, "%s.tmp%d", p->pFileName, (int)getpid() );
+#else
+    sprintf( pFileTemp, "%s.tmp", p->pFileName );
+#endif
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        ABC_FREE( pSlots );
+        return 0;
+    }
+    RetValue  = fwrite( pHeader, sizeof(word) * IF_DEC_CACHE_HEADER, 1, pFile ) == 1;
+    RetValue &= fwrite( pSlots, sizeof(word) * nSlots, 1, pFile ) == 1;
+    if ( nData )
+        RetValue &= fwrite( Vec_WrdEntryP(vRecs, Vec_WrdSize(vRecs) - nData), sizeof(word) * nData, 1, pFile ) == 1;
+    RetValue &= fclose( pFile ) == 0;
+#ifdef _WIN32
+    if ( RetValue )
+        remove( p->pFileName );
+#endif
+    if ( RetValue )
+        RetValue = rename( pFileTemp, p->pFileName ) == 0;
+    if ( !RetValue )
+    {
+        printf( "Writing the decomposition cache \"%s\" has failed.\n", p->pFileName );
+        remove( pFileTemp );
+    }
+    ABC_FREE( pFileTemp );
+    ABC_FREE( pSlots );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the loaded records followed by the new ones.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_DecCacheMerge( If_DecCache_t * p )
+{
+    Vec_Wrd_t * vRecs;
+    Vec_Int_t * vOffs;
+    word k, Hash, * pRec;
+    int i, j, Offset, nAdded = 0;
+    if ( p->fClean )
+        If_DecCacheUnload( p );
+    // collect the old records followed by the new ones
+    vRecs = Vec_WrdAlloc( (int)p->nData + Vec_WrdSize(p->vData) );
+    vOffs = Vec_IntAlloc( (int)p->nEntries + Vec_IntSize(p->vOffs) );
+    for ( k = 0; k < p->nData; k += If_DecCacheRecSize(pRec) )
+    {
+        pRec = p->pData + k;
+        Vec_IntPush( vOffs, Vec_WrdSize(vRecs) );
+        for ( j = 0; j < If_DecCacheRecSize(pRec); j++ )
+            Vec_WrdPush( vRecs, pRec[j] );
+    }
+    Vec_IntForEachEntry( p->vOffs, Offset, i )
+    {
+        pRec = Vec_WrdEntryP( p->vData, Offset );
+        Hash = If_DecCacheHash( pRec[0], pRec + 2, Abc_TtWordNum(If_DecCacheRecVars(pRec)) );
+        if ( If_DecCacheFindOld(p, Hash, pRec[0], pRec + 2, If_DecCacheRecVars(pRec), If_DecCacheRecValues(pRec)) )
+            continue;
+        Vec_IntPush( vOffs, Vec_WrdSize(vRecs) );
+        for ( j = 0; j < If_DecCacheRecSize(pRec); j++ )
+            Vec_WrdPush( vRecs, pRec[j] );
+        nAdded++;
+    }
+    If_DecCacheUnload( p );
+    if ( If_DecCacheWrite(p, vRecs, vOffs) && p->fVerbose )
+        printf( "Added %d new entries to the decomposition cache \"%s\".\n", nAdded, p->pFileName );
+    Vec_WrdFree( vRecs );
+    Vec_IntFree( vOffs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges the new records into the cache file.]
+
+  Description [The file is reloaded under the lock, so that the records 
+  added by other processes since the cache was started are preserved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_DecCacheFlush( If_DecCache_t * p )
+{
+#ifndef _WIN32
+    char * pFileLock = ABC_ALLOC( char, strlen(p->pFileName) + 10 );
+    int fdLock;
+    sprintf( pFileLock, "%s.lock", p->pFileName );
+    fdLock = open( pFileLock, O_RDWR | O_CREAT, 0666 );
+    if ( fdLock != -1 && flock( fdLock, LOCK_EX ) != 0 )
+    {
+        close( fdLock );
+        fdLock = -1;
+    }
+    if ( fdLock == -1 )
+        printf( "Cannot lock file \"%s\". The cache is updated without locking.\n", pFileLock );
+    ABC_FREE( pFileLock );
+#endif
+    // reload the current contents of the file
+    If_DecCacheUnload( p );
+    if ( If_DecCacheLoad( p ) )
+        If_DecCacheMerge( p );
+    else
+        printf( "The file \"%s\" is left unchanged and the new entries are not saved.\n", p->pFileName );
+#ifndef _WIN32
+    if ( fdLock != -1 )
+    {
+        flock( fdLock, LOCK_UN );
+        close( fdLock );
+    }
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the persistent decomposition cache.]
+
+  Description [Saves the new records into the file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_DecCacheStop( If_DecCache_t * p )
+{
+    if ( p->fVerbose )
+        printf( "Decomposition cache: Lookups = %d.  Hits = %d. (%6.2f %%)  New entries = %d.\n", 
+            p->nLookups, p->nHits, 100.0 * p->nHits / Abc_MaxInt(1, p->nLookups), Vec_IntSize(p->vOffs) );
+    if ( !p->fDisabled && (Vec_IntSize(p->vOffs) > 0 || p->fLimit || p->fClean) )
+        If_DecCacheFlush( p );
+    If_DecCacheUnload( p );
+    Vec_WrdFree( p->vData );
+    Vec_IntFree( p->vOffs );
+    Vec_IntFree( p->vNexts );
+    Vec_IntFree( p->vBins );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the persistent decomposition cache.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_DecCachePrintStats( If_DecCache_t * p )
+{
+    int nVarCounts[17] = {0}, nKinds = 0, i;
+    Vec_Wrd_t * vKinds = Vec_WrdAlloc( 16 );
+    word k, * pRec;
+    for ( k = 0; k < p->nData; k += If_DecCacheRecSize(pRec) )
+    {
+        pRec = p->pData + k;
+        nVarCounts[If_DecCacheRecVars(pRec)]++;
+        if ( Vec_WrdFind(vKinds, pRec[0]) == -1 )
+            Vec_WrdPush( vKinds, pRec[0] );
+    }
+    nKinds = Vec_WrdSize( vKinds );
+    Vec_WrdFree( vKinds );
+    printf( "Decomposition cache \"%s\":  Version = %d.  Entries = %d.  Checks = %d.  Size = %.2f MB.  Bound = %.2f MB.\n", 
+        p->pFileName, IF_DEC_CACHE_VERSION, (int)p->nEntries, nKinds, 1.0 * p->nFileSize / (1 << 20), 1.0 * p->nLimit / (1 << 20) );
+    for ( i = 0; i <= 16; i++ )
+        if ( nVarCounts[i] )
+            printf( "%2d-var entries = %8d. (%6.2f %%)\n", i, nVarCounts[i], 100.0 * nVarCounts[i] / Abc_MaxInt(1, (int)p->nEntries) );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
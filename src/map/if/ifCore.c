@@ -63,6 +63,7 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->fCutMin     =  0;
     pPars->fBidec      =  0;
     pPars->fVerbose    =  0;
+    pPars->nThreads    =  1;
 }
 
 
@@ -83,7 +84,15 @@ int If_ManPerformMapping( If_Man_t * p )
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    if ( If_ManPerformMappingParCheck(p) )
+    {
+        // delay-oriented rounds will process the nodes level by level
+        p->nThreads  = p->pPars->nThreads;
+        p->vLevOrder = If_ManLevelOrder( p, &p->vLevStarts );
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutLevel(p, p->vLevOrder, p->vLevStarts)) );
+    }
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
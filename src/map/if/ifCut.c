@@ -20,6 +20,11 @@
 
 #include "if.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IF_CUT_DISPATCH
+#include <immintrin.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +32,11 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define IF_CUT_KER_NUM   2
+#define IF_CUT_SIMD_MAX  8   // the max number of leaves handled by the SIMD kernels
+
+static int s_IfCutKerCur = -1;  // the current kernel (0 = scalar, 1 = AVX2)
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -105,6 +115,147 @@ int If_CutVerifyCuts( If_Set_t * pCutSet, int fOrdered )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [SIMD kernels for merging and filtering cuts.]
+
+  Description [The leaves of a cut with at most 8 leaves are loaded into 
+  one 256-bit register padded with a value that cannot be a leaf. Each 
+  leaf of the other cut is broadcast and compared with all of them at 
+  once. When merging two ordered cuts, the position of each leaf in the 
+  result is found by counting the smaller leaves in both cuts, without 
+  the data-dependent branches of the scalar merge.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef IF_CUT_DISPATCH
+
+__attribute__((target("avx2"))) static inline __m256i If_CutLoadAvx2( int * pLeaves, int nLeaves, int Pad )
+{
+    __m256i vMask = _mm256_cmpgt_epi32( _mm256_set1_epi32(nLeaves), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) );
+    __m256i vData = _mm256_maskload_epi32( pLeaves, vMask );
+    return _mm256_blendv_epi8( _mm256_set1_epi32(Pad), vData, vMask );
+}
+__attribute__((target("avx2"))) static inline unsigned If_CutMatchAvx2( __m256i vLeaves, int Leaf )
+{
+    return (unsigned)_mm256_movemask_ps( _mm256_castsi256_ps(_mm256_cmpeq_epi32(vLeaves, _mm256_set1_epi32(Leaf))) );
+}
+__attribute__((target("avx2"))) static inline unsigned If_CutSmallerAvx2( __m256i vLeaves, int Leaf )
+{
+    return (unsigned)_mm256_movemask_ps( _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(Leaf), vLeaves)) );
+}
+__attribute__((target("avx2"))) static int If_CutCheckDominanceAvx2( If_Cut_t * pDom, If_Cut_t * pCut )
+{
+    __m256i vCut = If_CutLoadAvx2( pCut->pLeaves, pCut->nLeaves, -1 );
+    int i;
+    for ( i = 0; i < (int)pDom->nLeaves; i++ )
+        if ( !If_CutMatchAvx2(vCut, pDom->pLeaves[i]) )
+            return 0;
+    return 1;
+}
+__attribute__((target("avx2"))) static int If_CutMergeOrderedAvx2( If_Cut_t * pC0, If_Cut_t * pC1, If_Cut_t * pC )
+{
+    int nSizeC0 = pC0->nLeaves;
+    int nSizeC1 = pC1->nLeaves;
+    __m256i v0 = If_CutLoadAvx2( pC0->pLeaves, nSizeC0, 0x7FFFFFFF );
+    __m256i v1 = If_CutLoadAvx2( pC1->pLeaves, nSizeC1, 0x7FFFFFFF );
+    unsigned uShared = 0; // the leaves of pC1 that also belong to pC0
+    int i, k, nSize;
+    for ( i = 0; i < nSizeC0; i++ )
+        uShared |= If_CutMatchAvx2( v1, pC0->pLeaves[i] );
+    nSize = nSizeC0 + nSizeC1 - __builtin_popcount( uShared );
+    if ( nSize > (int)pC0->nLimit )
+        return 0;
+    // the leaf goes after the smaller leaves of its cut and the smaller unshared leaves of the other cut
+    for ( i = 0; i < nSizeC0; i++ )
+        pC->pLeaves[i + __builtin_popcount(If_CutSmallerAvx2(v1, pC0->pLeaves[i]) & ~uShared)] = pC0->pLeaves[i];
+    for ( k = 0; k < nSizeC1; k++ )
+        if ( !((uShared >> k) & 1) )
+            pC->pLeaves[k - __builtin_popcount(uShared & ((1 << k) - 1)) + __builtin_popcount(If_CutSmallerAvx2(v0, pC1->pLeaves[k]))] = pC1->pLeaves[k];
+    pC->nLeaves = nSize;
+    pC->uSign = pC0->uSign | pC1->uSign;
+    return 1;
+}
+__attribute__((target("avx2"))) static int If_CutMergeAvx2( If_Man_t * p, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pCut )
+{
+    int nLutSize = pCut0->nLimit;
+    int nSize0 = pCut0->nLeaves;
+    int nSize1 = pCut1->nLeaves;
+    __m256i v0 = If_CutLoadAvx2( pCut0->pLeaves, nSize0, -1 );
+    int * pC1 = pCut1->pLeaves;
+    int * pC = pCut->pLeaves;
+    unsigned uMatch;
+    int i, c = nSize0;
+    for ( i = 0; i < nSize1; i++ )
+    {
+        uMatch = If_CutMatchAvx2( v0, pC1[i] );
+        if ( uMatch )
+        {
+            p->pPerm[1][i] = __builtin_ctz( uMatch );
+            continue;
+        }
+        if ( c == nLutSize )
+            return 0;
+        p->pPerm[1][i] = c;
+        pC[c++] = pC1[i];
+    }
+    for ( i = 0; i < nSize0; i++ )
+        pC[i] = pCut0->pLeaves[i];
+    pCut->nLeaves = c;
+    pCut->uSign = pCut0->uSign | pCut1->uSign;
+    return 1;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels for merging and filtering cuts.]
+
+  Description [If_CutKernelSet() takes the kernel number (0 = scalar,
+  1 = AVX2) or -1 for the best one supported by the CPU, and returns the
+  previous number. The SIMD kernels are used for cuts with at most 8 
+  leaves and give the same cuts as the scalar ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_CutKernelBest()
+{
+#ifdef IF_CUT_DISPATCH
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx2") )
+        return 1;
+#endif
+    return 0;
+}
+int If_CutKernelCur()
+{
+    return s_IfCutKerCur;
+}
+int If_CutKernelSet( int iKer )
+{
+    int iKerOld = s_IfCutKerCur, iKerBest = If_CutKernelBest();
+    s_IfCutKerCur = (iKer < 0 || iKer > iKerBest) ? iKerBest : iKer;
+    return iKerOld;
+}
+char * If_CutKernelName()
+{
+    static char * pNames[IF_CUT_KER_NUM] = { "scalar", "avx2" };
+    if ( s_IfCutKerCur < 0 )
+        If_CutKernelSet( -1 );
+    return pNames[s_IfCutKerCur];
+}
+static inline int If_CutUseSimd( int nLimit )
+{
+    return s_IfCutKerCur == 1 && nLimit <= IF_CUT_SIMD_MAX;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if pDom is contained in pCut.]
@@ -120,6 +271,10 @@ static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
 {
     int i, k;
     assert( pDom->nLeaves <= pCut->nLeaves );
+#ifdef IF_CUT_DISPATCH
+    if ( If_CutUseSimd(pCut->nLeaves) )
+        return If_CutCheckDominanceAvx2( pDom, pCut );
+#endif
     for ( i = 0; i < (int)pDom->nLeaves; i++ )
     {
         for ( k = 0; k < (int)pCut->nLeaves; k++ )
@@ -294,6 +449,11 @@ int If_CutMergeOrdered( If_Man_t * p, If_Cut_t * pC0, If_Cut_t * pC1, If_Cut_t *
     int nLimit  = pC0->nLimit;
     int i, k, c, s;
 
+#ifdef IF_CUT_DISPATCH
+    if ( If_CutUseSimd(nLimit) )
+        return If_CutMergeOrderedAvx2( pC0, pC1, pC );
+#endif
+
     // both cuts are the largest
     if ( nSizeC0 == nLimit && nSizeC1 == nLimit )
     {
@@ -370,6 +530,10 @@ int If_CutMerge( If_Man_t * p, If_Cut_t * pCut0, If_Cut_t * pCut1, If_Cut_t * pC
     int * pC1 = pCut1->pLeaves;
     int * pC = pCut->pLeaves;
     int i, k, c;
+#ifdef IF_CUT_DISPATCH
+    if ( If_CutUseSimd(nLutSize) )
+        return If_CutMergeAvx2( p, pCut0, pCut1, pCut );
+#endif
     // compare two cuts with different numbers
     c = nSize0; 
     for ( i = 0; i < nSize1; i++ )
@@ -2284,6 +2284,15 @@ int If_CutPerformCheck16( If_Man_t * p, unsigned * pTruth0, int nVars, int nLeav
     if ( nLeaves <= Abc_MaxInt( nLutLeaf2, Abc_MaxInt(nLutLeaf, nLutRoot) ) )
         return 1;
 
+    // the persistent cache is keyed by the support-minimized function, like the hash table 
+    // of If_CluCheck(), because the check is sensitive to the order of variables
+    if ( p->pDecCache )
+    {
+        word Value;
+        if ( If_DecCacheLookup( p->pDecCache, p->DecCacheKind, (word *)pTruth, nLeaves, &Value, 1 ) )
+            return (int)Value;
+    }
+
     // derive the first group
     if ( Length == 2 )
         G1 = If_CluCheck( p, (word *)pTruth, nLeaves, 0, 0, nLutLeaf, nLutRoot, NULL, NULL, NULL, NULL, 1 );
@@ -2293,6 +2302,11 @@ int If_CutPerformCheck16( If_Man_t * p, unsigned * pTruth0, int nVars, int nLeav
 //    if ( G1.nVars > 0 )
 //        If_CluPrintGroup( &G1 );
 
+    if ( p->pDecCache )
+    {
+        word Value = (word)(G1.nVars > 0);
+        If_DecCacheInsert( p->pDecCache, p->DecCacheKind, (word *)pTruth, nLeaves, &Value, 1 );
+    }
     return (int)(G1.nVars > 0);
 }
 
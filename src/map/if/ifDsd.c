@@ -2466,12 +2466,37 @@ void If_DsdManTune( If_DsdMan_t * p, int LutSize, int fFast, int fAdd, int fSpec
   SeeAlso     []
 
 ***********************************************************************/
-void Id_DsdManTuneStr1( If_DsdMan_t * p, char * pStruct, int nConfls, int fVerbose )
+If_DecCache_t * Id_DsdManCacheStart( char * pFileCache, char * pStruct, int nConfls, word * pKind, int fVerbose )
+{
+    char * pKindStr;
+    if ( pFileCache == NULL )
+        return NULL;
+    pKindStr = ABC_ALLOC( char, strlen(pStruct) + 50 );
+    sprintf( pKindStr, "dsd_match-S:%s:C%d", pStruct, nConfls );
+    *pKind = If_DecCacheKind( pKindStr );
+    ABC_FREE( pKindStr );
+    return If_DecCacheStart( pFileCache, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description [If the cache file is given, the results of matching are 
+  looked up in the persistent cache before running the SAT-based matcher.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Id_DsdManTuneStr1( If_DsdMan_t * p, char * pStruct, int nConfls, char * pFileCache, int fVerbose )
 {
     int fVeryVerbose = 0;
     ProgressBar * pProgress = NULL;
     If_DsdObj_t * pObj;
-    word * pTruth, * pConfig;
+    If_DecCache_t * pCache;
+    word * pTruth, * pConfig, pValue[11], Kind = 0;
     int i, nVars, Value, LutSize;
     abctime clk = Abc_Clock();
     // parse the structure
@@ -2508,6 +2533,7 @@ void Id_DsdManTuneStr1( If_DsdMan_t * p, char * pStruct, int nConfls, int fVerbo
         p->vConfigs = Vec_WrdStart( p->nConfigWords * Vec_PtrSize(&p->vObjs) );
     else
         Vec_WrdFillExtra( p->vConfigs, p->nConfigWords * Vec_PtrSize(&p->vObjs), 0 );
+    pCache = Id_DsdManCacheStart( pFileCache, pStruct, nConfls, &Kind, fVerbose );
     pProgress = Extra_ProgressBarStart( stdout, Vec_PtrSize(&p->vObjs) );
     If_DsdVecForEachObjStart( &p->vObjs, pObj, i, p->nObjsPrev )
     {
@@ -2522,7 +2548,15 @@ void Id_DsdManTuneStr1( If_DsdMan_t * p, char * pStruct, int nConfls, int fVerbo
         if ( fVerbose )
             printf( "%6d : %2d ", i, nVars );
         pConfig = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * i );
-        Value = Ifn_NtkMatch( pNtk, pTruth, nVars, nConfls, fVerbose, fVeryVerbose, pConfig );
+        if ( pCache && If_DecCacheLookup( pCache, Kind, pTruth, nVars, pValue, 1 + p->nConfigWords ) )
+        {
+            Value = (int)pValue[0];
+            memcpy( pConfig, pValue + 1, sizeof(word) * p->nConfigWords );
+            if ( fVerbose )
+                printf( "Cached result.\n" );
+        }
+        else
+            Value = Ifn_NtkMatch( pNtk, pTruth, nVars, nConfls, fVerbose, fVeryVerbose, pConfig );
         if ( fVeryVerbose )
             printf( "\n" );
         if ( Value == 0 )
@@ -2530,7 +2564,15 @@ void Id_DsdManTuneStr1( If_DsdMan_t * p, char * pStruct, int nConfls, int fVerbo
             If_DsdVecObjSetMark( &p->vObjs, i );
             memset( pConfig, 0, sizeof(word) * p->nConfigWords );
         }
+        if ( pCache )
+        {
+            pValue[0] = (word)Value;
+            memcpy( pValue + 1, pConfig, sizeof(word) * p->nConfigWords );
+            If_DecCacheInsert( pCache, Kind, pTruth, nVars, pValue, 1 + p->nConfigWords );
+        }
     }
+    if ( pCache )
+        If_DecCacheStop( pCache );
     p->nObjsPrev = 0;
     p->LutSize = 0;
     Extra_ProgressBarStop( pProgress );
@@ -2554,9 +2596,9 @@ void Id_DsdManTuneStr1( If_DsdMan_t * p, char * pStruct, int nConfls, int fVerbo
 
 ***********************************************************************/
 #ifndef ABC_USE_PTHREADS
-void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int fVerbose )
+void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, char * pFileCache, int fVerbose )
 {
-    Id_DsdManTuneStr1( p, pStruct, nConfls, fVerbose );
+    Id_DsdManTuneStr1( p, pStruct, nConfls, pFileCache, fVerbose );
 }
 #else // pthreads are used
 
@@ -2600,7 +2642,7 @@ void * Ifn_WorkerThread( void * pArg )
     assert( 0 );
     return NULL;
 }
-void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, int fVerbose )
+void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs, char * pFileCache, int fVerbose )
 {
     int fVeryVerbose = 0;
     ProgressBar * pProgress = NULL;
@@ -2608,9 +2650,11 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
     abctime clk = Abc_Clock();
     Ifn_Ntk_t * pNtk;
     If_DsdObj_t * pObj;
+    If_DecCache_t * pCache;
+    word pValue[11], Kind = 0;
     if ( nProcs == 1 )
     {
-        Id_DsdManTuneStr1( p, pStruct, nConfls, fVerbose );
+        Id_DsdManTuneStr1( p, pStruct, nConfls, pFileCache, fVerbose );
         return;
     }
     if ( nProcs > PAR_THR_MAX )
@@ -2654,6 +2698,7 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
         p->vConfigs = Vec_WrdStart( p->nConfigWords * Vec_PtrSize(&p->vObjs) );
     else
         Vec_WrdFillExtra( p->vConfigs, p->nConfigWords * Vec_PtrSize(&p->vObjs), 0 );
+    pCache = Id_DsdManCacheStart( pFileCache, pStruct, nConfls, &Kind, fVerbose );
     pProgress = Extra_ProgressBarStart( stdout, Vec_PtrSize(&p->vObjs) );
 
     // perform concurrent solving
@@ -2694,6 +2739,12 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
                         word * pTtWords = Vec_WrdEntryP( p->vConfigs, p->nConfigWords * ThData[i].Id );
                         memcpy( pTtWords, ThData[i].pConfig, sizeof(word) * p->nConfigWords );
                     }
+                    if ( pCache )
+                    {
+                        pValue[0] = (word)ThData[i].Result;
+                        memcpy( pValue + 1, Vec_WrdEntryP(p->vConfigs, p->nConfigWords * ThData[i].Id), sizeof(word) * p->nConfigWords );
+                        If_DecCacheInsert( pCache, Kind, ThData[i].pTruth, ThData[i].nVars, pValue, 1 + p->nConfigWords );
+                    }
                     ThData[i].Id     = -1;
                     ThData[i].Result = -1;
                 }
@@ -2708,6 +2759,16 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
                     clk = Abc_Clock();
                     If_DsdManComputeTruthPtr( p, Abc_Var2Lit(k, 0), NULL, ThData[i].pTruth );
                     clkUsed += Abc_Clock() - clk;
+                    // apply the cached result without scheduling the object
+                    if ( pCache && If_DecCacheLookup( pCache, Kind, ThData[i].pTruth, nVars, pValue, 1 + p->nConfigWords ) )
+                    {
+                        if ( pValue[0] == 0 )
+                            If_DsdVecObjSetMark( &p->vObjs, k );
+                        else
+                            memcpy( Vec_WrdEntryP(p->vConfigs, p->nConfigWords * k), pValue + 1, sizeof(word) * p->nConfigWords );
+                        iCurrentObj = k+1;
+                        continue;
+                    }
                     ThData[i].nVars  = nVars;
                     ThData[i].Id     =  k;
                     ThData[i].Result = -1;
@@ -2731,6 +2792,8 @@ void Id_DsdManTuneStr( If_DsdMan_t * p, char * pStruct, int nConfls, int nProcs,
             ThData[i].Status = 1;
             ABC_FREE( ThData[i].pNtk );
         }
+        if ( pCache )
+            If_DecCacheStop( pCache );
         if ( fVerbose )
         {
             printf( "Main     : " );
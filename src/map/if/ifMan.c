@@ -56,6 +56,17 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
     memset( p, 0, sizeof(If_Man_t) );
     p->pPars    = pPars;
     p->fEpsilon = pPars->Epsilon;
+    // select the cut kernels before the mapping threads are started
+    if ( If_CutKernelCur() < 0 )
+        If_CutKernelSet( -1 );
+    // open the persistent cache of structural checks
+    if ( pPars->pDecCache && pPars->pLutStruct )
+    {
+        char pKind[100];
+        sprintf( pKind, "if-S:%s:K%d:T%d:%d%d", pPars->pLutStruct, pPars->nLutSize, pPars->nStructType, pPars->fEnableCheck75, pPars->fEnableCheck75u );
+        p->pDecCache    = If_DecCacheStart( pPars->pDecCache, pPars->fVerbose );
+        p->DecCacheKind = If_DecCacheKind( pKind );
+    }
     // allocate arrays for nodes
     p->vCis     = Vec_PtrAlloc( 100 );
     p->vCos     = Vec_PtrAlloc( 100 );
@@ -87,8 +98,9 @@ If_Man_t * If_ManStart( If_Par_t * pPars )
         }
     }
     p->nPermWords  = p->pPars->fUsePerm? If_CutPermWords( p->pPars->nLutSize ) : 0;
-    p->nObjBytes   = sizeof(If_Obj_t) + sizeof(int) * (p->pPars->nLutSize + p->nPermWords);
-    p->nCutBytes   = sizeof(If_Cut_t) + sizeof(int) * (p->pPars->nLutSize + p->nPermWords);
+    // round up to 8 bytes to keep the 64-bit cut signatures aligned
+    p->nObjBytes   = sizeof(If_Obj_t) + sizeof(word) * ((p->pPars->nLutSize + p->nPermWords + 1) / 2);
+    p->nCutBytes   = sizeof(If_Cut_t) + sizeof(word) * ((p->pPars->nLutSize + p->nPermWords + 1) / 2);
     p->nSetBytes   = sizeof(If_Set_t) + (sizeof(If_Cut_t *) + p->nCutBytes) * (p->pPars->nCutsMax + 1);
     p->pMemObj     = Mem_FixedStart( p->nObjBytes );
     // report expected memory usage
@@ -258,6 +270,8 @@ void If_ManStop( If_Man_t * p )
     Vec_WrdFreeP( &p->vAndGate );
     Vec_WrdFreeP( &p->vOrGate );
     Vec_PtrFreeP( &p->vObjsRev );
+    Vec_IntFreeP( &p->vLevOrder );
+    Vec_IntFreeP( &p->vLevStarts );
     Vec_PtrFreeP( &p->vLatchOrder );
     Vec_IntFreeP( &p->vLags );
     Vec_IntFreeP( &p->vDump );
@@ -270,6 +284,8 @@ void If_ManStop( If_Man_t * p )
     for ( i = 6; i <= Abc_MaxInt(6,p->pPars->nLutSize); i++ )
         Vec_IntFreeP( &p->vTtDecs[i] );
     Vec_IntFreeP( &p->vCutData );
+    if ( p->pDecCache )
+        If_DecCacheStop( p->pDecCache );
     Vec_IntFreeP( &p->vPairRes );
     Vec_StrFreeP( &p->vPairPerms );
     Vec_PtrFreeP( &p->vVisited );
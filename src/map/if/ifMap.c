@@ -21,6 +21,15 @@
 #include "if.h"
 #include "misc/extra/extra.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -31,6 +40,26 @@ extern char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pP
 extern int    If_CutDelayRecCost3( If_Man_t* p, If_Cut_t* pCut, If_Obj_t * pObj );
 extern int    Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char * pPerm, int * Cost, int AigLevel );
 
+#define IF_MAP_THR_MAX   64
+#define IF_MAP_PAR_WIDTH 16   // the min average number of nodes per level and thread
+
+typedef struct If_MapPar_t_ If_MapPar_t;
+struct If_MapPar_t_
+{
+    If_Man_t *     pMan;       // mapping manager
+    If_Man_t *     pViews;     // shallow copies of the manager (one per thread)
+    int            nThreads;   // the number of threads
+    int            Mode;       // mapping mode
+    int            fPreprocess;// preprocessing
+    int            fFirst;     // the first round
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;     // the barrier after each step
+    pthread_cond_t Cond;
+#endif
+    int            nWaiting;   // the number of threads waiting at the barrier
+    int            Phase;      // the number of barriers passed
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -93,13 +122,9 @@ int If_ManCutAigDelay( If_Man_t * p, If_Obj_t * pObj, If_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-static inline int If_WordCountOnes( unsigned uWord )
+static inline int If_WordCountOnes( word uWord )
 {
-    uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
-    uWord = (uWord & 0x33333333) + ((uWord>>2) & 0x33333333);
-    uWord = (uWord & 0x0F0F0F0F) + ((uWord>>4) & 0x0F0F0F0F);
-    uWord = (uWord & 0x00FF00FF) + ((uWord>>8) & 0x00FF00FF);
-    return  (uWord & 0x0000FFFF) + (uWord>>16);
+    return Abc_TtCountOnes( uWord );
 }
 
 /**Function*************************************************************
@@ -152,14 +177,16 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
   Synopsis    [Finds the best cut for the given node.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  Assumes that the cutset of the node is prepared and does not release 
+  the cutsets of the node and its fanins.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+static void If_ObjPerformMappingAndInt( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
 {
     If_Set_t * pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
@@ -181,8 +208,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    // get the prepared cutset
+    pCutSet = pObj->pCutSet;
+    assert( pCutSet->nCuts == 0 );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -487,6 +515,13 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
+}
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    // prepare the cutset
+    If_ManSetupNodeCutSet( p, pObj );
+    // compute the cuts
+    If_ObjPerformMappingAndInt( p, pObj, Mode, fPreprocess, fFirst );
     // free the cuts
     If_ManDerefNodeCutSet( p, pObj );
 }
@@ -575,6 +610,157 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if delay-oriented rounds can use several threads.]
+
+  Description [The nodes on the same level do not depend on each other 
+  in a delay-oriented round, as long as the cut computation does not 
+  update the shared data of the manager. This is the case when truth 
+  tables, choices, timing boxes, user callbacks, and special delay 
+  models are not used.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingParCheck( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    If_Par_t * pPars = p->pPars;
+    if ( pPars->nThreads < 2 || p->pManTim != NULL || p->nChoices > 0 )
+        return 0;
+    if ( pPars->fTruth || pPars->fLiftLeaves || pPars->fPower || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell || pPars->pFuncCell2 )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    return If_ManAndNum(p) >= IF_MAP_PAR_WIDTH * pPars->nThreads * p->nLevelMax;
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one delay-oriented mapping pass using several threads.]
+
+  Description [The nodes are processed level by level. The first thread 
+  prepares the cutsets of the nodes on the current level, then each thread 
+  computes the cuts of its slice of the level using its own copy of the 
+  manager (which holds the temporary permutation arrays and the counters), 
+  and finally the first thread releases the cutsets in the order of node 
+  IDs. The result is the same as that of the single-threaded pass.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManMapParBarrier( If_MapPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int Phase;
+    pthread_mutex_lock( &p->Mutex );
+    Phase = p->Phase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->Phase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+        while ( Phase == p->Phase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+static void If_ManMapParProcess( If_MapPar_t * p, int iThread )
+{
+    If_Man_t * pMan  = p->pMan;
+    If_Man_t * pView = p->pViews + iThread;
+    int Level, Beg, End, k;
+    for ( Level = 1; Level + 1 < Vec_IntSize(pMan->vLevStarts); Level++ )
+    {
+        Beg = Vec_IntEntry( pMan->vLevStarts, Level );
+        End = Vec_IntEntry( pMan->vLevStarts, Level + 1 );
+        if ( Beg == End )
+            continue;
+        if ( iThread == 0 )
+            for ( k = Beg; k < End; k++ )
+                If_ManSetupNodeCutSet( pMan, If_ManObj(pMan, Vec_IntEntry(pMan->vLevOrder, k)) );
+        If_ManMapParBarrier( p );
+        for ( k = Beg + (End - Beg) * iThread / p->nThreads; k < Beg + (End - Beg) * (iThread + 1) / p->nThreads; k++ )
+            If_ObjPerformMappingAndInt( pView, If_ManObj(pMan, Vec_IntEntry(pMan->vLevOrder, k)), p->Mode, p->fPreprocess, p->fFirst );
+        If_ManMapParBarrier( p );
+        if ( iThread == 0 )
+            for ( k = Beg; k < End; k++ )
+                If_ManDerefNodeCutSet( pMan, If_ManObj(pMan, Vec_IntEntry(pMan->vLevOrder, k)) );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+typedef struct If_MapThr_t_ If_MapThr_t;
+struct If_MapThr_t_
+{
+    If_MapPar_t *   p;
+    int             iThread;
+};
+static void * If_ManMapParWorkerThread( void * pArg )
+{
+    If_MapThr_t * pThData = (If_MapThr_t *)pArg;
+    If_ManMapParProcess( pThData->p, pThData->iThread );
+    return NULL;
+}
+#endif
+static void If_ManPerformMappingRoundPar( If_Man_t * pMan, int Mode, int fPreprocess, int fFirst )
+{
+#ifdef ABC_USE_PTHREADS
+    If_MapPar_t Par, * p = &Par;
+    pthread_t WorkerThread[IF_MAP_THR_MAX];
+    If_MapThr_t ThData[IF_MAP_THR_MAX];
+    int i, status;
+    assert( Mode == 0 && pMan->vLevOrder != NULL );
+    memset( p, 0, sizeof(If_MapPar_t) );
+    p->pMan        = pMan;
+    p->nThreads    = Abc_MinInt( pMan->nThreads, IF_MAP_THR_MAX );
+    p->Mode        = Mode;
+    p->fPreprocess = fPreprocess;
+    p->fFirst      = fFirst;
+    p->pViews      = ABC_ALLOC( If_Man_t, p->nThreads );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        memcpy( p->pViews + i, pMan, sizeof(If_Man_t) );
+        p->pViews[i].nCutsMerged = 0;
+        p->pViews[i].nCutsTotal  = 0;
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, If_ManMapParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+    // collect the counters
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        pMan->nCutsMerged += p->pViews[i].nCutsMerged;
+        pMan->nCutsTotal  += p->pViews[i].nCutsTotal;
+    }
+    ABC_FREE( p->pViews );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -641,6 +827,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( p->nThreads > 1 && Mode == 0 )
+        If_ManPerformMappingRoundPar( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
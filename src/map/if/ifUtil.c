@@ -349,6 +349,85 @@ int If_ManCrossCut( If_Man_t * p )
     return nCutSizeMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Orders the internal nodes by level.]
+
+  Description [Returns the IDs of the internal nodes sorted by level and 
+  by ID within each level. The first node of each level is stored in 
+  the array returned through pvStarts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * If_ManLevelOrder( If_Man_t * p, Vec_Int_t ** pvStarts )
+{
+    Vec_Int_t * vOrder, * vStarts;
+    If_Obj_t * pObj;
+    int i, Level, * pPlace;
+    // count the nodes on each level and find where each level starts
+    vStarts = Vec_IntStart( p->nLevelMax + 2 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_IntAddToEntry( vStarts, pObj->Level + 1, 1 );
+    for ( Level = 1; Level < Vec_IntSize(vStarts); Level++ )
+        Vec_IntAddToEntry( vStarts, Level, Vec_IntEntry(vStarts, Level-1) );
+    // place the nodes in the order of levels
+    vOrder = Vec_IntStart( If_ManAndNum(p) );
+    pPlace = ABC_ALLOC( int, Vec_IntSize(vStarts) );
+    memcpy( pPlace, Vec_IntArray(vStarts), sizeof(int) * Vec_IntSize(vStarts) );
+    If_ManForEachNode( p, pObj, i )
+        Vec_IntWriteEntry( vOrder, pPlace[pObj->Level]++, pObj->Id );
+    ABC_FREE( pPlace );
+    *pvStarts = vStarts;
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit processed by levels.]
+
+  Description [Assumes that the cutsets of all nodes on a level are 
+  allocated before any of them is computed and released after all of 
+  them are computed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevel( If_Man_t * p, Vec_Int_t * vOrder, Vec_Int_t * vStarts )
+{
+    If_Obj_t * pObj, * pFanin;
+    int i, k, nCutSize = 0, nCutSizeMax = 0;
+    assert( p->nChoices == 0 );
+    for ( i = 0; i + 1 < Vec_IntSize(vStarts); i++ )
+    {
+        // consider the nodes
+        nCutSize += Vec_IntEntry(vStarts, i+1) - Vec_IntEntry(vStarts, i);
+        if ( nCutSizeMax < nCutSize )
+            nCutSizeMax = nCutSize;
+        for ( k = Vec_IntEntry(vStarts, i); k < Vec_IntEntry(vStarts, i+1); k++ )
+        {
+            pObj = If_ManObj( p, Vec_IntEntry(vOrder, k) );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            // consider the fanins
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    return nCutSizeMax;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the reverse topological order of nodes.]
@@ -193,6 +193,8 @@ void Dar_LibFree( Dar_Lib_t * p )
 ***********************************************************************/
 int Dar_LibReturnClass( unsigned uTruth )
 {
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
     return s_DarLib->pMap[uTruth & 0xffff];
 }
 
@@ -212,6 +214,8 @@ void Dar_LibReturnCanonicals( unsigned * pCanons )
 {
     int Visits[222] = {0};
     int i, k;
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
     // find canonical truth tables
     for ( i = k = 0; i < (1<<16); i++ )
         if ( !Visits[s_DarLib->pMap[i]] )
@@ -477,8 +481,11 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 ***********************************************************************/
 void Dar_LibPrepare( int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
+    Dar_Lib_t * p;
     int i, k, nNodes0Total;
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
+    p = s_DarLib;
     if ( p->nSubgraphs == nSubgraphs )
         return;
 
@@ -583,7 +590,8 @@ Dar_Lib_t * Dar_LibRead()
 
   Synopsis    [Starts the library.]
 
-  Description []
+  Description [The library is no longer built when the frame starts.
+  Instead, the procedures using it call this one on first use.]
                
   SideEffects []
 
@@ -614,7 +622,8 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
+    if ( s_DarLib == NULL )
+        return;
     Dar_LibFree( s_DarLib );
     s_DarLib = NULL;
 }
@@ -668,6 +677,8 @@ void Dar_LibIncrementScore( int Class, int Out, int Gain )
 void Dar_LibDumpPriorities()
 {
     int i, k, Out, Out2, Counter = 0, Printed = 0;
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
     printf( "\nOutput priorities (total = %d):\n", s_DarLib->nSubgrTotal );
     for ( i = 0; i < 222; i++ )
     {
@@ -80,6 +80,11 @@ static inline int Dau_DsdReadVar( char * p )  { if ( *p == '!' ) p++; return *p
 extern unsigned      Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm );
 extern unsigned      Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm );
 extern unsigned      Abc_TtCanonicizePhase( word * pTruth, int nVars );
+extern void          Abc_TtCanonicizeBatch( word * pTruths, int nVars, int nFuncs, char * pCanonPerms, unsigned * pCanonPhases );
+extern int           Abc_TtCanonKernelBest();
+extern int           Abc_TtCanonKernelCur();
+extern int           Abc_TtCanonKernelSet( int iKer );
+extern char *        Abc_TtCanonKernelName();
 extern int           Abc_TtCountOnesInCofsSimple( word * pTruth, int nVars, int * pStore );
 extern unsigned      Abc_TtCanonicizeHie(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int fExact );
 extern Abc_TtHieMan_t * Abc_TtHieManStart( int nVars, int nLevels );
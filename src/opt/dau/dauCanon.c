@@ -24,6 +24,11 @@
 #include "bool/lucky/lucky.h"
 #include <math.h>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DAU_CANON_DISPATCH
+#include <immintrin.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -38,6 +43,10 @@ static word s_CMasks6[5] = {
     ABC_CONST(0x000000000000FFFF)
 };
 
+#define DAU_CANON_KER_NUM  2
+
+static int s_CanonKerCur = -1;  // the current kernel (0 = scalar, 1 = AVX2)
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -281,6 +290,342 @@ static inline int Abc_TtCompare2VarCofsRev( word * pTruth, int nWords, int iVar,
     }   
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels used for canonicization.]
+
+  Description [Abc_TtCanonKernelSet() takes the kernel number (0 = scalar,
+  1 = AVX2) or -1 for the best one supported by the CPU, and returns the
+  previous number. The AVX2 kernels count minterms in the cofactors and 
+  permute variables of functions with 7-16 inputs, and canonicize functions
+  with up to 6 inputs four at a time in Abc_TtCanonicizeBatch(). They give 
+  the same canonical forms as the scalar kernels.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtCanonKernelBest()
+{
+#ifdef DAU_CANON_DISPATCH
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx2") )
+        return 1;
+#endif
+    return 0;
+}
+int Abc_TtCanonKernelCur()
+{
+    return s_CanonKerCur;
+}
+int Abc_TtCanonKernelSet( int iKer )
+{
+    int iKerOld = s_CanonKerCur, iKerBest = Abc_TtCanonKernelBest();
+    s_CanonKerCur = (iKer < 0 || iKer > iKerBest) ? iKerBest : iKer;
+    return iKerOld;
+}
+char * Abc_TtCanonKernelName()
+{
+    static char * pNames[DAU_CANON_KER_NUM] = { "scalar", "avx2" };
+    if ( s_CanonKerCur < 0 )
+        Abc_TtCanonKernelSet( -1 );
+    return pNames[s_CanonKerCur];
+}
+static inline int Abc_TtCanonUseSimd( int nWords, int nWordsMin )
+{
+    if ( s_CanonKerCur < 0 )
+        Abc_TtCanonKernelSet( -1 );
+    return s_CanonKerCur == 1 && nWords >= nWordsMin;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels for truth tables with two or more words.]
+
+  Description [The words of the truth table are processed four at a time.
+  Variables 6 and 7 are permuted inside the registers, while the higher 
+  variables move whole registers. The two-word tables of 7-input functions
+  are only handled by the counting kernels.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef DAU_CANON_DISPATCH
+
+// returns the number of ones in each of the four words
+__attribute__((target("avx2"))) static inline __m256i Abc_TtCountOnes4Avx2( __m256i v )
+{
+    const __m256i Lut = _mm256_setr_epi8( 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4, 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4 );
+    const __m256i Low = _mm256_set1_epi8( 0x0F );
+    __m256i vLo = _mm256_and_si256( v, Low );
+    __m256i vHi = _mm256_and_si256( _mm256_srli_epi16(v, 4), Low );
+    __m256i vCnt = _mm256_add_epi8( _mm256_shuffle_epi8(Lut, vLo), _mm256_shuffle_epi8(Lut, vHi) );
+    return _mm256_sad_epu8( vCnt, _mm256_setzero_si256() );
+}
+// loads four words or the two words of a 7-input function
+__attribute__((target("avx2"))) static inline __m256i Abc_TtLoad4Avx2( word * p, int nWords )
+{
+    if ( nWords >= 4 )
+        return _mm256_loadu_si256( (__m256i *)p );
+    assert( nWords == 2 );
+    return _mm256_maskload_epi64( (long long const *)p, _mm256_setr_epi64x(-1, -1, 0, 0) );
+}
+__attribute__((target("avx2"))) static inline word Abc_TtSum4Avx2( __m256i v )
+{
+    word pSum[4];
+    _mm256_storeu_si256( (__m256i *)pSum, v );
+    return pSum[0] + pSum[1] + pSum[2] + pSum[3];
+}
+__attribute__((target("avx2"))) static inline __m256i Abc_TtShiftLeft4Avx2( __m256i v, int Shift )
+{
+    return _mm256_sll_epi64( v, _mm_cvtsi32_si128(Shift) );
+}
+__attribute__((target("avx2"))) static inline __m256i Abc_TtShiftRight4Avx2( __m256i v, int Shift )
+{
+    return _mm256_srl_epi64( v, _mm_cvtsi32_si128(Shift) );
+}
+// flips the variable below 6 in each of the four words
+__attribute__((target("avx2"))) static inline __m256i Abc_TtFlip4Avx2( __m256i v, int iVar )
+{
+    __m256i Mask = _mm256_set1_epi64x( (long long)s_Truths6[iVar] );
+    return _mm256_or_si256( _mm256_and_si256(Abc_TtShiftLeft4Avx2(v, 1 << iVar), Mask), Abc_TtShiftRight4Avx2(_mm256_and_si256(v, Mask), 1 << iVar) );
+}
+// swaps the adjacent variables below 5 in each of the four words
+__attribute__((target("avx2"))) static inline __m256i Abc_TtSwapAdjacent4Avx2( __m256i v, int iVar )
+{
+    __m256i Mask0 = _mm256_set1_epi64x( (long long)s_PMasks[iVar][0] );
+    __m256i Mask1 = _mm256_set1_epi64x( (long long)s_PMasks[iVar][1] );
+    __m256i Mask2 = _mm256_set1_epi64x( (long long)s_PMasks[iVar][2] );
+    return _mm256_or_si256( _mm256_and_si256(v, Mask0), _mm256_or_si256( 
+        Abc_TtShiftLeft4Avx2(_mm256_and_si256(v, Mask1), 1 << iVar), Abc_TtShiftRight4Avx2(_mm256_and_si256(v, Mask2), 1 << iVar) ) );
+}
+// swaps two variables below 6 in each of the four words
+__attribute__((target("avx2"))) static inline __m256i Abc_TtSwapVars4Avx2( __m256i v, int iVar, int jVar )
+{
+    __m256i Mask0 = _mm256_set1_epi64x( (long long)s_PPMasks[iVar][jVar][0] );
+    __m256i Mask1 = _mm256_set1_epi64x( (long long)s_PPMasks[iVar][jVar][1] );
+    __m256i Mask2 = _mm256_set1_epi64x( (long long)s_PPMasks[iVar][jVar][2] );
+    int Shift = (1 << jVar) - (1 << iVar);
+    return _mm256_or_si256( _mm256_and_si256(v, Mask0), _mm256_or_si256( 
+        Abc_TtShiftLeft4Avx2(_mm256_and_si256(v, Mask1), Shift), Abc_TtShiftRight4Avx2(_mm256_and_si256(v, Mask2), Shift) ) );
+}
+__attribute__((target("avx2"))) static inline void Abc_TtSwapBlocksAvx2( word * pA, word * pB, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w += 4 )
+    {
+        __m256i vA = _mm256_loadu_si256( (__m256i *)(pA + w) );
+        __m256i vB = _mm256_loadu_si256( (__m256i *)(pB + w) );
+        _mm256_storeu_si256( (__m256i *)(pA + w), vB );
+        _mm256_storeu_si256( (__m256i *)(pB + w), vA );
+    }
+}
+__attribute__((target("avx2"))) static int Abc_TtCountOnesInTruthAvx2( word * pTruth, int nWords )
+{
+    __m256i vAcc = _mm256_setzero_si256();
+    int w;
+    for ( w = 0; w < nWords; w += 4 )
+        vAcc = _mm256_add_epi64( vAcc, Abc_TtCountOnes4Avx2(Abc_TtLoad4Avx2(pTruth + w, nWords)) );
+    return (int)Abc_TtSum4Avx2( vAcc );
+}
+__attribute__((target("avx2"))) static void Abc_TtCountOnesInCofsAvx2( word * pTruth, int nVars, int * pStore )
+{
+    word pCounts[1024], Sum;
+    __m256i vAcc[6], vMask[6];
+    int i, k, w, nWords = Abc_TtWordNum( nVars );
+    for ( i = 0; i < 6; i++ )
+    {
+        vAcc[i]  = _mm256_setzero_si256();
+        vMask[i] = _mm256_set1_epi64x( (long long)s_Truths6Neg[i] );
+    }
+    // count ones in the negative cofactors of the first six variables and in each word
+    for ( w = 0; w < nWords; w += 4 )
+    {
+        __m256i v = Abc_TtLoad4Avx2( pTruth + w, nWords );
+        _mm256_storeu_si256( (__m256i *)(pCounts + w), Abc_TtCountOnes4Avx2(v) );
+        for ( i = 0; i < 6; i++ )
+            vAcc[i] = _mm256_add_epi64( vAcc[i], Abc_TtCountOnes4Avx2(_mm256_and_si256(v, vMask[i])) );
+    }
+    for ( i = 0; i < 6; i++ )
+        pStore[i] = (int)Abc_TtSum4Avx2( vAcc[i] );
+    // the other variables add up the words with even indexes, then merge the pairs
+    for ( i = 6; i < nVars; i++, nWords /= 2 )
+    {
+        for ( Sum = k = 0; k < nWords; k += 2 )
+        {
+            Sum += pCounts[k];
+            pCounts[k/2] = pCounts[k] + pCounts[k+1];
+        }
+        pStore[i] = (int)Sum;
+    }
+}
+__attribute__((target("avx2"))) static void Abc_TtFlipAvx2( word * pTruth, int nWords, int iVar )
+{
+    word * pLimit = pTruth + nWords;
+    int iStep = Abc_TtWordNum( iVar );
+    if ( iVar >= 8 )
+    {
+        for ( ; pTruth < pLimit; pTruth += 2*iStep )
+            Abc_TtSwapBlocksAvx2( pTruth, pTruth + iStep, iStep );
+        return;
+    }
+    for ( ; pTruth < pLimit; pTruth += 4 )
+    {
+        __m256i v = _mm256_loadu_si256( (__m256i *)pTruth );
+        if ( iVar < 6 )
+            v = Abc_TtFlip4Avx2( v, iVar );
+        else if ( iVar == 6 )
+            v = _mm256_permute4x64_epi64( v, 0xB1 );
+        else
+            v = _mm256_permute4x64_epi64( v, 0x4E );
+        _mm256_storeu_si256( (__m256i *)pTruth, v );
+    }
+}
+__attribute__((target("avx2"))) static void Abc_TtSwapAdjacentAvx2( word * pTruth, int nWords, int iVar )
+{
+    word * pLimit = pTruth + nWords;
+    int iStep = Abc_TtWordNum( iVar );
+    if ( iVar >= 8 )
+    {
+        for ( ; pTruth < pLimit; pTruth += 4*iStep )
+            Abc_TtSwapBlocksAvx2( pTruth + iStep, pTruth + 2*iStep, iStep );
+        return;
+    }
+    if ( iVar == 7 )
+    {
+        assert( nWords >= 8 );
+        for ( ; pTruth < pLimit; pTruth += 8 )
+        {
+            __m256i v0 = _mm256_loadu_si256( (__m256i *)pTruth );
+            __m256i v1 = _mm256_loadu_si256( (__m256i *)(pTruth + 4) );
+            _mm256_storeu_si256( (__m256i *)pTruth,       _mm256_permute2x128_si256(v0, v1, 0x20) );
+            _mm256_storeu_si256( (__m256i *)(pTruth + 4), _mm256_permute2x128_si256(v0, v1, 0x31) );
+        }
+        return;
+    }
+    for ( ; pTruth < pLimit; pTruth += 4 )
+    {
+        __m256i v = _mm256_loadu_si256( (__m256i *)pTruth );
+        if ( iVar < 5 )
+            v = Abc_TtSwapAdjacent4Avx2( v, iVar );
+        else if ( iVar == 5 )
+            v = _mm256_shuffle_epi32( v, 0xD8 );
+        else
+            v = _mm256_permute4x64_epi64( v, 0xD8 );
+        _mm256_storeu_si256( (__m256i *)pTruth, v );
+    }
+}
+// returns 0 if the variables are not handled by this kernel
+__attribute__((target("avx2"))) static int Abc_TtSwapVarsAvx2( word * pTruth, int nVars, int iVar, int jVar )
+{
+    word * pLimit = pTruth + Abc_TtWordNum(nVars);
+    assert( iVar < jVar );
+    if ( jVar <= 5 )
+    {
+        for ( ; pTruth < pLimit; pTruth += 4 )
+            _mm256_storeu_si256( (__m256i *)pTruth, Abc_TtSwapVars4Avx2(_mm256_loadu_si256((__m256i *)pTruth), iVar, jVar) );
+        return 1;
+    }
+    if ( iVar <= 5 && jVar >= 8 )
+    {
+        __m256i Mask = _mm256_set1_epi64x( (long long)s_Truths6[iVar] );
+        int j, jStep = Abc_TtWordNum(jVar), Shift = 1 << iVar;
+        for ( ; pTruth < pLimit; pTruth += 2*jStep )
+            for ( j = 0; j < jStep; j += 4 )
+            {
+                __m256i vLo = _mm256_loadu_si256( (__m256i *)(pTruth + j) );
+                __m256i vHi = _mm256_loadu_si256( (__m256i *)(pTruth + j + jStep) );
+                __m256i vLow2High = Abc_TtShiftRight4Avx2( _mm256_and_si256(vLo, Mask), Shift );
+                __m256i vHigh2Low = _mm256_and_si256( Abc_TtShiftLeft4Avx2(vHi, Shift), Mask );
+                _mm256_storeu_si256( (__m256i *)(pTruth + j),         _mm256_or_si256(_mm256_andnot_si256(Mask, vLo), vHigh2Low) );
+                _mm256_storeu_si256( (__m256i *)(pTruth + j + jStep), _mm256_or_si256(_mm256_and_si256(vHi, Mask), vLow2High) );
+            }
+        return 1;
+    }
+    if ( iVar >= 8 )
+    {
+        int i, iStep = Abc_TtWordNum(iVar), jStep = Abc_TtWordNum(jVar);
+        for ( ; pTruth < pLimit; pTruth += 2*jStep )
+            for ( i = 0; i < jStep; i += 2*iStep )
+                Abc_TtSwapBlocksAvx2( pTruth + iStep + i, pTruth + jStep + i, iStep );
+        return 1;
+    }
+    return 0;
+}
+__attribute__((target("avx2"))) static int Abc_TtCompareRevAvx2( word * pIn1, word * pIn2, int nWords )
+{
+    int w, k;
+    for ( w = nWords - 4; w >= 0; w -= 4 )
+    {
+        __m256i vEqu = _mm256_cmpeq_epi64( _mm256_loadu_si256((__m256i *)(pIn1 + w)), _mm256_loadu_si256((__m256i *)(pIn2 + w)) );
+        unsigned uDiff = ~(unsigned)_mm256_movemask_pd( _mm256_castsi256_pd(vEqu) ) & 0xF;
+        if ( uDiff == 0 )
+            continue;
+        k = w + 31 - __builtin_clz( uDiff );
+        return (pIn1[k] < pIn2[k]) ? -1 : 1;
+    }
+    return 0;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Variable permutation and comparison used in canonicization.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_TtCanonFlip( word * pTruth, int nWords, int iVar )
+{
+#ifdef DAU_CANON_DISPATCH
+    if ( Abc_TtCanonUseSimd(nWords, 4) )
+    {
+        Abc_TtFlipAvx2( pTruth, nWords, iVar );
+        return;
+    }
+#endif
+    Abc_TtFlip( pTruth, nWords, iVar );
+}
+static inline void Abc_TtCanonSwapAdjacent( word * pTruth, int nWords, int iVar )
+{
+#ifdef DAU_CANON_DISPATCH
+    if ( Abc_TtCanonUseSimd(nWords, 4) && (iVar != 7 || nWords >= 8) )
+    {
+        Abc_TtSwapAdjacentAvx2( pTruth, nWords, iVar );
+        return;
+    }
+#endif
+    Abc_TtSwapAdjacent( pTruth, nWords, iVar );
+}
+static inline void Abc_TtCanonSwapVars( word * pTruth, int nVars, int iVar, int jVar )
+{
+    if ( iVar == jVar )
+        return;
+    if ( jVar < iVar )
+        ABC_SWAP( int, iVar, jVar );
+#ifdef DAU_CANON_DISPATCH
+    if ( Abc_TtCanonUseSimd(Abc_TtWordNum(nVars), 4) && Abc_TtSwapVarsAvx2(pTruth, nVars, iVar, jVar) )
+        return;
+#endif
+    Abc_TtSwapVars( pTruth, nVars, iVar, jVar );
+}
+static inline int Abc_TtCanonCompareRev( word * pIn1, word * pIn2, int nWords )
+{
+#ifdef DAU_CANON_DISPATCH
+    if ( Abc_TtCanonUseSimd(nWords, 4) )
+        return Abc_TtCompareRevAvx2( pIn1, pIn2, nWords );
+#endif
+    return Abc_TtCompareRev( pIn1, pIn2, nWords );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Minterm counting in all cofactors.]
@@ -318,6 +663,10 @@ static inline int Abc_TtCountOnesInTruth( word * pTruth, int nVars )
     int nWords = Abc_TtWordNum( nVars );
     int k, Counter = 0;
     Abc_TtVerifySmallTruth(pTruth, nVars);
+#ifdef DAU_CANON_DISPATCH
+    if ( Abc_TtCanonUseSimd(nWords, 2) )
+        return Abc_TtCountOnesInTruthAvx2( pTruth, nWords );
+#endif
     for ( k = 0; k < nWords; k++ )
         if ( pTruth[k] )
             Counter += Abc_TtCountOnes( pTruth[k] );
@@ -336,6 +685,13 @@ static inline void Abc_TtCountOnesInCofs( word * pTruth, int nVars, int * pStore
     }
     assert( nVars > 6 );
     nWords = Abc_TtWordNum( nVars );
+#ifdef DAU_CANON_DISPATCH
+    if ( Abc_TtCanonUseSimd(nWords, 2) )
+    {
+        Abc_TtCountOnesInCofsAvx2( pTruth, nVars, pStore );
+        return;
+    }
+#endif
     memset( pStore, 0, sizeof(int) * nVars );
     for ( k = 0; k < nWords; k++ )
     {
@@ -568,6 +924,43 @@ int Abc_TtCountOnesInCofsFast( word * pTruth, int nVars, int * pStore )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Sorts the variables by the number of 1s in their cofactors.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Abc_TtSemiCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm, int * pStore, unsigned uCanonPhase )
+{
+    int i, k, BestK;
+    for ( i = 0; i < nVars - 1; i++ )
+    {
+        BestK = i + 1;
+        for ( k = i + 2; k < nVars; k++ )
+            if ( pStore[BestK] > pStore[k] )
+//            if ( pStore[BestK] < pStore[k] )
+                BestK = k;
+        if ( pStore[i] <= pStore[BestK] )
+//        if ( pStore[i] >= pStore[BestK] )
+            continue;
+        ABC_SWAP( int, pCanonPerm[i], pCanonPerm[BestK] );
+        ABC_SWAP( int, pStore[i], pStore[BestK] );
+        if ( ((uCanonPhase >> i) & 1) != ((uCanonPhase >> BestK) & 1) )
+        {
+            uCanonPhase ^= (1 << i);
+            uCanonPhase ^= (1 << BestK);
+        }
+        Abc_TtCanonSwapVars( pTruth, nVars, i, BestK );
+//        nSwaps++;
+    }
+    return uCanonPhase;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -608,7 +1001,7 @@ static inline unsigned Abc_TtSemiCanonicize( word * pTruth, int nVars, char * pC
         {
             if ( pStore[i] >= nOnes - pStore[i] || fOnlySwap )
                 continue;
-            Abc_TtFlip( pTruth, nWords, i );
+            Abc_TtCanonFlip( pTruth, nWords, i );
             uCanonPhase |= (1 << i);
             pStore[i] = nOnes - pStore[i]; 
         }
@@ -631,7 +1024,7 @@ static inline unsigned Abc_TtSemiCanonicize( word * pTruth, int nVars, char * pC
         {
             if ( pStore[i] >= nOnes - pStore[i] || fOnlySwap )
                 continue;
-            Abc_TtFlip( pTruth, nWords, i );
+            Abc_TtCanonFlip( pTruth, nWords, i );
             uCanonPhase |= (1 << i);
             pStore[i] = nOnes - pStore[i]; 
         }
@@ -655,7 +1048,7 @@ static inline unsigned Abc_TtSemiCanonicize( word * pTruth, int nVars, char * pC
                     uCanonPhase ^= (1 << i);
                     uCanonPhase ^= (1 << (i+1));
                 }
-                Abc_TtSwapAdjacent( pTruth, nWords, i );            
+                Abc_TtCanonSwapAdjacent( pTruth, nWords, i );            
                 fChange = 1;
     //            nSwaps++;
             }
@@ -663,29 +1056,7 @@ static inline unsigned Abc_TtSemiCanonicize( word * pTruth, int nVars, char * pC
         while ( fChange );
     }
     else
-    {
-        int k, BestK;
-        for ( i = 0; i < nVars - 1; i++ )
-        {
-            BestK = i + 1;
-            for ( k = i + 2; k < nVars; k++ )
-                if ( pStore[BestK] > pStore[k] )
-    //            if ( pStore[BestK] < pStore[k] )
-                    BestK = k;
-            if ( pStore[i] <= pStore[BestK] )
-    //        if ( pStore[i] >= pStore[BestK] )
-                continue;
-            ABC_SWAP( int, pCanonPerm[i], pCanonPerm[BestK] );
-            ABC_SWAP( int, pStore[i], pStore[BestK] );
-            if ( ((uCanonPhase >> i) & 1) != ((uCanonPhase >> BestK) & 1) )
-            {
-                uCanonPhase ^= (1 << i);
-                uCanonPhase ^= (1 << BestK);
-            }
-            Abc_TtSwapVars( pTruth, nVars, i, BestK );
-    //        nSwaps++;
-        }
-    }
+        uCanonPhase = Abc_TtSemiCanonicizePerm( pTruth, nVars, pCanonPerm, pStore, uCanonPhase );
     return uCanonPhase;
 }
 
@@ -798,8 +1169,8 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
     {
         static word pCopy[1024];
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
-        Abc_TtSwapAdjacent( pCopy, nWords, i );
-        if ( Abc_TtCompareRev(pTruth, pCopy, nWords) == 1 )
+        Abc_TtCanonSwapAdjacent( pCopy, nWords, i );
+        if ( Abc_TtCanonCompareRev(pTruth, pCopy, nWords) == 1 )
         {
             Abc_TtCopy( pTruth, pCopy, nWords, 0 );
             return 4;
@@ -815,46 +1186,46 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
         Abc_TtCopy( pBest, pTruth, nWords, 0 );
         // PXY
         // 001
-        Abc_TtFlip( pCopy, nWords, i );
-        if ( Abc_TtCompareRev(pBest, pCopy, nWords) == 1 )
+        Abc_TtCanonFlip( pCopy, nWords, i );
+        if ( Abc_TtCanonCompareRev(pBest, pCopy, nWords) == 1 )
             Abc_TtCopy( pBest, pCopy, nWords, 0 ), Config = 1;
         // PXY
         // 011
-        Abc_TtFlip( pCopy, nWords, i+1 );
-        if ( Abc_TtCompareRev(pBest, pCopy, nWords) == 1 )
+        Abc_TtCanonFlip( pCopy, nWords, i+1 );
+        if ( Abc_TtCanonCompareRev(pBest, pCopy, nWords) == 1 )
             Abc_TtCopy( pBest, pCopy, nWords, 0 ), Config = 3;
         // PXY
         // 010
-        Abc_TtFlip( pCopy, nWords, i );
-        if ( Abc_TtCompareRev(pBest, pCopy, nWords) == 1 )
+        Abc_TtCanonFlip( pCopy, nWords, i );
+        if ( Abc_TtCanonCompareRev(pBest, pCopy, nWords) == 1 )
             Abc_TtCopy( pBest, pCopy, nWords, 0 ), Config = 2;
         // PXY
         // 110
-        Abc_TtSwapAdjacent( pCopy, nWords, i );
-        if ( Abc_TtCompareRev(pBest, pCopy, nWords) == 1 )
+        Abc_TtCanonSwapAdjacent( pCopy, nWords, i );
+        if ( Abc_TtCanonCompareRev(pBest, pCopy, nWords) == 1 )
             Abc_TtCopy( pBest, pCopy, nWords, 0 ), Config = 6;
         // PXY
         // 111
-        Abc_TtFlip( pCopy, nWords, i+1 );
-        if ( Abc_TtCompareRev(pBest, pCopy, nWords) == 1 )
+        Abc_TtCanonFlip( pCopy, nWords, i+1 );
+        if ( Abc_TtCanonCompareRev(pBest, pCopy, nWords) == 1 )
             Abc_TtCopy( pBest, pCopy, nWords, 0 ), Config = 7;
         // PXY
         // 101
-        Abc_TtFlip( pCopy, nWords, i );
-        if ( Abc_TtCompareRev(pBest, pCopy, nWords) == 1 )
+        Abc_TtCanonFlip( pCopy, nWords, i );
+        if ( Abc_TtCanonCompareRev(pBest, pCopy, nWords) == 1 )
             Abc_TtCopy( pBest, pCopy, nWords, 0 ), Config = 5;
         // PXY
         // 100
-        Abc_TtFlip( pCopy, nWords, i+1 );
-        if ( Abc_TtCompareRev(pBest, pCopy, nWords) == 1 )
+        Abc_TtCanonFlip( pCopy, nWords, i+1 );
+        if ( Abc_TtCanonCompareRev(pBest, pCopy, nWords) == 1 )
             Abc_TtCopy( pBest, pCopy, nWords, 0 ), Config = 4;
         // PXY
         // 000
-        Abc_TtSwapAdjacent( pCopy, nWords, i );
+        Abc_TtCanonSwapAdjacent( pCopy, nWords, i );
         assert( Abc_TtEqual( pTruth, pCopy, nWords ) );
         if ( Config == 0 )
             return 0;
-        assert( Abc_TtCompareRev(pTruth, pBest, nWords) == 1 );
+        assert( Abc_TtCanonCompareRev(pTruth, pBest, nWords) == 1 );
         Abc_TtCopy( pTruth, pBest, nWords, 0 );
         return Config;
     }
@@ -882,7 +1253,7 @@ int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, i
     {
         if ( Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 1, 2 ) < 0 ) // Cof1 < Cof2
         {
-            Abc_TtSwapAdjacent( pTruth, nWords, i );
+            Abc_TtCanonSwapAdjacent( pTruth, nWords, i );
             return 4;
         }
         return 0;
@@ -897,12 +1268,12 @@ int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, i
             {
                 fComp13 = Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 1, 3 );
                 if ( fComp13 < 0 ) // Cof1 < Cof3 
-                    Abc_TtFlip( pTruth, nWords, i + 1 ), Config = 2;
+                    Abc_TtCanonFlip( pTruth, nWords, i + 1 ), Config = 2;
                 else if ( fComp13 == 0 ) // Cof1 == Cof3 
                 {
                     fComp02 = Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 0, 2 );
                     if ( fComp02 < 0 )
-                        Abc_TtFlip( pTruth, nWords, i + 1 ), Config = 2;
+                        Abc_TtCanonFlip( pTruth, nWords, i + 1 ), Config = 2;
                 }
                 // else   Cof1 > Cof3 -- do nothing
             }
@@ -911,13 +1282,13 @@ int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, i
                 fComp03 = Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 0, 3 );
                 if ( fComp03 < 0 ) // Cof0 < Cof3
                 {
-                    Abc_TtFlip( pTruth, nWords, i );
-                    Abc_TtFlip( pTruth, nWords, i + 1 ), Config = 3;
+                    Abc_TtCanonFlip( pTruth, nWords, i );
+                    Abc_TtCanonFlip( pTruth, nWords, i + 1 ), Config = 3;
                 }
                 else //  Cof0 >= Cof3
                 {
                     if ( fComp23 == 0 ) // can flip Cof0 and Cof1
-                        Abc_TtFlip( pTruth, nWords, i ), Config = 1;
+                        Abc_TtCanonFlip( pTruth, nWords, i ), Config = 1;
                 }
             }
         }
@@ -927,17 +1298,17 @@ int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, i
             {
                 fComp12 = Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 1, 2 );
                 if ( fComp12 > 0 ) // Cof1 > Cof2 
-                    Abc_TtFlip( pTruth, nWords, i ), Config = 1;
+                    Abc_TtCanonFlip( pTruth, nWords, i ), Config = 1;
                 else if ( fComp12 == 0 ) // Cof1 == Cof2 
                 {
-                    Abc_TtFlip( pTruth, nWords, i );
-                    Abc_TtFlip( pTruth, nWords, i + 1 ), Config = 3;
+                    Abc_TtCanonFlip( pTruth, nWords, i );
+                    Abc_TtCanonFlip( pTruth, nWords, i + 1 ), Config = 3;
                 }
                 else // Cof1 < Cof2
                 {
-                    Abc_TtFlip( pTruth, nWords, i + 1 ), Config = 2;
+                    Abc_TtCanonFlip( pTruth, nWords, i + 1 ), Config = 2;
                     if ( fComp01 == 0 )
-                        Abc_TtFlip( pTruth, nWords, i ), Config ^= 1;
+                        Abc_TtCanonFlip( pTruth, nWords, i ), Config ^= 1;
                 }
             }
             else // Cof0 < Cof1
@@ -945,28 +1316,28 @@ int Abc_TtCofactorPermConfig( word * pTruth, int i, int nWords, int fSwapOnly, i
                 fComp02 = Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 0, 2 );
                 if ( fComp02 == -1 ) // Cof0 < Cof2 
                 {
-                    Abc_TtFlip( pTruth, nWords, i );
-                    Abc_TtFlip( pTruth, nWords, i + 1 ), Config = 3;
+                    Abc_TtCanonFlip( pTruth, nWords, i );
+                    Abc_TtCanonFlip( pTruth, nWords, i + 1 ), Config = 3;
                 }
                 else if ( fComp02 == 0 ) // Cof0 == Cof2
                 {
                     fComp13 = Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 1, 3 );
                     if ( fComp13 >= 0 ) // Cof1 >= Cof3 
-                        Abc_TtFlip( pTruth, nWords, i ), Config = 1;
+                        Abc_TtCanonFlip( pTruth, nWords, i ), Config = 1;
                     else // Cof1 < Cof3 
                     {
-                        Abc_TtFlip( pTruth, nWords, i );
-                        Abc_TtFlip( pTruth, nWords, i + 1 ), Config = 3;
+                        Abc_TtCanonFlip( pTruth, nWords, i );
+                        Abc_TtCanonFlip( pTruth, nWords, i + 1 ), Config = 3;
                     }
                 }
                 else // Cof0 > Cof2
-                    Abc_TtFlip( pTruth, nWords, i ), Config = 1;
+                    Abc_TtCanonFlip( pTruth, nWords, i ), Config = 1;
             }
         }
         // perform final swap if needed
         fComp12 = Abc_TtCompare2VarCofsRev( pTruth, nWords, i, 1, 2 );
         if ( fComp12 < 0 ) // Cof1 < Cof2
-            Abc_TtSwapAdjacent( pTruth, nWords, i ), Config ^= 4;
+            Abc_TtCanonSwapAdjacent( pTruth, nWords, i ), Config ^= 4;
         return Config;
     }
 }
@@ -993,7 +1364,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
         Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 0, fNaive );
         if ( Config == 0 )
             return 0;
-        if ( Abc_TtCompareRev(pTruth, pCopy1, nWords) == 1 ) // made it worse
+        if ( Abc_TtCanonCompareRev(pTruth, pCopy1, nWords) == 1 ) // made it worse
         {
             Abc_TtCopy( pTruth, pCopy1, nWords, 0 );
             return 0;
@@ -1018,46 +1389,64 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
 
 /**Function*************************************************************
 
-  Synopsis    [Semi-canonical form computation.]
+  Synopsis    [Improves the semi-canonical form by swapping and flipping pairs of variables.]
 
-  Description []
+  Description [Considers pairs of adjacent variables with the same number of 1s
+  in their cofactors, as recorded in pStoreIn by Abc_TtSemiCanonicize().]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-#define CANON_VERIFY
-unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
+static inline void Abc_TtCanonicizeImprove( word * pTruth, int nVars, char * pCanonPerm, unsigned * puCanonPhase, int * pStoreIn )
 {
-    int pStoreIn[17];
-    unsigned uCanonPhase;
     int i, k, nWords = Abc_TtWordNum( nVars );
     int fNaive = 1;
-
-#ifdef CANON_VERIFY
-    char pCanonPermCopy[16];
-    static word pCopy1[1024];
-    static word pCopy2[1024];
-    Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
-#endif
-
-    uCanonPhase = Abc_TtSemiCanonicize( pTruth, nVars, pCanonPerm, pStoreIn, 0 );
     for ( k = 0; k < 5; k++ )
     {
         int fChanges = 0;
         for ( i = nVars - 2; i >= 0; i-- )
             if ( pStoreIn[i] == pStoreIn[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, puCanonPhase, fNaive );
         if ( !fChanges )
             break;
         fChanges = 0;
         for ( i = 1; i < nVars - 1; i++ )
             if ( pStoreIn[i] == pStoreIn[i+1] )
-                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, &uCanonPhase, fNaive );
+                fChanges |= Abc_TtCofactorPerm( pTruth, i, nWords, pStoreIn[i] != pStoreIn[nVars]/2, pCanonPerm, puCanonPhase, fNaive );
         if ( !fChanges )
             break;
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Semi-canonical form computation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define CANON_VERIFY
+unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
+{
+    int pStoreIn[17];
+    unsigned uCanonPhase;
+    int nWords = Abc_TtWordNum( nVars );
+
+#ifdef CANON_VERIFY
+    char pCanonPermCopy[16];
+    static word pCopy1[1024];
+    static word pCopy2[1024];
+    Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
+#endif
+
+    uCanonPhase = Abc_TtSemiCanonicize( pTruth, nVars, pCanonPerm, pStoreIn, 0 );
+    Abc_TtCanonicizeImprove( pTruth, nVars, pCanonPerm, &uCanonPhase, pStoreIn );
 
 #ifdef CANON_VERIFY
     Abc_TtCopy( pCopy2, pTruth, nWords, 0 );
@@ -1124,6 +1513,137 @@ unsigned Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm )
     return uCanonPhase;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Semi-canonical form computation for four functions at a time.]
+
+  Description [Performs the same steps as Abc_TtCanonicize() for functions 
+  with up to 6 inputs. Polarity and phase normalization are done for the 
+  four functions at once; the data-dependent steps are done one at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef DAU_CANON_DISPATCH
+
+__attribute__((target("avx2"))) static inline __m256i Abc_TtLaneMaskAvx2( int * pFlags )
+{
+    return _mm256_setr_epi64x( -(long long)(pFlags[0] != 0), -(long long)(pFlags[1] != 0), -(long long)(pFlags[2] != 0), -(long long)(pFlags[3] != 0) );
+}
+__attribute__((target("avx2"))) static void Abc_TtCanonicize4Avx2( word * pTruths, int nVars, char pCanonPerm[4][16], unsigned * pCanonPhase )
+{
+    __m256i vTruth = _mm256_loadu_si256( (__m256i *)pTruths );
+    word pCounts[4];
+    int pStore[4][17], pFlags[4];
+    int l, i, nOnes;
+    assert( nVars <= 6 );
+    for ( l = 0; l < 4; l++ )
+    {
+        for ( i = 0; i < nVars; i++ )
+            pCanonPerm[l][i] = i;
+        pCanonPhase[l] = 0;
+    }
+    // normalize polarity
+    _mm256_storeu_si256( (__m256i *)pCounts, Abc_TtCountOnes4Avx2(vTruth) );
+    for ( l = 0; l < 4; l++ )
+    {
+        pFlags[l] = pCounts[l] > 32;
+        if ( pFlags[l] )
+            pCounts[l] = 64 - pCounts[l], pCanonPhase[l] |= (1 << nVars);
+        pStore[l][nVars] = (int)pCounts[l];
+    }
+    vTruth = _mm256_xor_si256( vTruth, Abc_TtLaneMaskAvx2(pFlags) );
+    // normalize phase
+    for ( i = 0; i < nVars; i++ )
+    {
+        _mm256_storeu_si256( (__m256i *)pCounts, Abc_TtCountOnes4Avx2(_mm256_and_si256(vTruth, _mm256_set1_epi64x((long long)s_Truths6Neg[i]))) );
+        for ( l = 0; l < 4; l++ )
+        {
+            nOnes = pStore[l][nVars];
+            pStore[l][i] = (int)pCounts[l];
+            pFlags[l] = pStore[l][i] < nOnes - pStore[l][i];
+            if ( pFlags[l] )
+                pCanonPhase[l] |= (1 << i), pStore[l][i] = nOnes - pStore[l][i];
+        }
+        vTruth = _mm256_blendv_epi8( vTruth, Abc_TtFlip4Avx2(vTruth, i), Abc_TtLaneMaskAvx2(pFlags) );
+    }
+    _mm256_storeu_si256( (__m256i *)pTruths, vTruth );
+    // normalize permutation and improve the result in each lane
+    for ( l = 0; l < 4; l++ )
+    {
+        pCanonPhase[l] = Abc_TtSemiCanonicizePerm( pTruths + l, nVars, pCanonPerm[l], pStore[l], pCanonPhase[l] );
+        Abc_TtCanonicizeImprove( pTruths + l, nVars, pCanonPerm[l], pCanonPhase + l, pStore[l] );
+    }
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Semi-canonical form computation for an array of functions.]
+
+  Description [Canonicizes nFuncs truth tables of nVars inputs stored one 
+  after another in pTruths. Returns the permutations (nVars entries per
+  function) and the phases in pCanonPerms and pCanonPhases, if they are not 
+  NULL. The results are the same as those of Abc_TtCanonicize().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCanonicizeBatch( word * pTruths, int nVars, int nFuncs, char * pCanonPerms, unsigned * pCanonPhases )
+{
+    char pCanonPerm[16];
+    unsigned uCanonPhase;
+    int i, nWords = Abc_TtWordNum( nVars ), iFunc = 0;
+    assert( nVars <= 16 );
+#ifdef DAU_CANON_DISPATCH
+    if ( nVars <= 6 && Abc_TtCanonUseSimd(4, 4) )
+    {
+        char pCanonPerm4[4][16];
+        unsigned pCanonPhase4[4];
+        int l;
+        for ( ; iFunc + 4 <= nFuncs; iFunc += 4 )
+        {
+#ifdef CANON_VERIFY
+            word pCopy1[4], pCopy2[4];
+            memcpy( pCopy1, pTruths + iFunc, sizeof(word) * 4 );
+#endif
+            Abc_TtCanonicize4Avx2( pTruths + iFunc, nVars, pCanonPerm4, pCanonPhase4 );
+#ifdef CANON_VERIFY
+            memcpy( pCopy2, pTruths + iFunc, sizeof(word) * 4 );
+            for ( l = 0; l < 4; l++ )
+            {
+                memcpy( pCanonPerm, pCanonPerm4[l], sizeof(char) * nVars );
+                Abc_TtImplementNpnConfig( pCopy2 + l, nVars, pCanonPerm, pCanonPhase4[l] );
+                if ( pCopy1[l] != pCopy2[l] )
+                    printf( "Canonical form verification failed!\n" );
+            }
+#endif
+            for ( l = 0; l < 4; l++ )
+            {
+                if ( pCanonPerms )
+                    memcpy( pCanonPerms + (iFunc + l) * nVars, pCanonPerm4[l], sizeof(char) * nVars );
+                if ( pCanonPhases )
+                    pCanonPhases[iFunc + l] = pCanonPhase4[l];
+            }
+        }
+    }
+#endif
+    for ( ; iFunc < nFuncs; iFunc++ )
+    {
+        uCanonPhase = Abc_TtCanonicize( pTruths + iFunc * nWords, nVars, pCanonPerm );
+        if ( pCanonPerms )
+            for ( i = 0; i < nVars; i++ )
+                pCanonPerms[iFunc * nVars + i] = pCanonPerm[i];
+        if ( pCanonPhases )
+            pCanonPhases[iFunc] = uCanonPhase;
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Semi-canonical form computation.]
@@ -78,6 +78,8 @@ struct Abs_Par_t_
     int            iFrameProved;       // the number of frames proved
     int            nFramesNoChange;    // the number of last frames without changes
     int            nFramesNoChangeLim; // the number of last frames without changes to dump abstraction
+    int            RunId;              // GLA id in this run 
+    int(*pFuncStop)(int);              // callback to terminate
 };
 
 // old abstraction parameters
@@ -1137,6 +1137,8 @@ void Ga2_ManRestart( Ga2_Man_t * p )
     // set runtime limit
     if ( p->pPars->nTimeOut )
         sat_solver2_set_runtime_limit( p->pSat, p->pPars->nTimeOut * CLOCKS_PER_SEC + p->timeStart );
+    sat_solver2_set_runid( p->pSat, p->pPars->RunId );
+    sat_solver2_set_stop_func( p->pSat, p->pPars->pFuncStop );
     // clean the hash table
     memset( p->pTable, 0, 6 * sizeof(int) * p->nTable );
 }
@@ -1699,6 +1701,8 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     goto finish;
                 if ( p->pSat->nRuntimeLimit && Abc_Clock() > p->pSat->nRuntimeLimit ) // timeout
                     goto finish;
+                if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // cancelled
+                    goto finish;
                 if ( c == 0 )
                 {
                     if ( f > p->pPars->iFrameProved )
@@ -1851,7 +1855,9 @@ finish:
     {
         Vec_IntFreeP( &pAig->vGateClasses );
         pAig->vGateClasses = Ga2_ManAbsTranslate( p );
-        if ( p->pPars->nTimeOut && Abc_Clock() >= p->pSat->nRuntimeLimit ) 
+        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) 
+            Abc_Print( 1, "GLA was cancelled in frame %d with a %d-stable abstraction.  ", p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
+        else if ( p->pPars->nTimeOut && Abc_Clock() >= p->pSat->nRuntimeLimit ) 
             Abc_Print( 1, "GLA reached timeout %d sec in frame %d with a %d-stable abstraction.    ", p->pPars->nTimeOut, p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
         else if ( pPars->nConfLimit && sat_solver2_nconflicts(p->pSat) >= pPars->nConfLimit )
             Abc_Print( 1, "GLA exceeded %d conflicts in frame %d with a %d-stable abstraction.  ", pPars->nConfLimit, p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
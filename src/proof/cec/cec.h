@@ -111,6 +111,8 @@ struct Cec_ParFra_t_
     int              fRunCSat;      // enable another solver
     int              fUseCones;     // use cones
     int              fUseOrigIds;   // enable recording of original IDs
+    int              nProcNum;      // the number of threads
+    int              fEventSim;     // event-driven resimulation
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
@@ -130,6 +132,7 @@ struct Cec_ParCec_t_
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the number of failed output
+    int              nThreads;      // the number of threads for random simulation
 };
 
 // sequential register correspodence parameters
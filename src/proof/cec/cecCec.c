@@ -22,6 +22,7 @@
 #include "proof/fra/fra.h"
 #include "aig/gia/giaAig.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilTruth.h"
 #include "sat/cnf/cnf.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -212,6 +213,61 @@ int Cec_ManHandleSpecialCases( Gia_Man_t * p, Cec_ParCec_t * pPars )
     return -1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs multi-threaded random simulation of the miter.]
+
+  Description [Takes the dual-output miter. Returns 1 and saves the 
+  counter-example in p->pCexComb if a pair of outputs is found to differ.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManVerifySimulate( Gia_Man_t * p, Cec_ParCec_t * pPars )
+{
+    int nRounds = 8, nWords = Abc_MaxInt( 16, 4 * pPars->nThreads );
+    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(p) * nWords );
+    abctime clk = Abc_ClockWall();
+    int i, r, w, Id, iPat = -1;
+    assert( Gia_ManPoNum(p) % 2 == 0 );
+    Gia_ManRandomW( 1 );
+    for ( r = 0; r < nRounds && iPat == -1; r++ )
+    {
+        Gia_ManForEachCiId( p, Id, i )
+            for ( w = 0; w < nWords; w++ )
+                Vec_WrdWriteEntry( vSims, Id*nWords+w, Gia_ManRandomW(0) );
+        Gia_ManSimPatSimPar( p, vSims, nWords, pPars->nThreads, 1 );
+        for ( i = 0; i < Gia_ManPoNum(p)/2; i++ )
+        {
+            word * pSim0 = Vec_WrdEntryP( vSims, Gia_ObjId(p, Gia_ManPo(p, 2*i))*nWords );
+            word * pSim1 = Vec_WrdEntryP( vSims, Gia_ObjId(p, Gia_ManPo(p, 2*i+1))*nWords );
+            for ( w = 0; w < nWords; w++ )
+                if ( pSim0[w] != pSim1[w] )
+                    break;
+            if ( w == nWords )
+                continue;
+            iPat = 64 * w + Abc_Tt6FirstBit( pSim0[w] ^ pSim1[w] );
+            Cec_ManTransformPattern( p, i, NULL );
+            Gia_ManForEachCiId( p, Id, w )
+                if ( Abc_TtGetBit(Vec_WrdEntryP(vSims, Id*nWords), iPat) )
+                    Abc_InfoSetBit( p->pCexComb->pData, w );
+            pPars->iOutFail = i;
+            break;
+        }
+    }
+    Vec_WrdFree( vSims );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Simulated %d rounds of %d patterns using %d threads. ", r, 64 * nWords, pPars->nThreads );
+        if ( iPat >= 0 )
+            Abc_Print( 1, "Output %d fails. ", pPars->iOutFail );
+        Abc_PrintTime( 1, "Time", Abc_ClockWall() - clk );
+    }
+    return iPat >= 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs naive checking.]
@@ -343,6 +399,19 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     Gia_ManEquivFixOutputPairs( p );
     p = Gia_ManCleanup( pNew = p );
     Gia_ManStop( pNew );
+    if ( pPars->nThreads > 1 && Cec_ManVerifySimulate( p, pPars ) )
+    {
+        pInit->pCexComb = p->pCexComb; p->pCexComb = NULL;
+        Gia_ManStop( p );
+        if ( !Gia_ManVerifyCex( pInit, pInit->pCexComb, 1 ) )
+            Abc_Print( 1, "Counter-example simulation has failed.\n" );
+        if ( !pPars->fSilent )
+        {
+        Abc_Print( 1, "Networks are NOT EQUIVALENT.  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+        return 0;
+    }
     if ( pPars->fNaive )
     {
         RetValue = Cec_ManVerifyNaive( p, pPars );
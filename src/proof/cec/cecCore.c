@@ -139,6 +139,8 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->fColorDiff     =       0;  // miter with separate outputs
     p->fSatSweeping   =       0;  // enable SAT sweeping
     p->fUseCones      =       0;  // use cones
+    p->nProcNum       =       0;  // the number of threads
+    p->fEventSim      =       0;  // event-driven resimulation
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the failed output
@@ -166,6 +168,7 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the number of failed output
+    p->nThreads       =       1;  // the number of threads for random simulation
 }  
 
 /**Function*************************************************************
@@ -23,6 +23,15 @@
 #include "sat/glucose/AbcGlucose.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -39,6 +48,8 @@ struct Cec3_Par_t_
     int              nConfLimit;    // SAT solver conflict limit
     int              fIsMiter;      // this is a miter
     int              fUseCones;     // use logic cones
+    int              nProcNum;      // the number of threads
+    int              fEventSim;     // event-driven resimulation
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
 };
@@ -59,6 +70,14 @@ struct Cec3_Man_t_
     Vec_Int_t *      vSatVars;       // nodes
     Vec_Int_t *      vObjSatPairs;   // nodes
     Vec_Int_t *      vCexTriples;    // nodes
+    Vec_Int_t *      vCexPairs;      // CI values of the last pattern
+    Gia_SimKer_t *   pKer;           // simulation kernels selected for this manager
+    // event-driven resimulation
+    Vec_Wec_t *      vFanouts;       // fanouts of each object
+    Vec_Int_t *      vSimChanged;    // CIs whose simulation info was changed by the patterns
+    Vec_Bit_t *      vSimMarks;      // nodes scheduled for resimulation
+    word             nSimEvals;      // the number of node evaluations during resimulation
+    word             nSimEvalsFull;  // the number of node evaluations without events
     // statistics
     int              nPatterns;
     int              nSatSat;
@@ -77,6 +96,9 @@ static inline int    Cec3_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )
 static inline int    Cec3_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec3_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); return Num;  }
 static inline void   Cec3_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec3_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
 
+#define CEC3_PROC_MAX   64     // the largest number of threads
+#define CEC3_PAR_BATCH  1000   // the largest number of candidates solved concurrently
+
 static inline void   satoko_mark_cone( bmcg_sat_solver * p, int * pVars, int nVars )   {}
 static inline void   satoko_unmark_cone( bmcg_sat_solver * p, int * pVars, int nVars ) {}
 
@@ -104,6 +126,8 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
     p->nConfLimit     =    1000;    // conflict limit at a node
     p->fIsMiter       =       0;    // this is a miter
     p->fUseCones      =       0;    // use logic cones
+    p->nProcNum       =       0;    // the number of threads
+    p->fEventSim      =       0;    // event-driven resimulation
     p->fVeryVerbose   =       0;    // verbose stats
     p->fVerbose       =       0;    // verbose stats
 }  
@@ -373,11 +397,13 @@ static inline word * Cec3_ObjSim( Gia_Man_t * p, int iObj )
 {
     return Vec_WrdEntryP( p->vSims, p->nSimWords * iObj );
 }
-static inline void Cec3_ObjSimSetInputBit( Gia_Man_t * p, int iObj, int Bit )
+static inline int Cec3_ObjSimSetInputBit( Gia_Man_t * p, int iObj, int Bit )
 {
     word * pSim = Cec3_ObjSim( p, iObj );
-    if ( Abc_InfoHasBit( (unsigned*)pSim, p->iPatsPi ) != Bit )
-        Abc_InfoXorBit( (unsigned*)pSim, p->iPatsPi );
+    if ( Abc_InfoHasBit( (unsigned*)pSim, p->iPatsPi ) == Bit )
+        return 0;
+    Abc_InfoXorBit( (unsigned*)pSim, p->iPatsPi );
+    return 1;
 }
 static inline void Cec3_ObjSimRo( Gia_Man_t * p, int iObj )
 {
@@ -400,45 +426,19 @@ static inline void Cec3_ObjSimCo( Gia_Man_t * p, int iObj )
         for ( w = 0; w < p->nSimWords; w++ )
             pSimCo[w] =  pSimDri[w];
 }
-static inline void Cec3_ObjSimAnd( Gia_Man_t * p, int iObj )
+static inline void Cec3_ObjSimAnd( Gia_Man_t * p, Gia_SimKer_t * pKer, int iObj )
 {
-    int w;
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSim  = Cec3_ObjSim( p, iObj );
     word * pSim0 = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec3_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & ~pSim1[w];
-    else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = ~pSim0[w] & pSim1[w];
-    else if ( !Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & ~pSim1[w];
-    else
-        for ( w = 0; w < p->nSimWords; w++ )
-            pSim[w] = pSim0[w] & pSim1[w];
+    pKer->pFuncAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ? ~(word)0 : 0, Gia_ObjFaninC1(pObj) ? ~(word)0 : 0, p->nSimWords );
 }
-static inline int Cec3_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
+static inline int Cec3_ObjSimEqual( Gia_Man_t * p, Gia_SimKer_t * pKer, int iObj0, int iObj1 )
 {
-    int w;
     word * pSim0 = Cec3_ObjSim( p, iObj0 );
     word * pSim1 = Cec3_ObjSim( p, iObj1 );
-    if ( (pSim0[0] & 1) == (pSim1[0] & 1) )
-    {
-        for ( w = 0; w < p->nSimWords; w++ )
-            if ( pSim0[w] != pSim1[w] )
-                return 0;
-        return 1;
-    }
-    else
-    {
-        for ( w = 0; w < p->nSimWords; w++ )
-            if ( pSim0[w] != ~pSim1[w] )
-                return 0;
-        return 1;
-    }
+    return pKer->pFuncEqual( pSim0, pSim1, ((pSim0[0] ^ pSim1[0]) & 1) ? ~(word)0 : 0, p->nSimWords );
 }
 static inline void Cec3_ObjSimCi( Gia_Man_t * p, int iObj )
 {
@@ -468,14 +468,14 @@ Abc_Cex_t * Cec3_ManDeriveCex( Gia_Man_t * p, int iOut, int iPat )
             Abc_InfoSetBit( pCex->pData, i );
     return pCex;
 }
-int Cec3_ManSimulateCos( Gia_Man_t * p )
+int Cec3_ManSimulateCos( Gia_Man_t * p, Cec3_Man_t * pMan )
 {
     int i, Id;
     // check outputs and generate CEX if they fail
     Gia_ManForEachCoId( p, Id, i )
     {
         Cec3_ObjSimCo( p, Id );
-        if ( Cec3_ObjSimEqual(p, Id, 0) )
+        if ( Cec3_ObjSimEqual(p, pMan->pKer, Id, 0) )
             continue;
         p->pCexSeq = Cec3_ManDeriveCex( p, i, Abc_TtFindFirstBit2(Cec3_ObjSim(p, Id), p->nSimWords) );
         return 0;
@@ -492,13 +492,20 @@ void Cec3_ManSaveCis( Gia_Man_t * p )
 }
 int Cec3_ManSimulate( Gia_Man_t * p, Vec_Int_t * vTriples, Cec3_Man_t * pMan )
 {
-    extern void Cec3_ManSimClassRefineOne( Gia_Man_t * p, int iRepr );
+    extern void Cec3_ManSimClassRefineOne( Gia_Man_t * p, Gia_SimKer_t * pKer, int iRepr );
     abctime clk = Abc_Clock();
-    Gia_Obj_t * pObj; 
     int i, iRepr, iObj, Entry, Count = 0;
     //Cec3_ManSaveCis( p );
-    Gia_ManForEachAnd( p, pObj, i )
-        Cec3_ObjSimAnd( p, i );
+    if ( vTriples && pMan->vSimChanged ) // only the CEX patterns were added
+        pMan->nSimEvals += Gia_ManSimEventPropagate( p, pMan->pKer, pMan->vFanouts, pMan->vSimChanged, pMan->vSimMarks );
+    else
+    {
+        pMan->pKer->pFuncAnds( p, Vec_WrdArray(p->vSims), p->nSimWords );
+        pMan->nSimEvals += Gia_ManAndNum(p);
+        if ( pMan->vSimChanged )
+            Vec_IntClear( pMan->vSimChanged );
+    }
+    pMan->nSimEvalsFull += Gia_ManAndNum(p);
     pMan->timeSim += Abc_Clock() - clk;
     if ( p->pReprs == NULL )
         return 0;
@@ -519,7 +526,7 @@ int Cec3_ManSimulate( Gia_Man_t * p, Vec_Int_t * vTriples, Cec3_Man_t * pMan )
     }
     clk = Abc_Clock();
     Gia_ManForEachClass0( p, i )
-        Cec3_ManSimClassRefineOne( p, i );
+        Cec3_ManSimClassRefineOne( p, pMan->pKer, i );
     pMan->timeRefine += Abc_Clock() - clk;
     return Count;
 }
@@ -544,21 +551,9 @@ void Cec3_ManSimAlloc( Gia_Man_t * p, int nWords )
   SeeAlso     []
 
 ***********************************************************************/
-int Cec3_ManSimHashKey( word * pSim, int nSims, int nTableSize )
+int Cec3_ManSimHashKey( Gia_SimKer_t * pKer, word * pSim, int nSims, int nTableSize )
 {
-    static int s_Primes[16] = { 
-        1291, 1699, 1999, 2357, 2953, 3313, 3907, 4177, 
-        4831, 5147, 5647, 6343, 6899, 7103, 7873, 8147 };
-    unsigned uHash = 0, * pSimU = (unsigned *)pSim;
-    int i, nSimsU = 2 * nSims;
-    if ( pSimU[0] & 1 )
-        for ( i = 0; i < nSimsU; i++ )
-            uHash ^= ~pSimU[i] * s_Primes[i & 0xf];
-    else
-        for ( i = 0; i < nSimsU; i++ )
-            uHash ^= pSimU[i] * s_Primes[i & 0xf];
-    return (int)(uHash % nTableSize);
-
+    return (int)(pKer->pFuncHash( pSim, nSims ) % nTableSize);
 }
 
 /**Function*************************************************************
@@ -572,11 +567,11 @@ int Cec3_ManSimHashKey( word * pSim, int nSims, int nTableSize )
   SeeAlso     []
 
 ***********************************************************************/
-void Cec3_ManSimClassRefineOne( Gia_Man_t * p, int iRepr )
+void Cec3_ManSimClassRefineOne( Gia_Man_t * p, Gia_SimKer_t * pKer, int iRepr )
 {
     int iObj, iPrev = iRepr, iPrev2, iRepr2;
     Gia_ClassForEachObj1( p, iRepr, iRepr2 )
-        if ( Cec3_ObjSimEqual(p, iRepr, iRepr2) )
+        if ( Cec3_ObjSimEqual(p, pKer, iRepr, iRepr2) )
             iPrev = iRepr2;
         else
             break;
@@ -589,7 +584,7 @@ void Cec3_ManSimClassRefineOne( Gia_Man_t * p, int iRepr )
     iPrev2 = iRepr2;
     for ( iObj = Gia_ObjNext(p, iRepr2); iObj > 0; iObj = Gia_ObjNext(p, iObj) )
     {
-        if ( Cec3_ObjSimEqual(p, iRepr, iObj) ) // remains with iRepr
+        if ( Cec3_ObjSimEqual(p, pKer, iRepr, iObj) ) // remains with iRepr
         {
             Gia_ObjSetNext( p, iPrev, iObj );
             iPrev = iObj;
@@ -623,7 +618,7 @@ void Cec3_ManCreateClasses( Gia_Man_t * p, Cec3_Man_t * pMan )
         p->pReprs[i].iRepr = GIA_VOID;
         if ( Gia_ObjIsCo(pObj) )
             continue;
-        Key = Cec3_ManSimHashKey( Cec3_ObjSim(p, i), nWords, nTableSize );
+        Key = Cec3_ManSimHashKey( pMan->pKer, Cec3_ObjSim(p, i), nWords, nTableSize );
         assert( Key >= 0 && Key < nTableSize );
         if ( pTable[Key] == -1 )
             pTable[Key] = i;
@@ -642,7 +637,7 @@ void Cec3_ManCreateClasses( Gia_Man_t * p, Cec3_Man_t * pMan )
     ABC_FREE( pTable );
     clk = Abc_Clock();
     Gia_ManForEachClass0( p, i )
-        Cec3_ManSimClassRefineOne( p, i );
+        Cec3_ManSimClassRefineOne( p, pMan->pKer, i );
     pMan->timeRefine += Abc_Clock() - clk;
 }
 
@@ -666,7 +661,7 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     //assert( Gia_ManRegNum(pAig) == 0 );
     p = ABC_CALLOC( Cec3_Man_t, 1 );
     memset( p, 0, sizeof(Cec3_Man_t) );
-    p->timeStart    = Abc_Clock();
+    p->timeStart    = pPars->nProcNum > 1 ? Abc_ClockWall() : Abc_Clock();
     p->pPars        = pPars;
     p->pAig         = pAig;
     // create new manager
@@ -686,6 +681,19 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     p->vSatVars     = Vec_IntAlloc( 100 );
     p->vObjSatPairs = Vec_IntAlloc( 100 );
     p->vCexTriples  = Vec_IntAlloc( 100 );
+    p->vCexPairs    = Vec_IntAlloc( 100 );
+    p->pKer         = Gia_SimKernelGet();
+    if ( pPars->fEventSim )
+    {
+        p->vFanouts    = Vec_WecStart( Gia_ManObjNum(pAig) );
+        p->vSimChanged = Vec_IntAlloc( 100 );
+        p->vSimMarks   = Vec_BitStart( Gia_ManObjNum(pAig) );
+        Gia_ManForEachAnd( pAig, pObj, i )
+        {
+            Vec_WecPush( p->vFanouts, Gia_ObjFaninId0(pObj, i), i );
+            Vec_WecPush( p->vFanouts, Gia_ObjFaninId1(pObj, i), i );
+        }
+    }
     //Pars.conf_limit = pPars->nConfLimit;
     //satoko_configure(p->pSat, &Pars);
     // remember pointer to the solver in the AIG manager
@@ -696,7 +704,7 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
 {
     if ( p->pPars->fVerbose ) 
     {
-        abctime timeTotal = Abc_Clock() - p->timeStart;
+        abctime timeTotal = (p->pPars->nProcNum > 1 ? Abc_ClockWall() : Abc_Clock()) - p->timeStart;
         abctime timeSat   = p->timeSatSat + p->timeSatUnsat + p->timeSatUndec;
         abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeExtra;
 //        Abc_Print( 1, "%d\n", p->Num );
@@ -709,6 +717,10 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
         ABC_PRTP( "Rollback   ", p->timeExtra,     timeTotal );
         ABC_PRTP( "Other      ", timeOther,        timeTotal );
         ABC_PRTP( "TOTAL      ", timeTotal,        timeTotal );
+        if ( p->pPars->fEventSim )
+            Abc_Print( 1, "Resimulation: Node evals = %.0f. Without events = %.0f. Saved = %.2f %%.\n", 
+                (double)p->nSimEvals, (double)p->nSimEvalsFull, 
+                p->nSimEvalsFull ? 100.0 * ((double)p->nSimEvalsFull - (double)p->nSimEvals) / p->nSimEvalsFull : 0.0 );
         fflush( stdout );
     }
 
@@ -723,6 +735,10 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     Vec_IntFreeP( &p->vSatVars );
     Vec_IntFreeP( &p->vObjSatPairs );
     Vec_IntFreeP( &p->vCexTriples );
+    Vec_IntFreeP( &p->vCexPairs );
+    Vec_WecFreeP( &p->vFanouts );
+    Vec_IntFreeP( &p->vSimChanged );
+    Vec_BitFreeP( &p->vSimMarks );
     ABC_FREE( p );
 }
 
@@ -858,24 +874,45 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
     return status;
 }
 
-int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+int Cec3_ManSweepNodeSolve( Cec3_Man_t * p, int iObj, Vec_Int_t * vCexPairs, abctime * pTime )
 {
     abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, RetValue = 1;
+    int i, IdAig, IdSat, status;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     status = Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl );
+    Vec_IntClear( vCexPairs );
+    if ( status == GLUCOSE_SAT )
+        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
+//            Vec_IntPushTwo( vCexPairs, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
+            Vec_IntPushTwo( vCexPairs, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
+    *pTime = Abc_Clock() - clk;
+    if ( p->pPars->fUseCones )
+        return status;
+    clk = Abc_Clock();
+    bmcg_sat_solver_reset( p->pSat );
+    p->timeExtra += Abc_Clock() - clk;
+//    satoko_stats(p->pSat)->n_conflicts = 0;
+    return status;
+}
+int Cec3_ManSweepNodeUpdate( Cec3_Man_t * p, int iObj, int status, Vec_Int_t * vCexPairs, abctime Time )
+{
+    abctime clk = Abc_Clock();
+    int i, IdAig, Value, RetValue = 1;
+    Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
+    int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     if ( status == GLUCOSE_SAT )
     {
         p->nSatSat++;
         p->nPatterns++;
         p->pAig->iPatsPi = (p->pAig->iPatsPi == 64 * p->pAig->nSimWords - 1) ? 1 : p->pAig->iPatsPi + 1;
         assert( p->pAig->iPatsPi > 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords );
-        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
-//            Cec3_ObjSimSetInputBit( p->pAig, IdAig, satoko_var_polarity(p->pSat, IdSat) == SATOKO_LIT_TRUE );
-            Cec3_ObjSimSetInputBit( p->pAig, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
-        p->timeSatSat += Abc_Clock() - clk;
+        Vec_IntForEachEntryDouble( vCexPairs, IdAig, Value, i )
+            if ( Cec3_ObjSimSetInputBit( p->pAig, IdAig, Value ) && p->vSimChanged )
+                Vec_IntPush( p->vSimChanged, IdAig );
+        p->timeSatSat += Time + Abc_Clock() - clk;
         RetValue = 0;
     }
     else if ( status == GLUCOSE_UNSAT )
@@ -883,7 +920,7 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         p->nSatUnsat++;
         pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
         Gia_ObjSetProved( p->pAig, iObj );
-        p->timeSatUnsat += Abc_Clock() - clk;
+        p->timeSatUnsat += Time + Abc_Clock() - clk;
         RetValue = 1;
     }
     else 
@@ -891,17 +928,333 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
         p->nSatUndec++;
         assert( status == GLUCOSE_UNDEC );
         Gia_ObjSetFailed( p->pAig, iObj );
-        p->timeSatUndec += Abc_Clock() - clk;
+        p->timeSatUndec += Time + Abc_Clock() - clk;
         RetValue = 2;
     }
-    if ( p->pPars->fUseCones )
-        return RetValue;
-    clk = Abc_Clock();
-    bmcg_sat_solver_reset( p->pSat );
-    p->timeExtra += Abc_Clock() - clk;
-//    satoko_stats(p->pSat)->n_conflicts = 0;
     return RetValue;
 }
+int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
+{
+    abctime Time;
+    int status = Cec3_ManSweepNodeSolve( p, iObj, p->vCexPairs, &Time );
+    return Cec3_ManSweepNodeUpdate( p, iObj, status, p->vCexPairs, Time );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the node and commits the result of its SAT call.]
+
+  Description [These are shared by the sequential and the multi-threaded 
+  sweeping. Cec3_ManSweepNodeDup() adds the node to the new AIG and returns
+  1 if it should be checked against its representative. Cec3_ManSweepNodeCommit()
+  takes the value returned by Cec3_ManSweepNodeUpdate() and returns 1 if 
+  the node was disproved, in which case the CEX triple is recorded.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec3_ManSweepNodeDup( Cec3_Man_t * pMan, int iObj )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj ), * pRepr, * pObjNew; 
+    assert( !Gia_ObjProved(p, iObj) && !Gia_ObjFailed(p, iObj) );
+    // duplicate the node
+    pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    if ( Vec_IntSize(&pMan->pNew->vCopies2) == Abc_Lit2Var(pObj->Value) )
+    {
+        pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
+        pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
+        Gia_ObjSetPhase( pMan->pNew, pObjNew );
+        Vec_IntPush( &pMan->pNew->vCopies2, -1 );
+    }
+    assert( Vec_IntSize(&pMan->pNew->vCopies2) == Gia_ManObjNum(pMan->pNew) );
+    pRepr = Gia_ObjReprObj( p, iObj );
+    if ( pRepr == NULL || !~pRepr->Value )
+        return 0;
+    if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
+    {
+        assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
+        Gia_ObjSetProved( p, iObj );
+        return 0;
+    }
+    return 1;
+}
+static inline int Cec3_ManSweepNodeCommit( Cec3_Man_t * pMan, int iObj, int RetValue )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj  = Gia_ManObj( p, iObj );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p, iObj );
+    if ( RetValue )
+    {
+        if ( Gia_ObjProved(p, iObj) )
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+        return 0;
+    }
+    pObj->Value = ~0;
+    Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), iObj, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
+    return 1;
+}
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of sweeping using several threads.]
+
+  Description [The main thread visits the nodes in the topological order 
+  and derives the candidate pairs in the same way as the sequential 
+  sweeping does. A batch of candidates is collected until a node depends 
+  on the outcome of a pending candidate (through a fanin or through its 
+  representative). The candidates of the batch are solved concurrently. 
+  Each thread has its own SAT solver and its own CNF mapping of the 
+  internal AIG. The results are committed by the main thread in the 
+  topological order: the counter-examples are added to the simulation 
+  patterns and the proved nodes are merged with their representatives. 
+  Without logic cones (switch -k), the result does not depend on the 
+  number of threads and is the same as that of the sequential sweeping.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec3_ManPar_t_ Cec3_ManPar_t;
+struct Cec3_ManPar_t_
+{
+    Cec3_Man_t *     pMan;           // sweeping manager
+    Cec3_Man_t *     pViews[CEC3_PROC_MAX]; // solving managers (one per thread)
+    Vec_Int_t *      vBatch;         // the candidate nodes of the current batch
+    Vec_Int_t *      vStamps;        // the batch of each candidate node
+    Vec_Int_t *      vStatus;        // the SAT status of each candidate
+    Vec_Wec_t *      vCexes;         // the counter-example of each candidate
+    abctime          pTimes[CEC3_PAR_BATCH]; // the runtime of each candidate
+    int              Stamp;          // the current batch
+    int              iNext;          // the next node to be considered
+    int              iCand;          // the next candidate to be solved
+    int              fDisproved;     // some candidates were disproved
+    int              nThreads;       // the number of threads
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // the barrier after each step
+    pthread_cond_t   Cond;
+#endif
+    int              nWaiting;       // the number of threads waiting at the barrier
+    int              Phase;          // the number of barriers passed
+};
+static void Cec3_ManParBarrier( Cec3_ManPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int Phase;
+    pthread_mutex_lock( &p->Mutex );
+    Phase = p->Phase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->Phase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+        while ( Phase == p->Phase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+static int Cec3_ManParFetch( Cec3_ManPar_t * p )
+{
+    int iCand;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+    iCand = p->iCand++;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+    return iCand;
+}
+// updates the shallow copy of the internal AIG used by one thread,
+// while keeping the SAT variables and traversal IDs of this thread
+static void Cec3_ManParSyncView( Cec3_Man_t * pView, Gia_Man_t * pNew )
+{
+    Gia_Man_t * pGia = pView->pNew;
+    Vec_Int_t vCopies2 = pGia->vCopies2;
+    int * pTravIds = pGia->pTravIds;
+    int nTravIds = pGia->nTravIds, nTravIdsAlloc = pGia->nTravIdsAlloc;
+    memcpy( pGia, pNew, sizeof(Gia_Man_t) );
+    pGia->vCopies2      = vCopies2;
+    pGia->pTravIds      = pTravIds;
+    pGia->nTravIds      = nTravIds;
+    pGia->nTravIdsAlloc = nTravIdsAlloc;
+    Vec_IntFillExtra( &pGia->vCopies2, Gia_ManObjNum(pNew), -1 );
+}
+static Cec3_Man_t * Cec3_ManParViewStart( Cec3_Man_t * pMan )
+{
+    Cec3_Man_t * p = ABC_ALLOC( Cec3_Man_t, 1 );
+    memcpy( p, pMan, sizeof(Cec3_Man_t) );
+    p->pNew         = ABC_CALLOC( Gia_Man_t, 1 );
+    p->pSat         = bmcg_sat_solver_start();
+    p->vFrontier    = Vec_PtrAlloc( 1000 );
+    p->vFanins      = Vec_PtrAlloc( 100 );
+    p->vNodesNew    = Vec_IntAlloc( 100 );
+    p->vSatVars     = Vec_IntAlloc( 100 );
+    p->vObjSatPairs = Vec_IntAlloc( 100 );
+    p->vCexTriples  = NULL;
+    p->vCexPairs    = NULL;
+    p->vSimChanged  = NULL;
+    p->timeExtra    = 0;
+    return p;
+}
+static void Cec3_ManParViewStop( Cec3_Man_t * p )
+{
+    Vec_IntErase( &p->pNew->vCopies2 );
+    ABC_FREE( p->pNew->pTravIds );
+    ABC_FREE( p->pNew );
+    bmcg_sat_solver_stop( p->pSat );
+    Vec_PtrFree( p->vFrontier );
+    Vec_PtrFree( p->vFanins );
+    Vec_IntFree( p->vNodesNew );
+    Vec_IntFree( p->vSatVars );
+    Vec_IntFree( p->vObjSatPairs );
+    ABC_FREE( p );
+}
+Cec3_ManPar_t * Cec3_ManParStart( Cec3_Man_t * pMan )
+{
+    Cec3_ManPar_t * p = ABC_CALLOC( Cec3_ManPar_t, 1 );
+    int i;
+    p->pMan     = pMan;
+    p->nThreads = Abc_MinInt( pMan->pPars->nProcNum, CEC3_PROC_MAX );
+#ifndef ABC_USE_PTHREADS
+    p->nThreads = 1;
+#endif
+    p->vBatch   = Vec_IntAlloc( CEC3_PAR_BATCH );
+    p->vStamps  = Vec_IntStartFull( Gia_ManObjNum(pMan->pAig) );
+    p->vStatus  = Vec_IntStart( CEC3_PAR_BATCH );
+    p->vCexes   = Vec_WecStart( CEC3_PAR_BATCH );
+    for ( i = 0; i < p->nThreads; i++ )
+        p->pViews[i] = Cec3_ManParViewStart( pMan );
+    return p;
+}
+void Cec3_ManParStop( Cec3_ManPar_t * p )
+{
+    int i;
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        p->pMan->timeExtra += p->pViews[i]->timeExtra;
+        Cec3_ManParViewStop( p->pViews[i] );
+    }
+    Vec_IntFree( p->vBatch );
+    Vec_IntFree( p->vStamps );
+    Vec_IntFree( p->vStatus );
+    Vec_WecFree( p->vCexes );
+    ABC_FREE( p );
+}
+static void Cec3_ManParCollect( Cec3_ManPar_t * p )
+{
+    Cec3_Man_t * pMan = p->pMan;
+    Gia_Man_t * pAig = pMan->pAig;
+    Gia_Obj_t * pObj;
+    int i, iRepr;
+    Vec_IntClear( p->vBatch );
+    p->iCand = 0;
+    p->Stamp++;
+    for ( ; p->iNext < Gia_ManObjNum(pAig) && Vec_IntSize(p->vBatch) < CEC3_PAR_BATCH; p->iNext++ )
+    {
+        i = p->iNext;
+        pObj = Gia_ManObj( pAig, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        if ( ~pObj->Value || Gia_ObjFailed(pAig, i) ) // skip swept nodes and failed nodes
+            continue;
+        // stop if the node depends on a pending candidate
+        iRepr = Gia_ObjRepr( pAig, i );
+        if ( Vec_IntEntry(p->vStamps, Gia_ObjFaninId0(pObj, i)) == p->Stamp || 
+             Vec_IntEntry(p->vStamps, Gia_ObjFaninId1(pObj, i)) == p->Stamp || 
+             (iRepr != GIA_VOID && Vec_IntEntry(p->vStamps, iRepr) == p->Stamp) )
+            break;
+        if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
+            continue;
+        if ( !Cec3_ManSweepNodeDup(pMan, i) )
+            continue;
+        Vec_IntWriteEntry( p->vStamps, i, p->Stamp );
+        Vec_IntPush( p->vBatch, i );
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+        Cec3_ManParSyncView( p->pViews[i], pMan->pNew );
+}
+static void Cec3_ManParSolve( Cec3_ManPar_t * p, int iThread )
+{
+    Cec3_Man_t * pView = p->pViews[iThread];
+    int k, Status;
+    while ( (k = Cec3_ManParFetch(p)) < Vec_IntSize(p->vBatch) )
+    {
+        Status = Cec3_ManSweepNodeSolve( pView, Vec_IntEntry(p->vBatch, k), Vec_WecEntry(p->vCexes, k), p->pTimes + k );
+        Vec_IntWriteEntry( p->vStatus, k, Status );
+    }
+}
+static void Cec3_ManParCommit( Cec3_ManPar_t * p )
+{
+    Cec3_Man_t * pMan = p->pMan;
+    int k, i;
+    Vec_IntForEachEntry( p->vBatch, i, k )
+        if ( Cec3_ManSweepNodeCommit(pMan, i, Cec3_ManSweepNodeUpdate(pMan, i, Vec_IntEntry(p->vStatus, k), Vec_WecEntry(p->vCexes, k), p->pTimes[k])) )
+            p->fDisproved = 1;
+}
+static void Cec3_ManParProcess( Cec3_ManPar_t * p, int iThread )
+{
+    while ( 1 )
+    {
+        if ( iThread == 0 )
+            Cec3_ManParCollect( p );
+        Cec3_ManParBarrier( p );
+        if ( Vec_IntSize(p->vBatch) == 0 )
+            break;
+        Cec3_ManParSolve( p, iThread );
+        Cec3_ManParBarrier( p );
+        if ( iThread == 0 )
+            Cec3_ManParCommit( p );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+typedef struct Cec3_ManThr_t_ Cec3_ManThr_t;
+struct Cec3_ManThr_t_
+{
+    Cec3_ManPar_t *  p;
+    int              iThread;
+};
+static void * Cec3_ManParWorkerThread( void * pArg )
+{
+    Cec3_ManThr_t * pThData = (Cec3_ManThr_t *)pArg;
+    Cec3_ManParProcess( pThData->p, pThData->iThread );
+    return NULL;
+}
+#endif
+int Cec3_ManSweepPar( Cec3_ManPar_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[CEC3_PROC_MAX];
+    Cec3_ManThr_t ThData[CEC3_PROC_MAX];
+    int i, status;
+#endif
+    p->iNext      = 0;
+    p->fDisproved = 0;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].iThread = i;
+        status = pthread_create( WorkerThread + i, NULL, Cec3_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+#else
+    Cec3_ManParProcess( p, 0 );
+#endif
+    return p->fDisproved;
+}
+
 void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 {
     if ( !pPars->fVerbose )
@@ -911,10 +1264,29 @@ void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
     printf( "F =%5d ", pMan ? pMan->nSatUndec : 0 );
     Gia_ManEquivPrintClasses( p, pPars->fVeryVerbose, 0 );
 }
+int Cec3_ManSweep( Cec3_Man_t * pMan )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj; 
+    int i, fDisproved = 0;
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
+            continue;
+        if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
+            continue;
+        if ( !Cec3_ManSweepNodeDup(pMan, i) )
+            continue;
+        if ( Cec3_ManSweepNodeCommit(pMan, i, Cec3_ManSweepNode(pMan, i)) )
+            fDisproved = 1;
+    }
+    return fDisproved;
+}
 int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppNew )
 {
     Cec3_Man_t * pMan = Cec3_ManCreate( p, pPars ); 
-    Gia_Obj_t * pObj, * pRepr, * pObjNew; 
+    Cec3_ManPar_t * pPar = NULL;
+    Gia_Obj_t * pObj; 
     int i, Iter, fDisproved = 1;
 
     // check if any output trivially fails under all-0 pattern
@@ -934,7 +1306,7 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
     Cec3_ManSimAlloc( p, pPars->nSimWords );
     Cec3_ManSimulateCis( p );
     Cec3_ManSimulate( p, NULL, pMan );
-    if ( pPars->fIsMiter && !Cec3_ManSimulateCos(p) ) // cex detected
+    if ( pPars->fIsMiter && !Cec3_ManSimulateCos(p, pMan) ) // cex detected
         goto finalize;
     Cec3_ManCreateClasses( p, pMan );
     Cec3_ManPrintStats( p, pPars, pMan );
@@ -944,60 +1316,33 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
     {
         Cec3_ManSimulateCis( p );
         Cec3_ManSimulate( p, NULL, pMan );
-        if ( pPars->fIsMiter && !Cec3_ManSimulateCos(p) ) // cex detected
+        if ( pPars->fIsMiter && !Cec3_ManSimulateCos(p, pMan) ) // cex detected
             goto finalize;
         Cec3_ManPrintStats( p, pPars, pMan );
     }
     // perform sweeping
     //pMan = Cec3_ManCreate( p, pPars );
+    if ( pPars->nProcNum > 1 )
+        pPar = Cec3_ManParStart( pMan );
     for ( Iter = 0; fDisproved && Iter < pPars->nItersMax; Iter++ )
     {
-        fDisproved = 0;
         pMan->nPatterns = 0;
-        Cec3_ManSimulateCis( p );
+        // with event-driven resimulation, no new random patterns are added in the sweeping 
+        // rounds: the CEX patterns overwrite the info of the last round, starting from the 
+        // first pattern, while the remaining patterns keep refining the classes as before;
+        // drawing new random words would change every CI and make each resimulation full
+        if ( pPars->fEventSim )
+            p->iPatsPi = 0;
+        else
+            Cec3_ManSimulateCis( p );
         Vec_IntClear( pMan->vCexTriples );
-        Gia_ManForEachAnd( p, pObj, i )
-        {
-            if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
-                continue;
-            if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
-                continue;
-            assert( !Gia_ObjProved(p, i) && !Gia_ObjFailed(p, i) );
-            // duplicate the node
-            pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
-            if ( Vec_IntSize(&pMan->pNew->vCopies2) == Abc_Lit2Var(pObj->Value) )
-            {
-                pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
-                pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
-                Gia_ObjSetPhase( pMan->pNew, pObjNew );
-                Vec_IntPush( &pMan->pNew->vCopies2, -1 );
-            }
-            assert( Vec_IntSize(&pMan->pNew->vCopies2) == Gia_ManObjNum(pMan->pNew) );
-            pRepr = Gia_ObjReprObj( p, i );
-            if ( pRepr == NULL || !~pRepr->Value )
-                continue;
-            if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
-            {
-                assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
-                Gia_ObjSetProved( p, i );
-                continue;
-            }
-            if ( Cec3_ManSweepNode(pMan, i) )
-            {
-                if ( Gia_ObjProved(p, i) )
-                    pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
-                continue;
-            }
-            pObj->Value = ~0;
-            Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), i, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
-            fDisproved = 1;
-        }
+        fDisproved = pPar ? Cec3_ManSweepPar( pPar ) : Cec3_ManSweep( pMan );
         if ( fDisproved )
         {
             int Fails = Cec3_ManSimulate( p, pMan->vCexTriples, pMan );
             if ( Fails && pPars->fVerbose )
                 printf( "Failed to resimulate %d times with pattern = %d  (total = %d).\n", Fails, pMan->nPatterns, pPars->nSimWords * 64 );
-            if ( pPars->fIsMiter && !Cec3_ManSimulateCos(p) ) // cex detected
+            if ( pPars->fIsMiter && !Cec3_ManSimulateCos(p, pMan) ) // cex detected
                 break;
         }
         Cec3_ManPrintStats( p, pPars, pMan );
@@ -1015,6 +1360,8 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
         (*ppNew)->pSpec = Abc_UtilStrsav( p->pSpec );
     }
 finalize:
+    if ( pPar )
+        Cec3_ManParStop( pPar );
     Cec3_ManDestroy( pMan );
     //Gia_ManEquivPrintClasses( p, 1, 0 );
     return p->pCexSeq ? 0 : 1;
@@ -1031,6 +1378,8 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
 //    pPars->nItersMax  = pPars0->nItersMax;  // max number of iterations
     pPars->nConfLimit = pPars0->nBTLimit;   // conflict limit at a node
     pPars->fUseCones  = pPars0->fUseCones;
+    pPars->nProcNum   = pPars0->nProcNum;
+    pPars->fEventSim  = pPars0->fEventSim;
     pPars->fVerbose   = pPars0->fVerbose;
 //    Gia_ManComputeGiaEquivs( p, 100000, 0 );
 //    Gia_ManEquivPrintClasses( p, 1, 0 );
@@ -53,6 +53,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Fra_Par_t_   Fra_Par_t;
 typedef struct Fra_Ssw_t_   Fra_Ssw_t;
 typedef struct Fra_Sec_t_   Fra_Sec_t;
+typedef struct Fra_Pfo_t_   Fra_Pfo_t;
 typedef struct Fra_Man_t_   Fra_Man_t;
 typedef struct Fra_Cla_t_   Fra_Cla_t;
 typedef struct Fra_Sml_t_   Fra_Sml_t;
@@ -146,6 +147,25 @@ struct Fra_Sec_t_
     int              fReportSolution;   // enables report solution in a special form
 };
 
+// portfolio parameters
+struct Fra_Pfo_t_
+{
+    int              fUsePdr;           // enables PDR
+    int              fUseBmc;           // enables BMC
+    int              fUseInt;           // enables interpolation
+    int              fUseGla;           // enables gate-level abstraction
+    int              TimeLimit;         // the global timeout (wall-clock seconds)
+    int              TimePdr;           // the timeout of PDR (seconds)
+    int              TimeBmc;           // the timeout of BMC (seconds)
+    int              TimeInt;           // the timeout of interpolation (seconds)
+    int              TimeGla;           // the timeout of abstraction (seconds)
+    int              fVerbose;          // enables verbose reporting of statistics
+    // the results
+    int              Status;            // the result (1 = proved; 0 = failed; -1 = undecided)
+    int              iEngine;           // the engine that produced the result
+    int              iFrame;            // the last frame without a counter-example
+};
+
 // FRAIG equivalence classes
 struct Fra_Cla_t_
 {
@@ -351,6 +371,10 @@ extern Aig_Man_t *         Fra_ManPrepareComb( Fra_Man_t * p );
 extern void                Fra_ManFinalizeComb( Fra_Man_t * p );
 extern void                Fra_ManStop( Fra_Man_t * p );
 extern void                Fra_ManPrint( Fra_Man_t * p );
+/*=== fraPfolio.c =====================================================*/
+extern void                Fra_PfoSetDefaultParams( Fra_Pfo_t * p );
+extern char *              Fra_PfoEngineName( int iEngine );
+extern int                 Fra_PfoPerform( Aig_Man_t * pAig, Fra_Pfo_t * pPars, Abc_Cex_t ** ppCex );
 /*=== fraSat.c ========================================================*/
 extern int                 Fra_NodesAreEquiv( Fra_Man_t * p, Aig_Obj_t * pOld, Aig_Obj_t * pNew );
 extern int                 Fra_NodesAreImp( Fra_Man_t * p, Aig_Obj_t * pOld, Aig_Obj_t * pNew, int fComplL, int fComplR );
@@ -0,0 +1,451 @@
+/**CFile****************************************************************
+
+  FileName    [fraPfolio.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [New FRAIG package.]
+
+  Synopsis    [Portfolio of property checkers running concurrently.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: fraPfolio.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "fra.h"
+#include "aig/saig/saig.h"
+#include "aig/gia/giaAig.h"
+#include "proof/pdr/pdr.h"
+#include "proof/int/int.h"
+#include "proof/abs/abs.h"
+#include "sat/bmc/bmc.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the engines of the portfolio
+enum { FRA_PFO_PDR = 0, FRA_PFO_BMC, FRA_PFO_INT, FRA_PFO_GLA, FRA_PFO_NUM };
+
+static char * s_PfoNames[FRA_PFO_NUM] = { "pdr", "bmc3", "int", "&gla" };
+
+// information given to the thread
+typedef struct Fra_PfoThr_t_ Fra_PfoThr_t;
+struct Fra_PfoThr_t_
+{
+    void *          pMan;       // the shared manager
+    int             iEngine;    // the engine to run
+    Aig_Man_t *     pAig;       // the private copy of the AIG
+    int             nTimeOut;   // the runtime budget of this engine
+    int             RetValue;   // the result (1 = proved; 0 = failed; -1 = undecided)
+    int             iFrame;     // the frame reached by this engine
+    Abc_Cex_t *     pCex;       // the counter-example
+    abctime         Time;       // the runtime of this engine
+};
+
+// the number of the last portfolio instance; engines of older instances stop
+static volatile int g_nPfoRunIds = 0;
+
+// call back procedure for the engines
+int Fra_PfoCallBackToStop( int RunId ) { assert( RunId <= g_nPfoRunIds ); return RunId < g_nPfoRunIds; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Sets default parameters of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fra_PfoSetDefaultParams( Fra_Pfo_t * p )
+{
+    memset( p, 0, sizeof(Fra_Pfo_t) );
+    p->fUsePdr    =  1;  // enables PDR
+    p->fUseBmc    =  1;  // enables BMC
+    p->fUseInt    =  1;  // enables interpolation
+    p->fUseGla    =  1;  // enables gate-level abstraction
+    p->TimeLimit  =  0;  // the global timeout
+    p->TimePdr    =  0;  // the timeout of PDR
+    p->TimeBmc    =  0;  // the timeout of BMC
+    p->TimeInt    =  0;  // the timeout of interpolation
+    p->TimeGla    =  0;  // the timeout of abstraction
+    p->fVerbose   =  0;  // verbose output
+    p->Status     = -1;  // the result
+    p->iEngine    = -1;  // the engine that produced the result
+    p->iFrame     = -1;  // the last frame without a counter-example
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the engine.]
+
+  Description [The engine is given by its number, as in Fra_Pfo_t::iEngine.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Fra_PfoEngineName( int iEngine )
+{
+    assert( iEngine >= 0 && iEngine < FRA_PFO_NUM );
+    return s_PfoNames[iEngine];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine of the portfolio.]
+
+  Description [The engine stops when the callback reports that this run
+  has been cancelled, or when its own runtime budget is exhausted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fra_PfoRunEngine( Fra_PfoThr_t * pThr, int RunId )
+{
+    abctime clk = Abc_Clock();
+    Aig_Man_t * pAig = pThr->pAig;
+    pThr->RetValue = -1;
+    pThr->iFrame   = -1;
+    if ( pThr->iEngine == FRA_PFO_PDR )
+    {
+        Pdr_Par_t Pars, * pPars = &Pars;
+        Pdr_ManSetDefaultParams( pPars );
+        pPars->fSilent    = 1;
+        pPars->nTimeOut   = pThr->nTimeOut;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Fra_PfoCallBackToStop;
+        pThr->RetValue    = Pdr_ManSolve( pAig, pPars );
+        pThr->iFrame      = pPars->iFrame;
+        pThr->pCex        = pAig->pSeqModel; pAig->pSeqModel = NULL;
+    }
+    else if ( pThr->iEngine == FRA_PFO_BMC )
+    {
+        Saig_ParBmc_t Pars, * pPars = &Pars;
+        Saig_ParBmcSetDefaultParams( pPars );
+        pPars->fSilent    = 1;
+        pPars->nTimeOut   = pThr->nTimeOut;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Fra_PfoCallBackToStop;
+        pThr->RetValue    = Saig_ManBmcScalable( pAig, pPars );
+        pThr->iFrame      = pPars->iFrame;
+        pThr->pCex        = pAig->pSeqModel; pAig->pSeqModel = NULL;
+    }
+    else if ( pThr->iEngine == FRA_PFO_INT )
+    {
+        Inter_ManParams_t Pars, * pPars = &Pars;
+        int iFrame = -1;
+        Inter_ManSetDefaultParams( pPars );
+        pPars->nSecLimit  = pThr->nTimeOut;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Fra_PfoCallBackToStop;
+        pThr->RetValue    = Inter_ManPerformInterpolation( pAig, pPars, &iFrame );
+        pThr->pCex        = pAig->pSeqModel; pAig->pSeqModel = NULL;
+    }
+    else if ( pThr->iEngine == FRA_PFO_GLA )
+    {
+        Abs_Par_t Pars, * pPars = &Pars;
+        Gia_Man_t * pGia  = Gia_ManFromAigSimple( pAig );
+        Abs_ParSetDefaults( pPars );
+        pPars->nTimeOut   = pThr->nTimeOut;
+        pPars->RunId      = RunId;
+        pPars->pFuncStop  = Fra_PfoCallBackToStop;
+        pThr->RetValue    = Gia_ManPerformGla( pGia, pPars );
+        pThr->iFrame      = pPars->iFrame;
+        pThr->pCex        = pGia->pCexSeq; pGia->pCexSeq = NULL;
+        Gia_ManStop( pGia );
+    }
+    else assert( 0 );
+    // discard the result if it was not definitive or cannot be trusted
+    if ( pThr->RetValue == 0 && pThr->pCex && !Saig_ManVerifyCex( pAig, pThr->pCex ) )
+    {
+        Abc_Print( 1, "Portfolio: Counter-example produced by %s is not valid.\n", s_PfoNames[pThr->iEngine] );
+        Abc_CexFreeP( &pThr->pCex );
+        pThr->RetValue = -1;
+    }
+    if ( pThr->RetValue != 0 )
+        Abc_CexFreeP( &pThr->pCex );
+    pThr->Time = Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the threads data for the selected engines.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_PfoPrepare( Aig_Man_t * pAig, Fra_Pfo_t * pPars, Fra_PfoThr_t * pThrs )
+{
+    int fUse[FRA_PFO_NUM], Time[FRA_PFO_NUM], i, nThrs = 0;
+    fUse[FRA_PFO_PDR] = pPars->fUsePdr;
+    fUse[FRA_PFO_BMC] = pPars->fUseBmc;
+    // interpolation and abstraction work on one property at a time
+    fUse[FRA_PFO_INT] = pPars->fUseInt && Saig_ManPoNum(pAig) == 1 && Saig_ManPiNum(pAig) > 0 && Saig_ManConstrNum(pAig) == 0;
+    fUse[FRA_PFO_GLA] = pPars->fUseGla && Saig_ManPoNum(pAig) == 1 && Saig_ManPiNum(pAig) > 0 && Saig_ManConstrNum(pAig) == 0;
+    Time[FRA_PFO_PDR] = pPars->TimePdr;
+    Time[FRA_PFO_BMC] = pPars->TimeBmc;
+    Time[FRA_PFO_INT] = pPars->TimeInt;
+    Time[FRA_PFO_GLA] = pPars->TimeGla;
+    for ( i = 0; i < FRA_PFO_NUM; i++ )
+    {
+        if ( !fUse[i] )
+        {
+            if ( pPars->fVerbose && ((i == FRA_PFO_INT && pPars->fUseInt) || (i == FRA_PFO_GLA && pPars->fUseGla)) )
+                Abc_Print( 1, "Portfolio: Skipping %s, which requires one property, some inputs, and no constraints.\n", s_PfoNames[i] );
+            continue;
+        }
+        memset( pThrs + nThrs, 0, sizeof(Fra_PfoThr_t) );
+        pThrs[nThrs].iEngine  = i;
+        pThrs[nThrs].pAig     = Aig_ManDupSimple( pAig );
+        pThrs[nThrs].nTimeOut = Time[i] ? Time[i] : pPars->TimeLimit;
+        if ( pPars->TimeLimit && pThrs[nThrs].nTimeOut > pPars->TimeLimit )
+            pThrs[nThrs].nTimeOut = pPars->TimeLimit;
+        pThrs[nThrs].RetValue = -1;
+        pThrs[nThrs].iFrame   = -1;
+        nThrs++;
+    }
+    return nThrs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the results of the engines.]
+
+  Description [The winner is the engine that first produced a definitive
+  answer. The bound is the largest frame without a counter-example reported
+  by the bounded engines.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fra_PfoCollect( Fra_Pfo_t * pPars, Fra_PfoThr_t * pThrs, int nThrs, int iWinner, Abc_Cex_t ** ppCex )
+{
+    int i;
+    for ( i = 0; i < nThrs; i++ )
+    {
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Portfolio: %-5s ", s_PfoNames[pThrs[i].iEngine] );
+            if ( pThrs[i].RetValue == 1 )
+                Abc_Print( 1, "proved the property.      " );
+            else if ( pThrs[i].RetValue == 0 )
+                Abc_Print( 1, "disproved the property.   " );
+            else
+                Abc_Print( 1, "was undecided.            " );
+            if ( pThrs[i].iFrame >= 0 )
+                Abc_Print( 1, "Frame = %5d.  ", pThrs[i].iFrame );
+            Abc_PrintTime( 1, "Time", pThrs[i].Time );
+        }
+        if ( pThrs[i].RetValue == -1 )
+            pPars->iFrame = Abc_MaxInt( pPars->iFrame, pThrs[i].iFrame );
+    }
+    if ( iWinner >= 0 )
+    {
+        pPars->Status  = pThrs[iWinner].RetValue;
+        pPars->iEngine = pThrs[iWinner].iEngine;
+        if ( pPars->Status == 0 && pThrs[iWinner].pCex )
+        {
+            pPars->iFrame = pThrs[iWinner].pCex->iFrame;
+            *ppCex = pThrs[iWinner].pCex;
+            pThrs[iWinner].pCex = NULL;
+        }
+    }
+    for ( i = 0; i < nThrs; i++ )
+    {
+        Abc_CexFreeP( &pThrs[i].pCex );
+        Aig_ManStop( pThrs[i].pAig );
+    }
+}
+
+#ifndef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the engines of the portfolio one after another.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_PfoPerform( Aig_Man_t * pAig, Fra_Pfo_t * pPars, Abc_Cex_t ** ppCex )
+{
+    Fra_PfoThr_t pThrs[FRA_PFO_NUM];
+    int i, nThrs, iWinner = -1;
+    *ppCex = NULL;
+    nThrs = Fra_PfoPrepare( pAig, pPars, pThrs );
+    for ( i = 0; i < nThrs; i++ )
+    {
+        Fra_PfoRunEngine( pThrs + i, g_nPfoRunIds );
+        if ( pThrs[i].RetValue != -1 )
+        {
+            iWinner = i;
+            break;
+        }
+    }
+    Fra_PfoCollect( pPars, pThrs, i < nThrs ? i + 1 : nThrs, iWinner, ppCex );
+    for ( i++; i < nThrs; i++ )
+        Aig_ManStop( pThrs[i].pAig );
+    return pPars->Status;
+}
+
+#else // pthreads are used
+
+// the shared manager of the portfolio
+typedef struct Fra_PfoMan_t_ Fra_PfoMan_t;
+struct Fra_PfoMan_t_
+{
+    pthread_mutex_t mutex;      // protects the fields below
+    pthread_cond_t  cond;       // signals that an engine has finished
+    int             RunId;      // the id of this run
+    int             nRunning;   // the number of engines still running
+    int             iWinner;    // the engine that produced the first answer
+    Fra_PfoThr_t *  pThrs;      // the engines
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine in a thread.]
+
+  Description [The first engine that produces a definitive answer becomes
+  the winner and cancels the other engines of this run.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Fra_PfoWorkerThread( void * pArg )
+{
+    Fra_PfoThr_t * pThr = (Fra_PfoThr_t *)pArg;
+    Fra_PfoMan_t * p = (Fra_PfoMan_t *)pThr->pMan;
+    int status;
+    Fra_PfoRunEngine( pThr, p->RunId );
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    if ( pThr->RetValue != -1 && p->iWinner == -1 && g_nPfoRunIds == p->RunId )
+    {
+        p->iWinner = pThr - p->pThrs;
+        g_nPfoRunIds++;
+    }
+    p->nRunning--;
+    status = pthread_cond_signal( &p->cond );  assert( status == 0 );
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the engines of the portfolio concurrently.]
+
+  Description [Returns 1 if the property is proved, 0 if it is disproved
+  (the counter-example is returned in ppCex), and -1 if undecided.
+  The global time limit is measured in wall-clock time; when it is reached,
+  the remaining engines are cancelled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_PfoPerform( Aig_Man_t * pAig, Fra_Pfo_t * pPars, Abc_Cex_t ** ppCex )
+{
+    Fra_PfoMan_t Man, * p = &Man;
+    Fra_PfoThr_t pThrs[FRA_PFO_NUM];
+    pthread_t WorkerThread[FRA_PFO_NUM];
+    struct timespec TimeStop;
+    abctime clk = Abc_ClockWall();
+    int i, nThrs, status, fTimeout = 0;
+    *ppCex = NULL;
+    nThrs = Fra_PfoPrepare( pAig, pPars, pThrs );
+    if ( nThrs == 0 )
+        return -1;
+    memset( p, 0, sizeof(Fra_PfoMan_t) );
+    status = pthread_mutex_init( &p->mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->cond, NULL );    assert( status == 0 );
+    p->pThrs    = pThrs;
+    p->nRunning = nThrs;
+    p->iWinner  = -1;
+    p->RunId    = g_nPfoRunIds;
+    for ( i = 0; i < nThrs; i++ )
+    {
+        pThrs[i].pMan = p;
+        status = pthread_create( WorkerThread + i, NULL, Fra_PfoWorkerThread, (void *)(pThrs + i) );  assert( status == 0 );
+    }
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Portfolio: Started %d engines.\n", nThrs );
+    // wait for the first answer, for all engines to finish, or for the timeout
+    TimeStop.tv_sec  = time(NULL) + pPars->TimeLimit;
+    TimeStop.tv_nsec = 0;
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    while ( p->nRunning > 0 && p->iWinner == -1 && !fTimeout )
+    {
+        if ( pPars->TimeLimit )
+            fTimeout = (pthread_cond_timedwait( &p->cond, &p->mutex, &TimeStop ) != 0 && p->nRunning > 0 && p->iWinner == -1);
+        else
+            status = pthread_cond_wait( &p->cond, &p->mutex );
+    }
+    // cancel the remaining engines of this run
+    if ( g_nPfoRunIds == p->RunId )
+        g_nPfoRunIds++;
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+    if ( fTimeout && pPars->fVerbose )
+        Abc_Print( 1, "Portfolio: Reached timeout (%d seconds).\n", pPars->TimeLimit );
+    for ( i = 0; i < nThrs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    pthread_cond_destroy( &p->cond );
+    pthread_mutex_destroy( &p->mutex );
+    Fra_PfoCollect( pPars, pThrs, nThrs, p->iWinner, ppCex );
+    if ( pPars->fVerbose )
+        Abc_PrintTime( 1, "Portfolio: Total wall time", Abc_ClockWall() - clk );
+    return pPars->Status;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
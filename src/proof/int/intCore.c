@@ -264,6 +264,11 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // cancelled
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation was cancelled.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
@@ -362,6 +367,15 @@ p->timeEqu += Abc_Clock() - clk - timeTemp;
                 Inter_CheckStop( pCheck );
                 return -1;
             }
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Interpolation was cancelled.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 1 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
             // save interpolant and convert it into CNF
             if ( pPars->fTransLoop )
             {
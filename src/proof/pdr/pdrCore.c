@@ -59,6 +59,8 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nProcs         =       1;  // the number of concurrent workers in the multi-output mode
+    pPars->nGenProcs      =       1;  // the number of threads used to generalize cubes
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -697,7 +699,7 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
         return -1;
     if ( RetValue == 0 )
     {
-        p->tGeneral += clock() - clk;
+        p->tGeneral += Abc_Clock() - clk;
         return 0;
     }
 
@@ -747,7 +749,18 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
 
         // sort literals by their occurences
         pOrder = Pdr_ManSortByPriority( p, pCubeMin );
+        // try removing literals concurrently
+        if ( p->pGen )
+        {
+            if ( Pdr_ManGeneralizePar( p, k, &pCubeMin ) == -1 )
+            {
+                Pdr_SetDeref( pCubeMin );
+                return -1;
+            }
+            pOrder = Pdr_ManSortByPriority( p, pCubeMin );
+        }
         // try removing literals
+        else
         for ( j = 0; j < pCubeMin->nLits; j++ )
         {
             // use ordering
@@ -1381,6 +1394,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        if ( p->pShare )
+            Pdr_ManShareImport( p, iFrame );
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
@@ -1406,6 +1421,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         }
         if ( RetValue )
         {
+            if ( p->pShare )
+                Pdr_ManShareExport( p );
             if ( p->pPars->fVerbose )
                 Pdr_ManPrintProgress( p, 1, Abc_Clock() - clkStart );
             if ( !p->pPars->fSilent )
@@ -1521,6 +1538,10 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
+    // solve the outputs separately only if each worker gets at most one of them;
+    // otherwise the joint run, which shares the frames among all outputs, is faster
+    if ( pPars->nProcs > 1 && Saig_ManPoNum(pAig) > 1 && Saig_ManPoNum(pAig) <= pPars->nProcs && !pPars->fUseBridge && !pPars->fDumpInv )
+        return Pdr_ManSolvePar( pAig, pPars );
     p = Pdr_ManStart( pAig, pPars, NULL );
 
     Pdr_Init_table_write_to_stats(p); // [@Michal]
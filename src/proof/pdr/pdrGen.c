@@ -0,0 +1,588 @@
+/**CFile****************************************************************
+
+  FileName    [pdrGen.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Cube generalization with concurrent literal-dropping checks.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: pdrGen.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the solvers of one thread
+typedef struct Pdr_GenThr_t_ Pdr_GenThr_t;
+struct Pdr_GenThr_t_
+{
+    Pdr_Gen_t *     pGen;       // the state of generalization
+    int             iThr;       // the number of this thread
+    Vec_Ptr_t *     vSolvers;   // the solver of each frame
+    Vec_Int_t *     vSynced;    // the number of logged clauses added to each solver
+    Vec_Int_t *     vActVars;   // the number of activation variables used in each solver
+    Vec_Int_t *     vProps;     // the property outputs are asserted in each solver
+    Vec_Int_t *     vLits;      // the clause of the candidate cube
+    Vec_Int_t *     vAssumps;   // the assumptions of the candidate cube
+};
+
+// one literal-dropping check
+typedef struct Pdr_GenJob_t_ Pdr_GenJob_t;
+struct Pdr_GenJob_t_
+{
+    Pdr_Set_t *     pCube;      // the cube with one literal dropped
+    Pdr_Set_t *     pCubeMin;   // the cube reduced using the final conflict
+    int             iLit;       // the position of the dropped literal
+    int             RetValue;   // 1 = inductive; 0 = not inductive; -1 = resource limit
+};
+
+// the state of concurrent generalization
+struct Pdr_Gen_t_
+{
+    Pdr_Man_t *     pMan;       // the PDR manager
+    Cnf_Dat_t *     pCnf;       // the monolithic CNF of the helper solvers
+    Vec_Int_t *     vVar2Reg;   // maps SAT variables of register inputs into registers
+    Vec_Vec_t *     vLogs;      // the clauses added to the solver of each frame
+    Vec_Int_t *     vFailed;    // the literals that cannot be dropped
+    Pdr_GenThr_t *  pThrs;      // the solvers of each thread
+    Pdr_GenJob_t *  pJobs;      // the checks of the current batch
+    int             nThreads;   // the number of threads
+    int             nJobs;      // the number of checks in the batch
+    int             iNextJob;   // the next check to be solved
+    int             nDone;      // the number of checks solved
+    int             Phase;      // the number of batches started
+    int             fExit;      // the threads should quit
+    int             k;          // the frame of the batch
+    abctime         TimeLeft;   // the runtime left for the batch
+    // statistics
+    int             nBatches;   // the number of batches
+    int             nChecks;    // the number of checks
+    int             nDropped;   // the number of literals dropped
+    abctime         timeWall;   // the wall-clock time of generalization
+#ifdef ABC_USE_PTHREADS
+    pthread_t *     pThreads;   // the helper threads
+    pthread_mutex_t mutex;      // protects the batch
+    pthread_cond_t  condStart;  // signals that a batch is started
+    pthread_cond_t  condDone;   // signals that a batch is finished
+#endif
+};
+
+static inline int Pdr_GenVarLo( Pdr_Gen_t * p, int iReg ) { return p->pCnf->pVarNums[Aig_ObjId(Saig_ManLo(p->pMan->pAig, iReg))]; }
+static inline int Pdr_GenVarLi( Pdr_Gen_t * p, int iReg ) { return p->pCnf->pVarNums[Aig_ObjId(Saig_ManLi(p->pMan->pAig, iReg))]; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the helper solver of the frame.]
+
+  Description [Creates the solver from the monolithic CNF when needed
+  and adds the clauses logged for this frame since the last call.
+  The helper solver may lag behind the solver of the manager, which
+  only weakens the frame and keeps the checks sound.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static sat_solver * Pdr_GenSolver( Pdr_Gen_t * p, Pdr_GenThr_t * pThr, int k )
+{
+    Pdr_Man_t * pMan = p->pMan;
+    sat_solver * pSat = (sat_solver *)Vec_PtrGetEntry( pThr->vSolvers, k );
+    Vec_Ptr_t * vLog;
+    Pdr_Set_t * pCla;
+    Aig_Obj_t * pObj;
+    int i, j, Lit, RetValue;
+    // recycle the solver
+    if ( pSat && Vec_IntEntry(pThr->vActVars, k) >= pMan->pPars->nRecycle )
+    {
+        sat_solver_delete( pSat );
+        pSat = NULL;
+    }
+    if ( pSat == NULL )
+    {
+        pSat = zsat_solver_new_seed( pMan->pPars->nRandomSeed );
+        pSat = (sat_solver *)Cnf_DataWriteIntoSolverInt( pSat, p->pCnf, 1, k == 0 );
+        assert( pSat != NULL );
+        sat_solver_set_runid( pSat, pMan->pPars->RunId );
+        sat_solver_set_stop_func( pSat, pMan->pPars->pFuncStop );
+        Vec_PtrSetEntry( pThr->vSolvers, k, pSat );
+        Vec_IntSetEntry( pThr->vSynced, k, 0 );
+        Vec_IntSetEntry( pThr->vActVars, k, 0 );
+        Vec_IntSetEntry( pThr->vProps, k, 0 );
+    }
+    // assert the property outputs in the frames below the last one
+    if ( pMan->pPars->fUsePropOut && !Vec_IntEntry(pThr->vProps, k) && k < Vec_PtrSize(pMan->vSolvers) - 1 )
+    {
+        Saig_ManForEachPo( pMan->pAig, pObj, i )
+        {
+            // skip solved outputs
+            if ( pMan->vCexes && Vec_PtrEntry(pMan->vCexes, i) )
+                continue;
+            // skip timedout outputs
+            if ( pMan->pPars->vOutMap && Vec_IntEntry(pMan->pPars->vOutMap, i) == -1 )
+                continue;
+            Lit = Abc_Var2Lit( p->pCnf->pVarNums[Aig_ObjId(pObj)], 1 );
+            RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+            assert( RetValue == 1 );
+        }
+        Vec_IntWriteEntry( pThr->vProps, k, 1 );
+    }
+    // add the new clauses of the frame
+    if ( k < Vec_VecSize(p->vLogs) )
+    {
+        vLog = Vec_VecEntry( p->vLogs, k );
+        Vec_PtrForEachEntryStart( Pdr_Set_t *, vLog, pCla, i, Vec_IntEntry(pThr->vSynced, k) )
+        {
+            Vec_IntClear( pThr->vLits );
+            for ( j = 0; j < pCla->nLits; j++ )
+                Vec_IntPush( pThr->vLits, Abc_Var2Lit(Pdr_GenVarLo(p, Abc_Lit2Var(pCla->Lits[j])), !Abc_LitIsCompl(pCla->Lits[j])) );
+            RetValue = sat_solver_addclause( pSat, Vec_IntArray(pThr->vLits), Vec_IntLimit(pThr->vLits) );
+            assert( RetValue == 1 );
+        }
+        Vec_IntWriteEntry( pThr->vSynced, k, Vec_PtrSize(vLog) );
+    }
+    return pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks whether the candidate cube is inductive relative to the frame.]
+
+  Description [Mirrors Pdr_ManCheckCube() with an activation literal,
+  followed by the reduction of Pdr_ManReduceClause() when the cube
+  is inductive.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_GenSolveJob( Pdr_Gen_t * p, Pdr_GenThr_t * pThr, Pdr_GenJob_t * pJob )
+{
+    Pdr_Par_t * pPars = p->pMan->pPars;
+    Pdr_Set_t * pCube = pJob->pCube;
+    sat_solver * pSat = Pdr_GenSolver( p, pThr, p->k );
+    int i, Lit, iVarAct, RegId, nCoreLits, * pCoreLits, RetValue;
+    // add the clause of the cube with an activation literal
+    iVarAct = sat_solver_nvars( pSat );
+    sat_solver_setnvars( pSat, iVarAct + 1 );
+    Vec_IntAddToEntry( pThr->vActVars, p->k, 1 );
+    Vec_IntClear( pThr->vLits );
+    Vec_IntClear( pThr->vAssumps );
+    for ( i = 0; i < pCube->nLits; i++ )
+    {
+        Lit = pCube->Lits[i];
+        Vec_IntPush( pThr->vLits,    Abc_Var2Lit(Pdr_GenVarLo(p, Abc_Lit2Var(Lit)), !Abc_LitIsCompl(Lit)) );
+        Vec_IntPush( pThr->vAssumps, Abc_Var2Lit(Pdr_GenVarLi(p, Abc_Lit2Var(Lit)),  Abc_LitIsCompl(Lit)) );
+    }
+    Vec_IntPush( pThr->vLits,    Abc_Var2Lit(iVarAct, 0) );
+    Vec_IntPush( pThr->vAssumps, Abc_Var2Lit(iVarAct, 1) );
+    RetValue = sat_solver_addclause( pSat, Vec_IntArray(pThr->vLits), Vec_IntLimit(pThr->vLits) );
+    assert( RetValue == 1 );
+    // solve
+    sat_solver_set_runtime_limit( pSat, p->TimeLeft ? Abc_Clock() + p->TimeLeft : 0 );
+    RetValue = sat_solver_solve( pSat, Vec_IntArray(pThr->vAssumps), Vec_IntLimit(pThr->vAssumps), pPars->nConfGenLimit, 0, 0, 0 );
+    sat_solver_set_runtime_limit( pSat, 0 );
+    if ( RetValue == l_Undef )
+        pJob->RetValue = pPars->nConfGenLimit ? 0 : -1;
+    else if ( RetValue == l_True )
+        pJob->RetValue = 0;
+    else
+    {
+        pJob->RetValue = 1;
+        // translate the final conflict into register literals
+        nCoreLits = sat_solver_final( pSat, &pCoreLits );
+        Vec_IntClear( pThr->vLits );
+        for ( i = 0; i < nCoreLits; i++ )
+        {
+            RegId = Abc_Lit2Var(pCoreLits[i]) < Vec_IntSize(p->vVar2Reg) ? Vec_IntEntry( p->vVar2Reg, Abc_Lit2Var(pCoreLits[i]) ) : -1;
+            if ( RegId >= 0 )
+                Vec_IntPush( pThr->vLits, Abc_Var2Lit(RegId, !Abc_LitIsCompl(pCoreLits[i])) );
+        }
+        if ( Vec_IntSize(pThr->vLits) < pCube->nLits )
+        {
+            // if the cube overlaps with init, add any literal
+            Vec_IntForEachEntry( pThr->vLits, Lit, i )
+                if ( !Abc_LitIsCompl(Lit) )
+                    break;
+            if ( i == Vec_IntSize(pThr->vLits) )
+            {
+                for ( i = 0; i < pCube->nLits; i++ )
+                    if ( !Abc_LitIsCompl(pCube->Lits[i]) )
+                        break;
+                assert( i < pCube->nLits );
+                Vec_IntPush( pThr->vLits, pCube->Lits[i] );
+            }
+            pJob->pCubeMin = Pdr_SetCreateSubset( pCube, Vec_IntArray(pThr->vLits), Vec_IntSize(pThr->vLits) );
+            assert( !Pdr_SetIsInit(pJob->pCubeMin, -1) );
+        }
+        else
+            pJob->pCubeMin = Pdr_SetDup( pCube );
+    }
+    // disable the clause of the cube
+    Lit = Abc_Var2Lit( iVarAct, 0 );
+    RetValue = sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+    assert( RetValue == 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the checks of the current batch.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+static void Pdr_GenProcessJobs( Pdr_Gen_t * p, int iThr )
+{
+    int status, iJob;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+        iJob = p->iNextJob < p->nJobs ? p->iNextJob++ : -1;
+        status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+        if ( iJob == -1 )
+            break;
+        Pdr_GenSolveJob( p, p->pThrs + iThr, p->pJobs + iJob );
+        status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+        if ( ++p->nDone == p->nJobs )
+        {
+            status = pthread_cond_signal( &p->condDone );  assert( status == 0 );
+        }
+        status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+    }
+}
+static void * Pdr_GenWorkerThread( void * pArg )
+{
+    Pdr_GenThr_t * pThr = (Pdr_GenThr_t *)pArg;
+    Pdr_Gen_t * p = pThr->pGen;
+    int status, Phase = 0;
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    while ( 1 )
+    {
+        while ( Phase == p->Phase && !p->fExit )
+        {
+            status = pthread_cond_wait( &p->condStart, &p->mutex );  assert( status == 0 );
+        }
+        if ( p->fExit )
+            break;
+        Phase = p->Phase;
+        status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+        Pdr_GenProcessJobs( p, pThr->iThr );
+        status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    }
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+static void Pdr_GenRunBatch( Pdr_Gen_t * p )
+{
+    int status;
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    p->iNextJob = p->nDone = 0;
+    p->Phase++;
+    status = pthread_cond_broadcast( &p->condStart );  assert( status == 0 );
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+    // the calling thread takes part in the batch
+    Pdr_GenProcessJobs( p, 0 );
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    while ( p->nDone < p->nJobs )
+    {
+        status = pthread_cond_wait( &p->condDone, &p->mutex );  assert( status == 0 );
+    }
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+}
+
+#else
+
+static void Pdr_GenRunBatch( Pdr_Gen_t * p )
+{
+    for ( p->iNextJob = 0; p->iNextJob < p->nJobs; p->iNextJob++ )
+        Pdr_GenSolveJob( p, p->pThrs, p->pJobs + p->iNextJob );
+    p->nDone = p->nJobs;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Starts concurrent generalization.]
+
+  Description [The helper solvers share one monolithic CNF of the
+  transition relation, which is derived here by the calling thread
+  and only read afterwards. Without pthreads, the checks of each
+  batch are solved one after another.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Gen_t * Pdr_GenStart( Pdr_Man_t * pMan, int nThreads )
+{
+    Pdr_Gen_t * p;
+    Cnf_Man_t * pCnfMan;
+    Aig_Obj_t * pObj;
+    int i, nRegs;
+    assert( nThreads > 1 );
+    p = ABC_CALLOC( Pdr_Gen_t, 1 );
+    p->pMan     = pMan;
+    p->nThreads = nThreads;
+    // derive the CNF with the variables for all combinational outputs
+    pCnfMan = Cnf_ManStart();
+    nRegs = pMan->pAig->nRegs;
+    pMan->pAig->nRegs = Aig_ManCoNum(pMan->pAig);
+    p->pCnf = Cnf_DeriveWithMan( pCnfMan, pMan->pAig, Aig_ManCoNum(pMan->pAig) );
+    pMan->pAig->nRegs = nRegs;
+    Cnf_ManStop( pCnfMan );
+    p->vVar2Reg = Vec_IntStartFull( p->pCnf->nVars );
+    Saig_ManForEachLi( pMan->pAig, pObj, i )
+        Vec_IntWriteEntry( p->vVar2Reg, p->pCnf->pVarNums[Aig_ObjId(pObj)], i );
+    p->vLogs    = Vec_VecAlloc( 16 );
+    p->vFailed  = Vec_IntAlloc( 16 );
+    p->pJobs    = ABC_CALLOC( Pdr_GenJob_t, nThreads );
+    p->pThrs    = ABC_CALLOC( Pdr_GenThr_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        p->pThrs[i].pGen     = p;
+        p->pThrs[i].iThr     = i;
+        p->pThrs[i].vSolvers = Vec_PtrAlloc( 16 );
+        p->pThrs[i].vSynced  = Vec_IntAlloc( 16 );
+        p->pThrs[i].vActVars = Vec_IntAlloc( 16 );
+        p->pThrs[i].vProps   = Vec_IntAlloc( 16 );
+        p->pThrs[i].vLits    = Vec_IntAlloc( 100 );
+        p->pThrs[i].vAssumps = Vec_IntAlloc( 100 );
+    }
+#ifdef ABC_USE_PTHREADS
+    {
+        int status;
+        status = pthread_mutex_init( &p->mutex, NULL );      assert( status == 0 );
+        status = pthread_cond_init( &p->condStart, NULL );   assert( status == 0 );
+        status = pthread_cond_init( &p->condDone, NULL );    assert( status == 0 );
+        p->pThreads = ABC_ALLOC( pthread_t, nThreads );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_create( p->pThreads + i, NULL, Pdr_GenWorkerThread, (void *)(p->pThrs + i) );  assert( status == 0 );
+        }
+    }
+#endif
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops concurrent generalization.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_GenStop( Pdr_Gen_t * p, int fVerbose )
+{
+    Pdr_Set_t * pCla;
+    sat_solver * pSat;
+    int i, k;
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Generalization with %d threads:  Batch =%6d  Check =%7d  Dropped =%7d  ", p->nThreads, p->nBatches, p->nChecks, p->nDropped );
+        Abc_PrintTime( 1, "Wall", p->timeWall );
+    }
+#ifdef ABC_USE_PTHREADS
+    {
+        int status;
+        status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+        p->fExit = 1;
+        status = pthread_cond_broadcast( &p->condStart );  assert( status == 0 );
+        status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+        for ( i = 1; i < p->nThreads; i++ )
+        {
+            status = pthread_join( p->pThreads[i], NULL );  assert( status == 0 );
+        }
+        pthread_cond_destroy( &p->condDone );
+        pthread_cond_destroy( &p->condStart );
+        pthread_mutex_destroy( &p->mutex );
+        ABC_FREE( p->pThreads );
+    }
+#endif
+    for ( i = 0; i < p->nThreads; i++ )
+    {
+        Vec_PtrForEachEntry( sat_solver *, p->pThrs[i].vSolvers, pSat, k )
+            if ( pSat )
+                sat_solver_delete( pSat );
+        Vec_PtrFree( p->pThrs[i].vSolvers );
+        Vec_IntFree( p->pThrs[i].vSynced );
+        Vec_IntFree( p->pThrs[i].vActVars );
+        Vec_IntFree( p->pThrs[i].vProps );
+        Vec_IntFree( p->pThrs[i].vLits );
+        Vec_IntFree( p->pThrs[i].vAssumps );
+    }
+    Vec_VecForEachEntry( Pdr_Set_t *, p->vLogs, pCla, i, k )
+        Pdr_SetDeref( pCla );
+    Vec_VecFree( p->vLogs );
+    Vec_IntFree( p->vFailed );
+    Vec_IntFree( p->vVar2Reg );
+    Cnf_DataFree( p->pCnf );
+    ABC_FREE( p->pThrs );
+    ABC_FREE( p->pJobs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the clause added to the solver of the frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_GenLogClause( Pdr_Gen_t * p, int k, Pdr_Set_t * pCube )
+{
+    Vec_VecPush( p->vLogs, k, Pdr_SetRef(pCube) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Drops literals of the cube using concurrent checks.]
+
+  Description [Each batch tries to drop the next literals in the order
+  of priority, one literal per thread. Among the inductive candidates,
+  the smallest reduced cube replaces the current one; the literals
+  that cannot be dropped are not tried again. Returns -1 if a resource
+  limit is reached; the current cube is returned in any case. The runtime
+  limits of the manager are measured in the CPU time of the main thread,
+  so the time it waits for the helpers is charged to them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManGeneralizePar( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCubeMin )
+{
+    Pdr_Gen_t * pGen = p->pGen;
+    Pdr_Set_t * pCubeMin = *ppCubeMin;
+    Pdr_GenJob_t * pJob;
+    abctime Limit, clkWait, clk = Abc_ClockWall();
+    int * pOrder, i, j, iBest, RetValue = 1;
+    Vec_IntClear( pGen->vFailed );
+    while ( RetValue == 1 )
+    {
+        // collect the literals to be dropped
+        pOrder = Pdr_ManSortByPriority( p, pCubeMin );
+        pGen->nJobs = 0;
+        for ( j = 0; j < pCubeMin->nLits && pGen->nJobs < pGen->nThreads; j++ )
+        {
+            i = pOrder[j];
+            if ( Vec_IntFind(pGen->vFailed, pCubeMin->Lits[i]) >= 0 )
+                continue;
+            // check init state
+            if ( Pdr_SetIsInit(pCubeMin, i) )
+                continue;
+            pJob = pGen->pJobs + pGen->nJobs++;
+            pJob->pCube    = Pdr_SetCreateFrom( pCubeMin, i );
+            pJob->pCubeMin = NULL;
+            pJob->iLit     = i;
+            pJob->RetValue = -1;
+        }
+        if ( pGen->nJobs == 0 )
+            break;
+        // solve the batch
+        Limit = Pdr_ManTimeLimit( p );
+        pGen->TimeLeft = !Limit ? 0 : Limit > Abc_Clock() ? Limit - Abc_Clock() : 1;
+        pGen->k = k;
+        clkWait = Abc_ClockWall() - Abc_Clock();
+        Pdr_GenRunBatch( pGen );
+        clkWait = Abc_ClockWall() - Abc_Clock() - clkWait;
+        if ( clkWait > 0 && p->timeToStop )
+            p->timeToStop = p->timeToStop > clkWait ? p->timeToStop - clkWait : 1;
+        if ( clkWait > 0 && p->timeToStopOne )
+            p->timeToStopOne = p->timeToStopOne > clkWait ? p->timeToStopOne - clkWait : 1;
+        pGen->nBatches++;
+        pGen->nChecks += pGen->nJobs;
+        p->nCalls += pGen->nJobs;
+        // select the smallest inductive cube
+        iBest = -1;
+        for ( j = 0; j < pGen->nJobs; j++ )
+        {
+            pJob = pGen->pJobs + j;
+            if ( pJob->RetValue == -1 )
+                RetValue = -1;
+            else if ( pJob->RetValue == 0 )
+            {
+                Vec_IntPush( pGen->vFailed, pCubeMin->Lits[pJob->iLit] );
+                p->nCallsS++;
+            }
+            else
+            {
+                if ( iBest == -1 || pJob->pCubeMin->nLits < pGen->pJobs[iBest].pCubeMin->nLits )
+                    iBest = j;
+                p->nCallsU++;
+            }
+        }
+        if ( RetValue == 1 && iBest >= 0 )
+        {
+            pGen->nDropped += pCubeMin->nLits - pGen->pJobs[iBest].pCubeMin->nLits;
+            Pdr_SetDeref( pCubeMin );
+            pCubeMin = Pdr_SetRef( pGen->pJobs[iBest].pCubeMin );
+            assert( pCubeMin->nLits > 0 );
+        }
+        for ( j = 0; j < pGen->nJobs; j++ )
+        {
+            pJob = pGen->pJobs + j;
+            Pdr_SetDeref( pJob->pCube );
+            if ( pJob->pCubeMin )
+                Pdr_SetDeref( pJob->pCubeMin );
+        }
+    }
+    *ppCubeMin = pCubeMin;
+    pGen->timeWall += Abc_ClockWall() - clk;
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
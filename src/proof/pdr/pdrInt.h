@@ -68,6 +68,8 @@ typedef struct Txs3_Man_t_ Txs3_Man_t;
 typedef struct Pdr_Set_t_ Pdr_Set_t;
 typedef struct Pdr_Obl_t_ Pdr_Obl_t;
 typedef struct Pdr_Man_t_ Pdr_Man_t;
+typedef struct Pdr_Shr_t_ Pdr_Shr_t;
+typedef struct Pdr_Gen_t_ Pdr_Gen_t;
 // [@Michal] Additional data structures typedef
 typedef struct Pdr_ListNodePred_ Pdr_ListNodePred;
 typedef struct Pdr_POGNode_ Pdr_POGNode;
@@ -143,6 +145,9 @@ struct Pdr_Man_t_
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    Pdr_Shr_t * pShare;    // lemmas shared by the concurrent workers
+    int         nShared;   // the number of shared lemmas already imported
+    Pdr_Gen_t * pGen;      // the solvers of concurrent generalization
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -236,8 +241,18 @@ extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k
 // endregion
 // region === pdrCore.c ==========================================================
 extern Pdr_Set_t *             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int                     Pdr_ManSolveInt( Pdr_Man_t * p );
+extern int *                   Pdr_ManSortByPriority( Pdr_Man_t * p, Pdr_Set_t * pCube );
+// endregion
+// region === pdrGen.c ==========================================================
+extern Pdr_Gen_t *     Pdr_GenStart( Pdr_Man_t * pMan, int nThreads );
+extern void            Pdr_GenStop( Pdr_Gen_t * p, int fVerbose );
+extern void            Pdr_GenLogClause( Pdr_Gen_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManGeneralizePar( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCubeMin );
 // endregion
 // region === pdrInv.c ==========================================================
+extern int             Pdr_ManFindInvariantStart( Pdr_Man_t * p );
+extern Vec_Ptr_t *     Pdr_ManCollectCubes( Pdr_Man_t * p, int kStart );
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
 extern void            Pdr_ManPrintClauses( Pdr_Man_t * p, int kStart );
@@ -253,6 +268,11 @@ extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
 // endregion
+// region === pdrPar.c ==========================================================
+extern void            Pdr_ManShareImport( Pdr_Man_t * p, int k );
+extern void            Pdr_ManShareExport( Pdr_Man_t * p );
+extern int             Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars );
+// endregion
 // region === pdrSat.c ==========================================================
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
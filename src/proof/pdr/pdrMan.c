@@ -303,6 +303,9 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
         p->pPars->vOutMap = Vec_IntAlloc( Saig_ManPoNum(pAig) );
         Vec_IntFill( p->pPars->vOutMap, Saig_ManPoNum(pAig), -2 );
     }
+    // concurrent generalization applies to the default literal dropping
+    if ( pPars->nGenProcs > 1 && pPars->fSkipDown && !pPars->fSimpleGeneral && !pPars->fSkipGeneral )
+        p->pGen = Pdr_GenStart( p, pPars->nGenProcs );
     return p;
 }
 
@@ -340,6 +343,8 @@ void Pdr_ManStop( Pdr_Man_t * p )
         ABC_PRTP( "TOTAL      ", p->tTotal,     p->tTotal );
         fflush( stdout );
     }
+    if ( p->pGen )
+        Pdr_GenStop( p->pGen, p->pPars->fVerbose );
 //    Abc_Print( 1, "SS =%6d. SU =%6d. US =%6d. UU =%6d.\n", p->nCasesSS, p->nCasesSU, p->nCasesUS, p->nCasesUU );
     Vec_PtrForEachEntry( sat_solver *, p->vSolvers, pSat, i )
         sat_solver_delete( pSat );
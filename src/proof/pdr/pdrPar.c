@@ -0,0 +1,549 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-output PDR with concurrent workers sharing lemmas.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: pdrPar.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the state shared by the workers solving the outputs of one problem
+struct Pdr_Shr_t_
+{
+    Aig_Man_t *     pAig;       // the multi-output problem
+    Pdr_Par_t *     pPars;      // the parameters of the run
+    Vec_Int_t *     vStatus;    // the status of each output (1 = proved; 0 = failed; -1 = undecided; -2 = unknown)
+    Vec_Ptr_t *     vCexes;     // the counter-examples of failed outputs (with "-a")
+    Vec_Ptr_t *     vLemmas;    // the clauses holding in all reachable states
+    Abc_Cex_t *     pCex;       // the first counter-example (without "-a")
+    int             iNextOut;   // the next output to be solved
+    int             iFrame;     // the largest frame reached
+    int             iFrameCex;  // the frame where the first counter-example was found
+    int             nExported;  // the number of lemmas exported
+    int             nImported;  // the number of lemmas imported
+    int             fStop;      // the run is cancelled
+    int             RunId;      // the id of this run
+    abctime         clkStart;   // the wall-clock time of the start
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t mutex;      // protects the fields above
+    pthread_cond_t  cond;       // signals that a worker has finished
+    int             nRunning;   // the number of running workers
+#endif
+};
+
+// the number of the last run; workers of older runs stop
+static volatile int g_nPdrParRunIds = 0;
+
+// call back procedure for the workers
+int Pdr_ParCallBackToStop( int RunId ) { assert( RunId <= g_nPdrParRunIds ); return RunId < g_nPdrParRunIds; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Locking of the shared state.]
+
+  Description [Does nothing when the workers run sequentially.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Pdr_ShrLock( Pdr_Shr_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status;
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+#endif
+}
+static inline void Pdr_ShrUnlock( Pdr_Shr_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status;
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cancels the run.]
+
+  Description [Should be called with the shared state locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Pdr_ShrStop( Pdr_Shr_t * p )
+{
+    p->fStop = 1;
+    if ( g_nPdrParRunIds == p->RunId )
+        g_nPdrParRunIds++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the new shared lemmas to the frames of the manager.]
+
+  Description [The lemmas hold in all reachable states. They are added
+  to the clauses of the last frame k and to the solvers of frames 1..k,
+  and are later pushed and subsumed like the clauses derived locally.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareImport( Pdr_Man_t * p, int k )
+{
+    Pdr_Shr_t * pShr = p->pShare;
+    Vec_Ptr_t * vNew = NULL;
+    Pdr_Set_t * pCube;
+    int i, j;
+    Pdr_ShrLock( pShr );
+    if ( p->nShared < Vec_PtrSize(pShr->vLemmas) )
+    {
+        vNew = Vec_PtrAlloc( Vec_PtrSize(pShr->vLemmas) - p->nShared );
+        Vec_PtrForEachEntryStart( Pdr_Set_t *, pShr->vLemmas, pCube, i, p->nShared )
+            Vec_PtrPush( vNew, Pdr_SetDup(pCube) );
+        p->nShared = Vec_PtrSize(pShr->vLemmas);
+        pShr->nImported += Vec_PtrSize(vNew);
+    }
+    Pdr_ShrUnlock( pShr );
+    if ( vNew == NULL )
+        return;
+    Vec_PtrForEachEntry( Pdr_Set_t *, vNew, pCube, i )
+    {
+        Vec_VecPush( p->vClauses, k, pCube );
+        for ( j = 1; j <= k; j++ )
+            Pdr_ManSolverAddClause( p, j, pCube );
+    }
+    Vec_PtrFree( vNew );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the inductive invariant of the manager.]
+
+  Description [The clauses of the invariant hold in all reachable states
+  and are therefore valid for all outputs. Clauses subsumed by a lemma
+  already in the store are skipped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareExport( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShr = p->pShare;
+    Vec_Ptr_t * vCubes = Pdr_ManCollectCubes( p, Pdr_ManFindInvariantStart(p) );
+    Pdr_Set_t * pCube, * pLemma;
+    int i, k, nLemmas;
+    Pdr_ShrLock( pShr );
+    nLemmas = Vec_PtrSize(pShr->vLemmas);
+    Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+    {
+        Vec_PtrForEachEntryStop( Pdr_Set_t *, pShr->vLemmas, pLemma, k, nLemmas )
+            if ( Pdr_SetContains( pCube, pLemma ) )
+                break;
+        if ( k < nLemmas )
+            continue;
+        Vec_PtrPush( pShr->vLemmas, Pdr_SetDup(pCube) );
+        pShr->nExported++;
+    }
+    Pdr_ShrUnlock( pShr );
+    Vec_PtrFree( vCubes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the invariant from the shared lemmas.]
+
+  Description [When all outputs are proved, the lemmas are the conjunction
+  of their inductive invariants, which is itself inductive. The result
+  has the format of Pdr_ManDeriveInfinityClauses().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Pdr_ShrDeriveInvariant( Pdr_Shr_t * p )
+{
+    Vec_Int_t * vResult = Vec_IntAlloc( 1000 );
+    Pdr_Set_t * pCube;
+    int i, v;
+    Vec_IntPush( vResult, Vec_PtrSize(p->vLemmas) );
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLemmas, pCube, i )
+    {
+        Vec_IntPush( vResult, pCube->nLits );
+        for ( v = 0; v < pCube->nLits; v++ )
+            Vec_IntPush( vResult, pCube->Lits[v] );
+    }
+    Vec_IntPush( vResult, Aig_ManRegNum(p->pAig) );
+    return vResult;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the next output to be solved or -1.]
+
+  Description [Outputs driven by constant 0 are marked as proved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Pdr_ShrNextOutput( Pdr_Shr_t * p )
+{
+    int iOut = -1;
+    Pdr_ShrLock( p );
+    while ( !p->fStop && p->iNextOut < Saig_ManPoNum(p->pAig) )
+    {
+        Aig_Obj_t * pObj = Aig_ManCo( p->pAig, p->iNextOut++ );
+        if ( Aig_ObjChild0(pObj) != Aig_ManConst0(p->pAig) )
+        {
+            iOut = p->iNextOut - 1;
+            break;
+        }
+        Vec_IntWriteEntry( p->vStatus, p->iNextOut - 1, 1 );
+        p->pPars->nProveOuts++;
+    }
+    Pdr_ShrUnlock( p );
+    return iOut;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output.]
+
+  Description [The output is extracted together with all registers, so
+  that the flop numbering and hence the shared lemmas are the same for
+  all outputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ShrSolveOutput( Pdr_Shr_t * p, int iOut )
+{
+    Pdr_Par_t Pars, * pPars = &Pars;
+    Pdr_Man_t * pMan;
+    Aig_Man_t * pAig;
+    Abc_Cex_t * pCex = NULL;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(p->pAig) );
+    int RetValue, iFrame, nTimeLeft = 0;
+    Pdr_ShrLock( p );
+    pAig = Aig_ManDupOneOutput( p->pAig, iOut, 1 );
+    *pPars = *p->pPars;
+    if ( p->pPars->nTimeOut )
+        nTimeLeft = Abc_MaxInt( 1, p->pPars->nTimeOut - (int)((Abc_ClockWall() - p->clkStart) / CLOCKS_PER_SEC) );
+    Pdr_ShrUnlock( p );
+    Aig_ManSetRegNum( pAig, Aig_ManRegNum(pAig) ); // sets the CI/CO numbers used by PDR
+    ABC_FREE( pAig->pName ); // the workers do not write the run statistics
+    pPars->nTimeOut     = nTimeLeft;
+    if ( p->pPars->nTimeOutOne )
+        pPars->nTimeOut = Abc_MinInt( nTimeLeft ? nTimeLeft : ABC_INFINITY, Abc_MaxInt(1, (p->pPars->nTimeOutOne + 999) / 1000) );
+    pPars->nTimeOutOne  = 0;
+    pPars->fSolveAll    = 0;
+    pPars->fStoreCex    = 0;
+    pPars->fDumpInv     = 0;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->nFailOuts    = 0;
+    pPars->nDropOuts    = 0;
+    pPars->nProveOuts   = 0;
+    pPars->vOutMap      = NULL;
+    pPars->pFuncOnFail  = NULL;
+#ifdef ABC_USE_PTHREADS
+    pPars->RunId        = p->RunId;
+    pPars->pFuncStop    = Pdr_ParCallBackToStop;
+#endif
+    pMan = Pdr_ManStart( pAig, pPars, NULL );
+    pMan->pShare = p;
+    RetValue = Pdr_ManSolveInt( pMan );
+    iFrame = pPars->iFrame;
+    Pdr_ManStop( pMan );
+    if ( RetValue == 0 )
+    {
+        pCex = pAig->pSeqModel;
+        pAig->pSeqModel = NULL;
+        assert( pCex != NULL );
+        pCex->iPo = iOut;
+    }
+    Aig_ManStop( pAig );
+    // record the result
+    Pdr_ShrLock( p );
+    p->iFrame = Abc_MaxInt( p->iFrame, iFrame );
+    if ( RetValue == 1 )
+    {
+        Vec_IntWriteEntry( p->vStatus, iOut, 1 );
+        p->pPars->nProveOuts++;
+        if ( p->pPars->fVerbose )
+            Abc_Print( 1, "Output %*d was proved in frame %2d (exported %d and imported %d lemmas so far).\n",
+                nOutDigits, iOut, iFrame, p->nExported, p->nImported );
+    }
+    else if ( RetValue == 0 && !p->pPars->fSolveAll )
+    {
+        Vec_IntWriteEntry( p->vStatus, iOut, 0 );
+        if ( p->pCex == NULL )
+        {
+            p->pPars->nFailOuts++;
+            p->pCex = pCex;
+            p->iFrameCex = iFrame;
+            pCex = NULL;
+        }
+        Pdr_ShrStop( p );
+    }
+    else if ( RetValue == 0 )
+    {
+        Vec_IntWriteEntry( p->vStatus, iOut, 0 );
+        p->pPars->nFailOuts++;
+        if ( !p->pPars->fNotVerbose )
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",
+                nOutDigits, iOut, iFrame, nOutDigits, p->pPars->nFailOuts, nOutDigits, Saig_ManPoNum(p->pAig) );
+        if ( p->pPars->fStoreCex )
+            Vec_PtrWriteEntry( p->vCexes, iOut, pCex ), pCex = NULL;
+        else
+            Vec_PtrWriteEntry( p->vCexes, iOut, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+        if ( p->pPars->pFuncOnFail && p->pPars->pFuncOnFail(iOut, p->pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, iOut) : NULL) )
+        {
+            if ( !p->pPars->fSilent && !p->fStop )
+                Abc_Print( 1, "Quitting due to callback on fail in frame %d.\n", iFrame );
+            Pdr_ShrStop( p );
+        }
+    }
+    else
+    {
+        Vec_IntWriteEntry( p->vStatus, iOut, -1 );
+        if ( p->pPars->fSolveAll && p->pPars->nTimeOutOne && !p->fStop && !p->pPars->fNotVerbose )
+            Abc_Print( 1, "Timing out on output %*d in frame %d.\n", nOutDigits, iOut, iFrame );
+    }
+    Pdr_ShrUnlock( p );
+    ABC_FREE( pCex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs taken from the queue until it is empty.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ShrSolveOutputs( Pdr_Shr_t * p )
+{
+    int iOut;
+    while ( (iOut = Pdr_ShrNextOutput(p)) >= 0 )
+    {
+#ifndef ABC_USE_PTHREADS
+        if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+            break;
+#endif
+        Pdr_ShrSolveOutput( p, iOut );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [The worker thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ShrWorkerThread( void * pArg )
+{
+    Pdr_Shr_t * p = (Pdr_Shr_t *)pArg;
+    int status;
+    Pdr_ShrSolveOutputs( p );
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    p->nRunning--;
+    status = pthread_cond_signal( &p->cond );  assert( status == 0 );
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the workers and waits for them to finish.]
+
+  Description [The master thread wakes up once a second to check the
+  wall-clock time limit and the stopping callback of the caller.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Pdr_ShrRunWorkers( Pdr_Shr_t * p, int nProcs )
+{
+    pthread_t * pThreads = ABC_ALLOC( pthread_t, nProcs );
+    struct timespec TimeStop;
+    int i, status, fTimeout = 0;
+    status = pthread_mutex_init( &p->mutex, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->cond, NULL );    assert( status == 0 );
+    p->nRunning = nProcs;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( pThreads + i, NULL, Pdr_ShrWorkerThread, (void *)p );  assert( status == 0 );
+    }
+    status = pthread_mutex_lock( &p->mutex );  assert( status == 0 );
+    while ( p->nRunning > 0 )
+    {
+        TimeStop.tv_sec  = time(NULL) + 1;
+        TimeStop.tv_nsec = 0;
+        pthread_cond_timedwait( &p->cond, &p->mutex, &TimeStop );
+        if ( p->fStop )
+            continue;
+        if ( p->pPars->nTimeOut && Abc_ClockWall() - p->clkStart >= (abctime)p->pPars->nTimeOut * CLOCKS_PER_SEC )
+            fTimeout = 1, Pdr_ShrStop( p );
+        else if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+            Pdr_ShrStop( p );
+    }
+    Pdr_ShrStop( p );
+    status = pthread_mutex_unlock( &p->mutex );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );  assert( status == 0 );
+    }
+    pthread_cond_destroy( &p->cond );
+    pthread_mutex_destroy( &p->mutex );
+    ABC_FREE( pThreads );
+    if ( fTimeout && !p->pPars->fSilent )
+        Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n", p->pPars->nTimeOut, p->iFrame );
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of a multi-output problem concurrently.]
+
+  Description [Each worker takes the next unsolved output from the queue
+  and runs PDR on it. When an output is proved, the clauses of its
+  inductive invariant hold in all reachable states; they are published
+  to the shared store and seed the frames of the other workers. Without
+  "-a", the first counter-example cancels the run. Without pthreads,
+  the outputs are solved one after another, still sharing the lemmas.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_Shr_t Shr, * p = &Shr;
+    Pdr_Set_t * pLemma;
+    int i, Status, RetValue, nOuts = Saig_ManPoNum(pAig);
+    int nProcs = Abc_MinInt( pPars->nProcs, nOuts );
+    assert( nProcs > 1 );
+    memset( p, 0, sizeof(Pdr_Shr_t) );
+    p->pAig     = pAig;
+    p->pPars    = pPars;
+    p->vStatus  = Vec_IntAlloc( nOuts );
+    Vec_IntFill( p->vStatus, nOuts, -2 );
+    p->vCexes   = pPars->fSolveAll ? Vec_PtrStart( nOuts ) : NULL;
+    p->vLemmas  = Vec_PtrAlloc( 1000 );
+    p->RunId    = g_nPdrParRunIds;
+    p->clkStart = Abc_ClockWall();
+    pPars->nProveOuts = pPars->nFailOuts = pPars->nDropOuts = 0;
+    pPars->iFrame = 0;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Solving %d outputs using %d workers.\n", nOuts, nProcs );
+#ifdef ABC_USE_PTHREADS
+    Pdr_ShrRunWorkers( p, nProcs );
+#else
+    Pdr_ShrSolveOutputs( p );
+#endif
+    // collect the results
+    pPars->nDropOuts = nOuts - pPars->nProveOuts - pPars->nFailOuts;
+    pPars->iFrame = (p->pCex ? p->iFrameCex : p->iFrame) - 1;
+    if ( pPars->nProveOuts == nOuts )
+        RetValue = 1;
+    else if ( pPars->nFailOuts > 0 )
+        RetValue = 0;
+    else
+        RetValue = -1;
+    pAig->pSeqModel = p->pCex;
+    if ( RetValue == 1 )
+        Abc_FrameSetInv( Pdr_ShrDeriveInvariant(p) );
+    if ( pPars->fSolveAll )
+    {
+        // convert all -2 (unknown) entries into -1 (undec)
+        Vec_IntForEachEntry( p->vStatus, Status, i )
+            if ( Status == -2 )
+                Vec_IntWriteEntry( p->vStatus, i, -1 );
+        Vec_IntFreeP( &pPars->vOutMap );
+        pPars->vOutMap = p->vStatus;
+        p->vStatus = NULL;
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = p->vCexes;
+    }
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Lemmas: Exported = %d. Imported = %d.  ", p->nExported, p->nImported );
+        Abc_PrintTime( 1, "Wall time", Abc_ClockWall() - p->clkStart );
+    }
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vLemmas, pLemma, i )
+        Pdr_SetDeref( pLemma );
+    Vec_PtrFree( p->vLemmas );
+    Vec_IntFreeP( &p->vStatus );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -27,6 +27,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+static void Pdr_ManSolverAddClauseInt( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -99,7 +101,7 @@ sat_solver * Pdr_ManFetchSolver( Pdr_Man_t * p, int k )
     // add the clauses
     Vec_VecForEachLevelStart( p->vClauses, vArrayK, i, k )
         Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK, pCube, j )
-            Pdr_ManSolverAddClause( p, k, pCube );
+            Pdr_ManSolverAddClauseInt( p, k, pCube );
     return pSat;
 }
 
@@ -210,7 +212,7 @@ void Pdr_ManSetPropertyOutput( Pdr_Man_t * p, int k )
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManSolverAddClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+static void Pdr_ManSolverAddClauseInt( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
 {
     sat_solver * pSat;
     Vec_Int_t * vLits;
@@ -221,6 +223,13 @@ void Pdr_ManSolverAddClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     assert( RetValue == 1 );
     sat_solver_compress( pSat );
 }
+void Pdr_ManSolverAddClause( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    // record the clause for the solvers of concurrent generalization
+    if ( p->pGen )
+        Pdr_GenLogClause( p->pGen, k, pCube );
+    Pdr_ManSolverAddClauseInt( p, k, pCube );
+}
 
 /**Function*************************************************************
 
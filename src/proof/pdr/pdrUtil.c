@@ -1150,11 +1150,21 @@ void Pdr_Write_to_stats(Pdr_Man_t * p, const char * format, ...){
     va_start(args, format);
     char cwd[max_path_size];
     memset(cwd, 0, max_path_size);
+    if ( p->pAig->pName == NULL )
+    {
+        va_end(args);
+        return;
+    }
     strcat(cwd, "./");
     strcat(cwd, p->pAig->pName);
     strcat(cwd, "_");
     strcat(cwd, "stats_michal.csv");
     FILE *fp = fopen(cwd, "a+");
+    if ( fp == NULL )
+    {
+        va_end(args);
+        return;
+    }
     vfprintf(fp, format, args);
     fclose(fp);
 }
@@ -1165,11 +1175,15 @@ void Pdr_Init_queue_write_to_stats(Pdr_Man_t * p){
     int max_path_size = 200;
     char cwd[max_path_size];
     memset(cwd, 0, max_path_size);
+    if ( p->pAig->pName == NULL )
+        return;
     strcat(cwd, "./");
     strcat(cwd, p->pAig->pName);
     strcat(cwd, "_");
     strcat(cwd, "stats_michal.csv");
     FILE *fp = fopen(cwd, "w+");
+    if ( fp == NULL )
+        return;
     fprintf(fp, "level,cube,depth\n");
     fclose(fp);
 }
@@ -1179,11 +1193,15 @@ void Pdr_Init_table_write_to_stats(Pdr_Man_t * p){
     int max_path_size = 200;
     char cwd[max_path_size];
     memset(cwd, 0, max_path_size);
+    if ( p->pAig->pName == NULL )
+        return;
     strcat(cwd, "./");
     strcat(cwd, p->pAig->pName);
     strcat(cwd, "_");
     strcat(cwd, "stats_michal.csv");
     FILE *fp = fopen(cwd, "w+");
+    if ( fp == NULL )
+        return;
     fprintf(fp, "state,nRef\n");
     fclose(fp);
 }
@@ -1195,11 +1213,21 @@ void Pdr_table_Write_to_stats(Pdr_Man_t * p, const char * format, ...){
     va_start(args, format);
     char cwd[max_path_size];
     memset(cwd, 0, max_path_size);
+    if ( p->pAig->pName == NULL )
+    {
+        va_end(args);
+        return;
+    }
     strcat(cwd, "./");
     strcat(cwd, p->pAig->pName);
     strcat(cwd, "_");
     strcat(cwd, "stats_michal.csv");
     FILE *fp = fopen(cwd, "a+");
+    if ( fp == NULL )
+    {
+        va_end(args);
+        return;
+    }
     vfprintf(fp, format, args);
     fclose(fp);
 }
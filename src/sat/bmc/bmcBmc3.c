@@ -27,6 +27,17 @@
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -66,6 +77,7 @@ struct Gia_ManBmc_t_
     bmcg_sat_solver * pSat3;       // SAT solver
     int               nSatVars;    // SAT variables
     int               nObjNums;    // SAT objects
+    Vec_Int_t *       vClaBuf;     // clauses collected instead of being added to the solver
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
 };
@@ -801,6 +813,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     if ( p->pPars->fVerbose )
     {
         int nUsedVars = p->pSat ? sat_solver_count_usedvars(p->pSat) : 0;
+        if ( p->pSat || p->pSat2 || p->pSat3 )
         Abc_Print( 1, "LStart(P) = %d  LDelta(Q) = %d  LRatio(R) = %d  ReduceDB = %d  Vars = %d  Used = %d (%.2f %%)\n", 
             p->pSat ? p->pSat->nLearntStart     : 0, 
             p->pSat ? p->pSat->nLearntDelta     : 0, 
@@ -834,6 +847,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_IntFree( p->vData );
     Hsh_IntManStop( p->vHash );
     Vec_IntFree( p->vId2Lit );
+    Vec_IntFreeP( &p->vClaBuf );
     ABC_FREE( p->pSopSizes );
     ABC_FREE( p->pSops[1] );
     ABC_FREE( p->pSops );
@@ -1019,7 +1033,13 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
                 }
                 CutLit = CutLit / 3;
             }
-            if ( p->pSat2 )
+            if ( p->vClaBuf )
+            {
+                Vec_IntPush( p->vClaBuf, nClaLits );
+                for ( b = 0; b < nClaLits; b++ )
+                    Vec_IntPush( p->vClaBuf, ClaLits[b] );
+            }
+            else if ( p->pSat2 )
             {
                 if ( !satoko_add_clause( p->pSat2, ClaLits, nClaLits ) )
                     assert( 0 );
@@ -1287,7 +1307,7 @@ int Saig_ManBmcCreateCnf( Gia_ManBmc_t * p, Aig_Obj_t * pObj, int iFrame )
         for ( i = bmcg_sat_solver_varnum(p->pSat3); i < p->nSatVars; i++ )
             bmcg_sat_solver_addvar( p->pSat3 );
     }
-    else
+    else if ( p->pSat )
         sat_solver_setnvars( p->pSat, p->nSatVars );
     return Lit;
 }
@@ -1343,6 +1363,8 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nTimeOutGap    =     0;    // time since the last CEX found
     p->nPisAbstract   =     0;    // the number of PIs to abstract
     p->fSolveAll      =     0;    // stops on the first SAT instance
+    p->nProcs         =     1;    // the number of threads solving the outputs
+    p->nFramesAhead   =     2;    // the number of frames unrolled ahead of the solvers
     p->fDropSatOuts   =     0;    // replace sat outputs by constant 0
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
@@ -1447,6 +1469,686 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+#ifdef ABC_USE_PTHREADS
+
+// one frame unrolled by the main thread
+typedef struct Bmc3_ParFrame_t_ Bmc3_ParFrame_t;
+struct Bmc3_ParFrame_t_
+{
+    Vec_Int_t *       vClauses;    // the clauses derived for this frame (size followed by literals)
+    Vec_Int_t *       vOutLits;    // the literal of each output (-1 if skipped)
+    int               nVars;       // the number of SAT variables after this frame
+};
+
+// one thread solving the outputs
+typedef struct Bmc3_ParThr_t_ Bmc3_ParThr_t;
+struct Bmc3_ParThr_t_
+{
+    struct Bmc3_Par_t_ * pPar;     // the shared state
+    sat_solver *      pSat;        // the solver of this thread
+    int               nFrames;     // the number of frames added to the solver
+    int               nUnits;      // the number of shared units added to the solver
+    Vec_Int_t *       vNewUnits;   // the shared units copied for adding to the solver
+};
+
+// the state shared by the main thread and the solving threads
+typedef struct Bmc3_Par_t_ Bmc3_Par_t;
+struct Bmc3_Par_t_
+{
+    Gia_ManBmc_t *    pMan;        // the BMC manager (used by the main thread only)
+    Vec_Ptr_t *       vFrames;     // the frames unrolled so far
+    int               nFramesFreed;// the number of frames whose clauses are freed
+    Vec_Int_t *       vUnits;      // the negated literals of the outputs proved so far
+    Vec_Int_t *       vJobs;       // the outputs solved in the current frame
+    Vec_Int_t *       vStatus;     // the status of each job
+    Vec_Ptr_t *       vModels;     // the satisfying assignment of each satisfiable job
+    Vec_Wrd_t *       vTimes;      // the runtime of each job
+    Bmc3_ParThr_t *   pThrs;       // the solving threads
+    int               nThreads;    // the number of solving threads
+    int               iFrame;      // the frame being solved
+    int               iNextJob;    // the next job to be solved
+    int               nBusy;       // the number of threads working on the current frame
+    int               Phase;       // the number of frames started
+    int               fExit;       // the threads should quit
+    int               iJobStop;    // the jobs from this one on are not solved
+    int               RunId;       // the id of the first job of the current frame
+    pthread_t *       pThreads;    // the thread handles
+    pthread_mutex_t   mutex;       // protects the fields above
+    pthread_cond_t    condStart;   // signals that a frame is started
+    pthread_cond_t    condDone;    // signals that a frame is solved
+};
+
+// the jobs get consecutive ids; the running jobs with ids from g_nBmc3ParStopId on are cancelled
+static volatile int g_nBmc3ParRunIds = 0;             // the id of the next job
+static volatile int g_nBmc3ParStopId = 0;             // the id of the first cancelled job
+int Bmc3_ParCallBackToStop( int RunId ) { return RunId >= g_nBmc3ParStopId; }
+
+/**Function*************************************************************
+
+  Synopsis    [Cancels the jobs of the current frame from this one on.]
+
+  Description [Should be called with the shared state locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Bmc3_ParCancel( Bmc3_Par_t * pPar, int iJob )
+{
+    if ( iJob >= pPar->iJobStop )
+        return;
+    pPar->iJobStop = iJob;
+    g_nBmc3ParStopId = pPar->RunId + iJob;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Unrolls the next frame into a separate clause buffer.]
+
+  Description [Mirrors the frame preparation of Saig_ManBmcScalable().
+  The clauses are not added to any solver; the solving threads load
+  them when they reach this frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc3_ParUnrollFrame( Bmc3_Par_t * pPar )
+{
+    Gia_ManBmc_t * p = pPar->pMan;
+    Bmc3_ParFrame_t * pFrame;
+    Aig_Obj_t * pObj;
+    unsigned * pInfo;
+    int i, f = Vec_PtrSize(pPar->vFrames);
+    // map nodes of this section
+    Vec_PtrPush( p->vId2Var, Vec_IntStartFull(p->nObjNums) );
+    Vec_PtrPush( p->vTerInfo, (pInfo = ABC_CALLOC(unsigned, p->nWordNum)) );
+    // prepare some nodes
+    Saig_ManBmcSetLiteral( p, Aig_ManConst1(p->pAig), f, 1 );
+    Saig_ManBmcSimInfoSet( pInfo, Aig_ManConst1(p->pAig), SAIG_TER_ONE );
+    Saig_ManForEachPi( p->pAig, pObj, i )
+        Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_UND );
+    if ( f == 0 )
+    {
+        Saig_ManForEachLo( p->pAig, pObj, i )
+        {
+            Saig_ManBmcSetLiteral( p, pObj, 0, 0 );
+            Saig_ManBmcSimInfoSet( pInfo, pObj, SAIG_TER_ZER );
+        }
+    }
+    // add constraints for the outputs
+    pFrame = ABC_CALLOC( Bmc3_ParFrame_t, 1 );
+    pFrame->vOutLits = Vec_IntStartFull( Saig_ManPoNum(p->pAig) );
+    if ( !(p->pPars->nStart && f < p->pPars->nStart) )
+    Saig_ManForEachPo( p->pAig, pObj, i )
+    {
+        if ( i >= Saig_ManPoNum(p->pAig) )
+            break;
+        // skip solved outputs
+        if ( p->vCexes && Vec_PtrEntry(p->vCexes, i) )
+            continue;
+        // skip output whose time has run out
+        if ( p->pTime4Outs && p->pTime4Outs[i] == 0 )
+            continue;
+        Vec_IntWriteEntry( pFrame->vOutLits, i, Saig_ManBmcCreateCnf(p, pObj, f) );
+    }
+    pFrame->vClauses = p->vClaBuf;
+    pFrame->nVars    = p->nSatVars;
+    p->vClaBuf = Vec_IntAlloc( Vec_IntSize(pFrame->vClauses) );
+    pthread_mutex_lock( &pPar->mutex );
+    Vec_PtrPush( pPar->vFrames, pFrame );
+    pthread_mutex_unlock( &pPar->mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Brings the solver of the thread up to the current frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc3_ParSyncSolver( Bmc3_Par_t * pPar, Bmc3_ParThr_t * pThr, int iFrame )
+{
+    Bmc3_ParFrame_t * pFrame;
+    int * pBeg, k, nLits, Lit, RetValue;
+    for ( ; pThr->nFrames <= iFrame; pThr->nFrames++ )
+    {
+        pthread_mutex_lock( &pPar->mutex );
+        pFrame = (Bmc3_ParFrame_t *)Vec_PtrEntry( pPar->vFrames, pThr->nFrames );
+        pthread_mutex_unlock( &pPar->mutex );
+        sat_solver_setnvars( pThr->pSat, pFrame->nVars );
+        for ( k = 0; k < Vec_IntSize(pFrame->vClauses); k += nLits + 1 )
+        {
+            nLits = Vec_IntEntry( pFrame->vClauses, k );
+            pBeg  = Vec_IntArray( pFrame->vClauses ) + k + 1;
+            RetValue = sat_solver_addclause( pThr->pSat, pBeg, pBeg + nLits );
+            assert( RetValue );
+        }
+    }
+    // add the outputs proved by other threads
+    Vec_IntClear( pThr->vNewUnits );
+    pthread_mutex_lock( &pPar->mutex );
+    for ( ; pThr->nUnits < Vec_IntSize(pPar->vUnits); pThr->nUnits++ )
+        Vec_IntPush( pThr->vNewUnits, Vec_IntEntry(pPar->vUnits, pThr->nUnits) );
+    pthread_mutex_unlock( &pPar->mutex );
+    Vec_IntForEachEntry( pThr->vNewUnits, Lit, k )
+    {
+        RetValue = sat_solver_addclause( pThr->pSat, &Lit, &Lit + 1 );
+        assert( RetValue );
+    }
+    sat_solver_compress( pThr->pSat );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the current frame.]
+
+  Description [Each thread takes the next output and solves it on its
+  own solver. The outputs proved by the thread are added to its solver
+  as units; the main thread shares them with the other threads.
+  Without "-a", a satisfiable output cancels the jobs of the outputs
+  with larger numbers, while those with smaller numbers are finished.
+  So the satisfiable output with the smallest number is reported, as
+  in the sequential run.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmc3_ParSolveJobs( Bmc3_Par_t * pPar, Bmc3_ParThr_t * pThr, int Phase )
+{
+    Saig_ParBmc_t * pPars = pPar->pMan->pPars;
+    Bmc3_ParFrame_t * pFrame;
+    unsigned * pModel;
+    abctime clk, Limit;
+    int iJob, iOut, Lit, v, status, RunId;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pPar->mutex );
+        iJob = (Phase == pPar->Phase && pPar->iNextJob < pPar->iJobStop) ? pPar->iNextJob++ : -1;
+        pFrame = iJob >= 0 ? (Bmc3_ParFrame_t *)Vec_PtrEntry( pPar->vFrames, pPar->iFrame ) : NULL;
+        RunId  = pPar->RunId;
+        pthread_mutex_unlock( &pPar->mutex );
+        if ( iJob == -1 )
+            break;
+        iOut   = Vec_IntEntry( pPar->vJobs, iJob );
+        Lit    = Vec_IntEntry( pFrame->vOutLits, iOut );
+        pModel = NULL;
+        clk    = Abc_Clock();
+        if ( Lit < 2 )
+            status = Lit ? l_True : l_False;
+        else
+        {
+            Limit = pPar->pMan->pTime4Outs ? pPar->pMan->pTime4Outs[iOut] : 0;
+            sat_solver_set_runtime_limit( pThr->pSat, Limit ? Limit + Abc_Clock() : 0 );
+            sat_solver_set_runid( pThr->pSat, RunId + iJob );
+            status = sat_solver_solve( pThr->pSat, &Lit, &Lit + 1, (ABC_INT64_T)pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+            if ( status == l_False )
+            {
+                // add final unit clause
+                Lit = lit_neg( Lit );
+                status = sat_solver_addclause( pThr->pSat, &Lit, &Lit + 1 );
+                assert( status );
+                status = l_False;
+            }
+            else if ( status == l_True )
+            {
+                // save the satisfying assignment
+                pModel = ABC_CALLOC( unsigned, Abc_BitWordNum(pFrame->nVars) );
+                for ( v = 0; v < pFrame->nVars; v++ )
+                    if ( sat_solver_var_value(pThr->pSat, v) )
+                        Abc_InfoSetBit( pModel, v );
+            }
+        }
+        Vec_IntWriteEntry( pPar->vStatus, iJob, status );
+        Vec_PtrWriteEntry( pPar->vModels, iJob, pModel );
+        Vec_WrdWriteEntry( pPar->vTimes, iJob, (word)(Abc_Clock() - clk) );
+        pthread_mutex_lock( &pPar->mutex );
+        // a satisfiable output cancels the outputs with larger numbers
+        if ( status == l_True && !pPars->fSolveAll )
+            Bmc3_ParCancel( pPar, iJob + 1 );
+        pthread_mutex_unlock( &pPar->mutex );
+    }
+}
+static void * Bmc3_ParWorkerThread( void * pArg )
+{
+    Bmc3_ParThr_t * pThr = (Bmc3_ParThr_t *)pArg;
+    Bmc3_Par_t * pPar = pThr->pPar;
+    int Phase = 0, iFrame;
+    pthread_mutex_lock( &pPar->mutex );
+    while ( 1 )
+    {
+        while ( Phase == pPar->Phase && !pPar->fExit )
+            pthread_cond_wait( &pPar->condStart, &pPar->mutex );
+        if ( pPar->fExit )
+            break;
+        Phase  = pPar->Phase;
+        iFrame = pPar->iFrame;
+        pthread_mutex_unlock( &pPar->mutex );
+        Bmc3_ParSyncSolver( pPar, pThr, iFrame );
+        Bmc3_ParSolveJobs( pPar, pThr, Phase );
+        pthread_mutex_lock( &pPar->mutex );
+        // the last thread to finish completes the frame
+        if ( --pPar->nBusy == 0 )
+            pthread_cond_signal( &pPar->condDone );
+    }
+    pthread_mutex_unlock( &pPar->mutex );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the solving threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Bmc3_Par_t * Bmc3_ParStart( Gia_ManBmc_t * p, int nThreads )
+{
+    Bmc3_Par_t * pPar = ABC_CALLOC( Bmc3_Par_t, 1 );
+    int i, status;
+    pPar->pMan     = p;
+    pPar->nThreads = nThreads;
+    pPar->vFrames  = Vec_PtrAlloc( 100 );
+    pPar->vUnits   = Vec_IntAlloc( 100 );
+    pPar->vJobs    = Vec_IntAlloc( Saig_ManPoNum(p->pAig) );
+    pPar->vStatus  = Vec_IntAlloc( Saig_ManPoNum(p->pAig) );
+    pPar->vModels  = Vec_PtrAlloc( Saig_ManPoNum(p->pAig) );
+    pPar->vTimes   = Vec_WrdAlloc( Saig_ManPoNum(p->pAig) );
+    pPar->pThrs    = ABC_CALLOC( Bmc3_ParThr_t, nThreads );
+    pPar->pThreads = ABC_ALLOC( pthread_t, nThreads );
+    status = pthread_mutex_init( &pPar->mutex, NULL );      assert( status == 0 );
+    status = pthread_cond_init( &pPar->condStart, NULL );   assert( status == 0 );
+    status = pthread_cond_init( &pPar->condDone, NULL );    assert( status == 0 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        sat_solver * pSat = sat_solver_new();
+        sat_solver_setnvars( pSat, 1000 );
+        pSat->nLearntStart = p->pPars->nLearnedStart;
+        pSat->nLearntDelta = p->pPars->nLearnedDelta;
+        pSat->nLearntRatio = p->pPars->nLearnedPerce;
+        pSat->nLearntMax   = pSat->nLearntStart;
+        pSat->fNoRestarts  = p->pPars->fNoRestarts;
+        sat_solver_set_stop_func( pSat, Bmc3_ParCallBackToStop );
+        pPar->pThrs[i].pPar = pPar;
+        pPar->pThrs[i].pSat = pSat;
+        pPar->pThrs[i].vNewUnits = Vec_IntAlloc( 100 );
+        status = pthread_create( pPar->pThreads + i, NULL, Bmc3_ParWorkerThread, (void *)(pPar->pThrs + i) );  assert( status == 0 );
+    }
+    return pPar;
+}
+static void Bmc3_ParStop( Bmc3_Par_t * pPar )
+{
+    Bmc3_ParFrame_t * pFrame;
+    void * pModel;
+    int i, status;
+    pthread_mutex_lock( &pPar->mutex );
+    pPar->fExit = 1;
+    pthread_cond_broadcast( &pPar->condStart );
+    pthread_mutex_unlock( &pPar->mutex );
+    for ( i = 0; i < pPar->nThreads; i++ )
+    {
+        status = pthread_join( pPar->pThreads[i], NULL );  assert( status == 0 );
+        sat_solver_delete( pPar->pThrs[i].pSat );
+        Vec_IntFree( pPar->pThrs[i].vNewUnits );
+    }
+    pthread_cond_destroy( &pPar->condDone );
+    pthread_cond_destroy( &pPar->condStart );
+    pthread_mutex_destroy( &pPar->mutex );
+    Vec_PtrForEachEntry( Bmc3_ParFrame_t *, pPar->vFrames, pFrame, i )
+    {
+        Vec_IntFreeP( &pFrame->vClauses );
+        Vec_IntFree( pFrame->vOutLits );
+        ABC_FREE( pFrame );
+    }
+    Vec_PtrForEachEntry( void *, pPar->vModels, pModel, i )
+        ABC_FREE( pModel );
+    Vec_PtrFree( pPar->vFrames );
+    Vec_IntFree( pPar->vUnits );
+    Vec_IntFree( pPar->vJobs );
+    Vec_IntFree( pPar->vStatus );
+    Vec_PtrFree( pPar->vModels );
+    Vec_WrdFree( pPar->vTimes );
+    ABC_FREE( pPar->pThrs );
+    ABC_FREE( pPar->pThreads );
+    ABC_FREE( pPar );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the sum of a solver statistic over the threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static double Bmc3_ParSolverStats( Bmc3_Par_t * pPar, int Type )
+{
+    double Res = 0;
+    int i;
+    for ( i = 0; i < pPar->nThreads; i++ )
+        Res += Type == 0 ? pPar->pThrs[i].pSat->stats.conflicts : Type == 1 ? pPar->pThrs[i].pSat->stats.learnts : sat_solver_memory(pPar->pThrs[i].pSat);
+    return Res;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example from the saved assignment.]
+
+  Description [The primary inputs without a SAT variable in this frame
+  do not belong to the cone of the output and are set to 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Bmc3_ParGenerateCex( Gia_ManBmc_t * p, int f, int i, unsigned * pModel, int nVars )
+{
+    Aig_Obj_t * pObjPi;
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), Saig_ManPoNum(p->pAig), f*Saig_ManPoNum(p->pAig)+i );
+    int j, k, iBit = Saig_ManRegNum(p->pAig);
+    for ( j = 0; j <= f; j++, iBit += Saig_ManPiNum(p->pAig) )
+        Saig_ManForEachPi( p->pAig, pObjPi, k )
+        {
+            int iLit = Saig_ManBmcLiteral( p, pObjPi, j );
+            if ( pModel && iLit != ~0 && lit_var(iLit) < nVars && Abc_InfoHasBit(pModel, lit_var(iLit)) )
+                Abc_InfoSetBit( pCex->pData, iBit + k );
+        }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking with pipelined unrolling.]
+
+  Description [The main thread unrolls up to nFramesAhead frames ahead
+  of the frame being solved, while the outputs of this frame are solved
+  on nProcs threads, each with its own solver. Runtime limits are in
+  wall-clock time. The SAT solver is always MiniSat-based (bsat).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Gia_ManBmc_t * p;
+    Bmc3_Par_t * pPar;
+    Bmc3_ParFrame_t * pFrame;
+    Abc_Cex_t * pCexNew;
+    FILE * pLogFile = NULL;
+    struct timespec TimeStop;
+    unsigned * pModel;
+    int RetValue = -1, fUndec = 0, fStop = 0;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
+    int i, j, f, Lit, status;
+    abctime clk, clkJob, clkOther = 0, clkTotal = Abc_ClockWall();
+    abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0;
+    abctime nTimeToStop;
+    if ( pPars->pLogFileName )
+        pLogFile = fopen( pPars->pLogFileName, "wb" );
+    if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
+        pPars->nTimeOut = pPars->nTimeOutOne * Saig_ManPoNum(pAig) / 1000 + 1;
+    if ( pPars->nTimeOutOne && !pPars->fSolveAll )
+        pPars->nTimeOutOne = 0;
+    nTimeToStop = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_ClockWall(): 0;
+    // create BMC manager collecting the clauses of each frame
+    p = Saig_Bmc3ManStart( pAig, pPars->nTimeOutOne, pPars->nConfLimit, 0, 0 );
+    p->pPars = pPars;
+    sat_solver_delete( p->pSat );
+    p->pSat = NULL;
+    p->vClaBuf = Vec_IntAlloc( 1000 );
+    if ( pPars->fSolveAll && p->vCexes == NULL )
+        p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n",
+            Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
+            Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig), p->nObjNums );
+        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d. Threads = %d. Ahead = %d.\n",
+            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll, pPars->nProcs, pPars->nFramesAhead );
+    }
+    pPars->nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    pPar = Bmc3_ParStart( p, pPars->nProcs );
+    // perform frames
+    Aig_ManRandom( 1 );
+    pPars->timeLastSolved = Abc_ClockWall();
+    for ( f = 0; f < pPars->nFramesMax; f++ )
+    {
+        // stop BMC after exploring all reachable states
+        if ( Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
+        {
+            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            RetValue = pPars->nFailOuts ? 0 : 1;
+            goto finish;
+        }
+        // stop BMC if all targets are solved
+        if ( pPars->fSolveAll && pPars->nFailOuts + pPars->nDropOuts >= Saig_ManPoNum(pAig) )
+        {
+            Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            RetValue = pPars->nFailOuts ? 0 : 1;
+            goto finish;
+        }
+        // consider the next timeframe
+        if ( (RetValue == -1 || pPars->fSolveAll) && pPars->nStart == 0 )
+            pPars->iFrame = f-1;
+        // unroll this frame unless it was unrolled ahead
+        if ( Vec_PtrSize(pPar->vFrames) == f )
+        {
+            clk = Abc_Clock();
+            Bmc3_ParUnrollFrame( pPar );
+            clkOther += Abc_Clock() - clk;
+        }
+        if ( pPars->nStart && f < pPars->nStart )
+            continue;
+        // collect the outputs to be solved
+        pFrame = (Bmc3_ParFrame_t *)Vec_PtrEntry( pPar->vFrames, f );
+        pthread_mutex_lock( &pPar->mutex );
+        Vec_IntClear( pPar->vJobs );
+        for ( i = 0; i < Saig_ManPoNum(pAig); i++ )
+        {
+            // skip solved outputs
+            if ( p->vCexes && Vec_PtrEntry(p->vCexes, i) )
+                continue;
+            // skip output whose time has run out
+            if ( p->pTime4Outs && p->pTime4Outs[i] == 0 )
+                continue;
+            if ( Vec_IntEntry(pFrame->vOutLits, i) != 0 )
+                Vec_IntPush( pPar->vJobs, i );
+        }
+        Vec_PtrForEachEntry( unsigned *, pPar->vModels, pModel, j )
+            ABC_FREE( pModel );
+        Vec_IntFill( pPar->vStatus, Vec_IntSize(pPar->vJobs), l_Undef );
+        Vec_PtrFill( pPar->vModels, Vec_IntSize(pPar->vJobs), NULL );
+        Vec_WrdFill( pPar->vTimes, Vec_IntSize(pPar->vJobs), 0 );
+        // start solving this frame
+        pPar->iFrame   = f;
+        pPar->iNextJob = 0;
+        pPar->nBusy    = pPar->nThreads;
+        pPar->iJobStop = Vec_IntSize(pPar->vJobs);
+        pPar->RunId    = g_nBmc3ParRunIds;
+        g_nBmc3ParRunIds += Vec_IntSize(pPar->vJobs);
+        g_nBmc3ParStopId  = g_nBmc3ParRunIds;
+        pPar->Phase++;
+        pthread_cond_broadcast( &pPar->condStart );
+        pthread_mutex_unlock( &pPar->mutex );
+        // unroll the next frames while waiting
+        while ( 1 )
+        {
+            // check for timeout
+            if ( fStop )
+                ;
+            else if ( pPars->nTimeOutGap && pPars->timeLastSolved && Abc_ClockWall() > pPars->timeLastSolved + pPars->nTimeOutGap * CLOCKS_PER_SEC )
+            {
+                Abc_Print( 1, "Reached gap timeout (%d seconds).\n",  pPars->nTimeOutGap );
+                fStop = 1;
+            }
+            else if ( nTimeToStop && Abc_ClockWall() > nTimeToStop )
+            {
+                if ( !pPars->fSilent )
+                    Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+                fStop = 1;
+            }
+            else if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+            {
+                if ( !pPars->fSilent )
+                    Abc_Print( 1, "Bmc3 got callbacks.\n" );
+                fStop = 1;
+            }
+            pthread_mutex_lock( &pPar->mutex );
+            // cancel the solvers and wait for them to return
+            if ( fStop )
+                Bmc3_ParCancel( pPar, 0 );
+            // the frame is solved when all threads are waiting for the next one
+            if ( pPar->nBusy == 0 )
+            {
+                pthread_mutex_unlock( &pPar->mutex );
+                break;
+            }
+            if ( fStop || Vec_PtrSize(pPar->vFrames) > f + pPars->nFramesAhead || Vec_PtrSize(pPar->vFrames) >= pPars->nFramesMax )
+            {
+                clock_gettime( CLOCK_REALTIME, &TimeStop );
+                TimeStop.tv_sec++;
+                pthread_cond_timedwait( &pPar->condDone, &pPar->mutex, &TimeStop );
+                pthread_mutex_unlock( &pPar->mutex );
+            }
+            else
+            {
+                pthread_mutex_unlock( &pPar->mutex );
+                clk = Abc_Clock();
+                Bmc3_ParUnrollFrame( pPar );
+                clkOther += Abc_Clock() - clk;
+            }
+        }
+        if ( fStop )
+            goto finish;
+        // the threads have loaded the clauses of the frames up to this one
+        for ( ; pPar->nFramesFreed <= f; pPar->nFramesFreed++ )
+            Vec_IntFreeP( &((Bmc3_ParFrame_t *)Vec_PtrEntry(pPar->vFrames, pPar->nFramesFreed))->vClauses );
+        // process the results in the order of outputs
+        Vec_IntForEachEntry( pPar->vJobs, i, j )
+        {
+            status = Vec_IntEntry( pPar->vStatus, j );
+            clkJob = (abctime)Vec_WrdEntry( pPar->vTimes, j );
+            Lit    = Vec_IntEntry( pFrame->vOutLits, i );
+            if ( pLogFile )
+                fprintf( pLogFile, "Frame %5d  Output %5d  Time(ms) %8d %8d\n", f, i,
+                    Lit < 2 ? 0 : (int)(clkJob * 1000 / CLOCKS_PER_SEC),
+                    Lit < 2 || !p->pTime4Outs ? 0 : Abc_MaxInt(0, Abc_MinInt(pPars->nTimeOutOne, pPars->nTimeOutOne - (int)((p->pTime4Outs[i] - clkJob) * 1000 / CLOCKS_PER_SEC))) );
+            if ( p->pTime4Outs && Lit >= 2 )
+            {
+                assert( p->pTime4Outs[i] > 0 );
+                p->pTime4Outs[i] = (p->pTime4Outs[i] > clkJob) ? p->pTime4Outs[i] - clkJob : 0;
+                if ( p->pTime4Outs[i] == 0 && status != l_True )
+                    pPars->nDropOuts++;
+            }
+            if ( status == l_False )
+            {
+nTimeUnsat += clkJob;
+                if ( Lit >= 2 )
+                {
+                    pthread_mutex_lock( &pPar->mutex );
+                    Vec_IntPush( pPar->vUnits, lit_neg(Lit) );
+                    pthread_mutex_unlock( &pPar->mutex );
+                }
+            }
+            else if ( status == l_True )
+            {
+nTimeSat += clkJob;
+                RetValue = 0;
+                pModel   = (unsigned *)Vec_PtrEntry( pPar->vModels, j );
+                if ( !pPars->fSolveAll )
+                {
+                    ABC_FREE( pAig->pSeqModel );
+                    pAig->pSeqModel = Bmc3_ParGenerateCex( p, f, i, pModel, pFrame->nVars );
+                    goto finish;
+                }
+                pPars->nFailOuts++;
+                if ( !pPars->fNotVerbose )
+                    Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",
+                        nOutDigits, i, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
+                pCexNew = pPars->fStoreCex ? Bmc3_ParGenerateCex( p, f, i, pModel, pFrame->nVars ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                Vec_PtrWriteEntry( p->vCexes, i, pCexNew );
+                if ( pPars->pFuncOnFail && pPars->pFuncOnFail(i, pPars->fStoreCex ? pCexNew : NULL) )
+                {
+                    Abc_Print( 1, "Quitting due to callback on fail.\n" );
+                    goto finish;
+                }
+                // reset the timeout
+                pPars->timeLastSolved = Abc_ClockWall();
+            }
+            else
+            {
+nTimeUndec += clkJob;
+                if ( p->pTime4Outs == NULL )
+                    fUndec = 1;
+            }
+        }
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "%4d %s : ", f, fUndec ? "-" : "+" );
+            Abc_Print( 1, "Var =%8.0f. ", (double)pFrame->nVars );
+            Abc_Print( 1, "Jobs =%6d. ",  Vec_IntSize(pPar->vJobs) );
+            Abc_Print( 1, "Conf =%7.0f. ",  Bmc3_ParSolverStats(pPar, 0) );
+            Abc_Print( 1, "Learn =%7.0f. ", Bmc3_ParSolverStats(pPar, 1) );
+            if ( pPars->fSolveAll )
+                Abc_Print( 1, "CEX =%5d. ", pPars->nFailOuts );
+            if ( pPars->nTimeOutOne )
+                Abc_Print( 1, "T/O =%4d. ", pPars->nDropOuts );
+            Abc_Print( 1, "Ahead =%3d. ", Vec_PtrSize(pPar->vFrames) - f - 1 );
+            Abc_Print( 1, "%4.0f MB",     4.0*(f+1)*p->nObjNums /(1<<20) );
+            Abc_Print( 1, "%4.0f MB",     1.0*Bmc3_ParSolverStats(pPar, 2)/(1<<20) );
+            Abc_Print( 1, "%9.2f sec ",   1.0*(Abc_ClockWall() - clkTotal)/CLOCKS_PER_SEC );
+            Abc_Print( 1, "\n" );
+            fflush( stdout );
+        }
+        if ( fUndec )
+            goto finish;
+    }
+    // consider the next timeframe
+    if ( RetValue == -1 && pPars->nStart == 0 )
+        pPars->iFrame = f-1;
+finish:
+    if ( pPars->fVerbose )
+    {
+        abctime clkWall = Abc_ClockWall() - clkTotal;
+        Abc_Print( 1, "Runtime:  " );
+        Abc_Print( 1, "CNF = %.1f sec (%.1f %%)  ",   1.0*clkOther/CLOCKS_PER_SEC,   100.0*clkOther/clkWall   );
+        Abc_Print( 1, "UNSAT = %.1f sec (%.1f %%)  ", 1.0*nTimeUnsat/CLOCKS_PER_SEC, 100.0*nTimeUnsat/clkWall );
+        Abc_Print( 1, "SAT = %.1f sec (%.1f %%)  ",   1.0*nTimeSat/CLOCKS_PER_SEC,   100.0*nTimeSat/clkWall   );
+        Abc_Print( 1, "UNDEC = %.1f sec (%.1f %%)",   1.0*nTimeUndec/CLOCKS_PER_SEC, 100.0*nTimeUndec/clkWall );
+        Abc_Print( 1, "\n" );
+        Abc_Print( 1, "Solving on %d threads, unrolling up to %d frames ahead.  ", pPars->nProcs, pPars->nFramesAhead );
+        Abc_PrintTime( 1, "Wall time", clkWall );
+    }
+    Bmc3_ParStop( pPar );
+    Saig_Bmc3ManStop( p );
+    fflush( stdout );
+    if ( pLogFile )
+        fclose( pLogFile );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1471,6 +2173,10 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nProcs > 1 && !pPars->fUseSatoko && !pPars->fUseGlucose && !pPars->fUseBridge && !pPars->nFramesJump )
+        return Saig_ManBmcScalablePar( pAig, pPars );
+#endif
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
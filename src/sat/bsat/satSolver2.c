@@ -1971,6 +1971,8 @@ int sat_solver2_solve(sat_solver2* s, lit* begin, lit* end, ABC_INT64_T nConfLim
             break;
         if ( s->nInsLimit  && s->stats.propagations > s->nInsLimit )
             break;
+        if ( s->pFuncStop && s->pFuncStop(s->RunId) )
+            break;
     }
     if (s->verbosity >= 1)
         Abc_Print(1,"==============================================================================\n");
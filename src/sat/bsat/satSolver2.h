@@ -173,6 +173,8 @@ struct sat_solver2_t
     ABC_INT64_T     nConfLimit;     // external limit on the number of conflicts
     ABC_INT64_T     nInsLimit;      // external limit on the number of implications
     abctime         nRuntimeLimit;  // external limit on runtime
+    int             RunId;          // SAT id in this run
+    int(*pFuncStop)(int);           // callback to terminate
 };
 
 static inline clause * clause2_read( sat_solver2 * s, cla h )                  { return Sat_MemClauseHand( &s->Mem, h ); }
@@ -238,6 +240,15 @@ static inline abctime sat_solver2_set_runtime_limit(sat_solver2* s, abctime Limi
     return temp;
 }
 
+static inline void sat_solver2_set_runid( sat_solver2 *s, int id )
+{ 
+    s->RunId      = id;  
+}
+static inline void sat_solver2_set_stop_func( sat_solver2 *s, int (*fnct)(int) ) 
+{ 
+    s->pFuncStop = fnct; 
+}
+
 static inline int sat_solver2_set_learntmax(sat_solver2* s, int nLearntMax)
 {
     int temp = s->nLearntMax;